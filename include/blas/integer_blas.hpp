@@ -7,7 +7,9 @@
 #define INTEGER_BLAS_HPP
 
 #include <cstdint>
+#include <cmath>
 #include <fp/fp.hpp>
+#include <blas/wrapper.hpp>
 
 #if !defined(FP_NAMESPACE)
     #define FP_NAMESPACE fw
@@ -15,10 +17,282 @@
 
 namespace FP_NAMESPACE
 {
+#if defined(FP_INTEGER_GEMV_QUANTIZED) && defined(FP_SIMD_AVX2)
+    namespace internal
+    {
+        // vector chunks are quantized independently: 256 products of 8-bit unsigned and 16-bit signed integers
+        // can be accumulated without overflow in 32-bit signed integers
+        constexpr std::size_t quantization_chunk_size = 256;
+
+        //! \brief Quantize a floating point vector to 16-bit signed integers
+        //!
+        //! The output satisfies in[i] ~ scale * out[i] with scale = max(|in[i]|) / 32767.
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input vector
+        //! \param out pointer to the output vector
+        //! \param n length of the vector
+        //! \return scale
+        template <typename T>
+        static inline T quantize(const T* in, std::int16_t* out, const std::size_t n)
+        {
+            constexpr T f_0 = static_cast<T>(0.0);
+            constexpr T f_max = static_cast<T>(32767.0);
+
+            T max_abs = f_0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                max_abs = std::max(max_abs, std::abs(in[i]));
+            }
+
+            if (max_abs == f_0)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    out[i] = 0;
+                }
+                return f_0;
+            }
+
+            const T inv_scale = f_max / max_abs;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = static_cast<std::int16_t>(std::lrint(std::min(f_max, std::max(-f_max, in[i] * inv_scale))));
+            }
+
+            return max_abs / f_max;
+        }
+
+        //! \brief Integer dot products of 4 consecutive rows of 8-bit unsigned integers with 16-bit signed integers (AVX2: vpmaddwd)
+        //!
+        //! Computes y[jj] = dot(a[jj * ld], x) for jj = 0..3.
+        //!
+        //! \param a pointer to the first row
+        //! \param ld distance between consecutive rows
+        //! \param x pointer to the 16-bit signed integers
+        //! \param y pointer to the 32-bit signed integer output
+        //! \param n length of the rows (at most 'quantization_chunk_size')
+        FP_TARGET_AVX2 static inline void dot4_u8_i16_simd_intrinsics(const std::uint8_t* a, const std::size_t ld, const std::int16_t* x, std::int32_t* y, const std::size_t n)
+        {
+            constexpr std::size_t chunk_size = 16;
+            const std::size_t n_simd = (n / chunk_size) * chunk_size;
+
+            __m256i acc[4];
+            for (std::size_t jj = 0; jj < 4; ++jj)
+            {
+                acc[jj] = _mm256_setzero_si256();
+            }
+
+            for (std::size_t i = 0; i < n_simd; i += chunk_size)
+            {
+                const __m256i v_x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&x[i]));
+                for (std::size_t jj = 0; jj < 4; ++jj)
+                {
+                    const __m256i v_a = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&a[jj * ld + i])));
+                    acc[jj] = _mm256_add_epi32(acc[jj], _mm256_madd_epi16(v_a, v_x));
+                }
+            }
+
+            // horizontal reduction of all 4 accumulators at once
+            const __m256i tmp = _mm256_hadd_epi32(_mm256_hadd_epi32(acc[0], acc[1]), _mm256_hadd_epi32(acc[2], acc[3]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(y), _mm_add_epi32(_mm256_castsi256_si128(tmp), _mm256_extracti128_si256(tmp, 1)));
+
+            for (std::size_t jj = 0; jj < 4; ++jj)
+            {
+                for (std::size_t i = n_simd; i < n; ++i)
+                {
+                    y[jj] += static_cast<std::int32_t>(a[jj * ld + i]) * x[i];
+                }
+            }
+        }
+
+        //! \brief Integer axpy on two consecutive rows of 8-bit unsigned integers (AVX2: vpmaddwd)
+        //!
+        //! Computes y[j] += a_0[j] * x_0 + a_1[j] * x_1 for j = 0..('n' - 1).
+        //!
+        //! \param a_0 pointer to the first row
+        //! \param a_1 pointer to the second row
+        //! \param x_0 16-bit signed integer factor for the first row
+        //! \param x_1 16-bit signed integer factor for the second row
+        //! \param y pointer to the 32-bit signed integer output vector
+        //! \param n length of the rows
+        FP_TARGET_AVX2 static inline void axpy2_u8_i16_simd_intrinsics(const std::uint8_t* a_0, const std::uint8_t* a_1, const std::int16_t x_0, const std::int16_t x_1, std::int32_t* y, const std::size_t n)
+        {
+            constexpr std::size_t chunk_size = 16;
+            const std::size_t n_simd = (n / chunk_size) * chunk_size;
+
+            // pairs (x_0, x_1) match the interleaved pairs (a_0[j], a_1[j])
+            const __m256i v_x = _mm256_set1_epi32(static_cast<std::int32_t>((static_cast<std::uint32_t>(static_cast<std::uint16_t>(x_1)) << 16) | static_cast<std::uint16_t>(x_0)));
+            for (std::size_t j = 0; j < n_simd; j += chunk_size)
+            {
+                const __m128i v_a_0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&a_0[j]));
+                const __m128i v_a_1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&a_1[j]));
+                const __m256i v_a_lo = _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(v_a_0, v_a_1));
+                const __m256i v_a_hi = _mm256_cvtepu8_epi16(_mm_unpackhi_epi8(v_a_0, v_a_1));
+                __m256i* ptr_y = reinterpret_cast<__m256i*>(&y[j]);
+                _mm256_storeu_si256(&ptr_y[0], _mm256_add_epi32(_mm256_loadu_si256(&ptr_y[0]), _mm256_madd_epi16(v_a_lo, v_x)));
+                _mm256_storeu_si256(&ptr_y[1], _mm256_add_epi32(_mm256_loadu_si256(&ptr_y[1]), _mm256_madd_epi16(v_a_hi, v_x)));
+            }
+
+            for (std::size_t j = n_simd; j < n; ++j)
+            {
+                y[j] += static_cast<std::int32_t>(a_0[j]) * x_0 + static_cast<std::int32_t>(a_1[j]) * x_1;
+            }
+        }
+
+    #if defined(FP_SIMD_AVX512_VNNI)
+        //! \brief Integer axpy on two consecutive rows of 8-bit unsigned integers (AVX512-VNNI: vpdpwssd)
+        //!
+        //! Computes y[j] += a_0[j] * x_0 + a_1[j] * x_1 for j = 0..('n' - 1).
+        //!
+        //! \param a_0 pointer to the first row
+        //! \param a_1 pointer to the second row
+        //! \param x_0 16-bit signed integer factor for the first row
+        //! \param x_1 16-bit signed integer factor for the second row
+        //! \param y pointer to the 32-bit signed integer output vector
+        //! \param n length of the rows
+        FP_TARGET_AVX512_VNNI static inline void axpy2_u8_i16_simd_intrinsics_avx512_vnni(const std::uint8_t* a_0, const std::uint8_t* a_1, const std::int16_t x_0, const std::int16_t x_1, std::int32_t* y, const std::size_t n)
+        {
+            constexpr std::size_t chunk_size = 16;
+            const std::size_t n_simd = (n / chunk_size) * chunk_size;
+
+            // pairs (x_0, x_1) match the interleaved pairs (a_0[j], a_1[j])
+            const __m512i v_x = _mm512_set1_epi32(static_cast<std::int32_t>((static_cast<std::uint32_t>(static_cast<std::uint16_t>(x_1)) << 16) | static_cast<std::uint16_t>(x_0)));
+            for (std::size_t j = 0; j < n_simd; j += chunk_size)
+            {
+                const __m128i v_a_0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&a_0[j]));
+                const __m128i v_a_1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&a_1[j]));
+                const __m256i v_a_01 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi8(v_a_0, v_a_1)), _mm_unpackhi_epi8(v_a_0, v_a_1), 1);
+                const __m512i v_y = _mm512_loadu_si512(reinterpret_cast<const void*>(&y[j]));
+                _mm512_storeu_si512(reinterpret_cast<void*>(&y[j]), _mm512_dpwssd_epi32(v_y, _mm512_cvtepu8_epi16(v_a_01), v_x));
+            }
+
+            for (std::size_t j = n_simd; j < n; ++j)
+            {
+                y[j] += static_cast<std::int32_t>(a_0[j]) * x_0 + static_cast<std::int32_t>(a_1[j]) * x_1;
+            }
+        }
+    #endif
+    }
+#endif
+
     namespace blas
     {
         using FP_NAMESPACE::internal::alignment;
 
+    #if defined(FP_INTEGER_GEMV_QUANTIZED) && defined(FP_SIMD_AVX2)
+        //! \brief General matrix vector multiplication with 8-bit integer matrix and quantized floating point vectors
+        //!
+        //! The vector 'x' is quantized chunk-wise to 16-bit integers, each chunk with its own scaling factor.
+        //! The matrix vector multiplication then uses integer multiply-add operations with 32-bit accumulation,
+        //! and the result is converted back to floating point once per chunk.
+        //! There is no 'alpha' and 'beta' parameters: they are 1.0 and 0.0 implicitly!
+        //!
+        //! \tparam T floating point input and output type of vectors 'x' and 'y'
+        //! \param layout row or column major order
+        //! \param transpose transpose matrix 'a'
+        //! \param m number of rows of matrix 'a'
+        //! \param n number of columns of matrix 'a'
+        //! \param a matrix
+        //! \param x input vector
+        //! \param y output vector
+        template <typename T>
+        static void gemv_quantized(const matrix_layout layout, const bool transpose, const std::size_t m, const std::size_t n, const std::uint8_t* a, const T* x, T* y)
+        {
+            constexpr T f_0 = static_cast<T>(0.0);
+            constexpr std::size_t chunk_size = internal::quantization_chunk_size;
+
+        #if defined(FP_SIMD_AVX512_VNNI)
+            const bool use_vnni = internal::use_simd_isa(simd_isa::avx512_vnni);
+        #endif
+
+            // matrix extent
+            const std::size_t M = (transpose ? m : n);
+            const std::size_t N = (transpose ? n : m);
+
+            // set the output vector to zero: we will accumulate on it
+            for (std::size_t j = 0; j < N; ++j)
+            {
+                y[j] = f_0;
+            }
+
+            alignas(alignment) std::int16_t buffer_x[chunk_size];
+
+            if ((transpose && layout == matrix_layout::rowmajor) ||
+                (!transpose && layout == matrix_layout::colmajor))
+            {
+                internal::scratch_buffer<std::int32_t> buffer_y(N);
+                for (std::size_t i = 0; i < M; i += chunk_size)
+                {
+                    const std::size_t ii_max = std::min(M - i, chunk_size);
+                    const T scale = internal::quantize(&x[i], &buffer_x[0], ii_max);
+                    if (scale == f_0) continue;
+
+                    for (std::size_t j = 0; j < N; ++j)
+                    {
+                        buffer_y[j] = 0;
+                    }
+
+                    // process two rows at a time: multiply-add operates on pairs of 16-bit integers
+                    for (std::size_t ii = 0; ii < ii_max; ii += 2)
+                    {
+                        const std::uint8_t* a_0 = &a[(i + ii) * N];
+                        const std::uint8_t* a_1 = ((ii + 1) < ii_max ? &a_0[N] : a_0);
+                        const std::int16_t x_1 = ((ii + 1) < ii_max ? buffer_x[ii + 1] : 0);
+                    #if defined(FP_SIMD_AVX512_VNNI)
+                        if (use_vnni)
+                        {
+                            internal::axpy2_u8_i16_simd_intrinsics_avx512_vnni(a_0, a_1, buffer_x[ii], x_1, &buffer_y[0], N);
+                        }
+                        else
+                    #endif
+                        {
+                            internal::axpy2_u8_i16_simd_intrinsics(a_0, a_1, buffer_x[ii], x_1, &buffer_y[0], N);
+                        }
+                    }
+
+                    for (std::size_t j = 0; j < N; ++j)
+                    {
+                        y[j] += scale * buffer_y[j];
+                    }
+                }
+            }
+            else
+            {
+                // dot products: the horizontal reductions dominate for short rows, so that AVX2 is used throughout
+                alignas(alignment) std::int32_t buffer_y[4];
+                for (std::size_t i = 0; i < M; i += chunk_size)
+                {
+                    const std::size_t ii_max = std::min(M - i, chunk_size);
+                    const T scale = internal::quantize(&x[i], &buffer_x[0], ii_max);
+                    if (scale == f_0) continue;
+
+                    if (N < 4)
+                    {
+                        // too few rows: process each of them separately
+                        for (std::size_t j = 0; j < N; ++j)
+                        {
+                            internal::dot4_u8_i16_simd_intrinsics(&a[j * M + i], 0, &buffer_x[0], &buffer_y[0], ii_max);
+                            y[j] += scale * buffer_y[0];
+                        }
+                        continue;
+                    }
+
+                    for (std::size_t j = 0; j < N; j += 4)
+                    {
+                        // the last rows are processed together with some of the previous ones, which are then skipped
+                        const std::size_t j_start = std::min(j, N - 4);
+                        internal::dot4_u8_i16_simd_intrinsics(&a[j_start * M + i], M, &buffer_x[0], &buffer_y[0], ii_max);
+                        for (std::size_t jj = (j - j_start); jj < 4; ++jj)
+                        {
+                            y[j_start + jj] += scale * buffer_y[jj];
+                        }
+                    }
+                }
+            }
+        }
+    #endif
+
         //! \brief General matrix vector multiplication with integer matrix and floating point vectors
         //!
         //! The integer matrix 'a' is assumed to be either of 8 or 16-bit integer type.
@@ -34,7 +308,7 @@ namespace FP_NAMESPACE
         //! \param a matrix
         //! \param x input vector
         //! \param y output vector
-        template <typename T_1, typename T_2, typename X = typename std::enable_if<!(std::is_integral<T_1>::value && std::is_floating_point<T_2>::value)>::type>
+        template <typename T_1, typename T_2, typename X = typename std::enable_if<!((std::is_integral<T_1>::value || std::is_same<T_1, uint4x2_t>::value) && std::is_floating_point<T_2>::value)>::type>
         static void gemv(const matrix_layout layout, const bool transpose, const std::size_t m, const std::size_t n, const T_1* a, const T_2* x, T_2* y, const X* dummy = nullptr);
 
         template <typename T_1, typename T_2, typename X = typename std::enable_if<std::is_integral<T_1>::value && std::is_floating_point<T_2>::value>::type>
@@ -47,6 +321,15 @@ namespace FP_NAMESPACE
 
             if (m == 0 || n == 0) return;
 
+        #if defined(FP_INTEGER_GEMV_QUANTIZED) && defined(FP_SIMD_AVX2)
+            // 8-bit integer matrix: quantize 'x' and use integer multiply-add operations
+            if (std::is_same<T_1, std::uint8_t>::value && internal::use_simd_isa(simd_isa::avx2))
+            {
+                gemv_quantized(layout, transpose, m, n, reinterpret_cast<const std::uint8_t*>(a), x, y);
+                return;
+            }
+        #endif
+
             if ((transpose && layout == matrix_layout::rowmajor) ||
                 (!transpose && layout == matrix_layout::colmajor))
             {
@@ -60,10 +343,10 @@ namespace FP_NAMESPACE
                     y[j] = f_0;
                 }
 
-            #if defined(__AVX2__) || defined(__AVX512F__)
+            #if defined(FP_SIMD_AVX2)
                 // use SIMD intrinsics only if the input matrix is of 8-bit integer type
                 constexpr bool use_simd_intrinsics = std::is_same<T_1, std::uint8_t>::value;
-                if (use_simd_intrinsics)
+                if (use_simd_intrinsics && internal::use_simd_isa(simd_isa::avx2))
                 {
                     // 32 8-bit integers fit into one AVX2 register
                     constexpr std::size_t chunk_size = 32;
@@ -74,7 +357,7 @@ namespace FP_NAMESPACE
                     {
                         // determine the number of rows to be loaded
                         const std::size_t inc_i = (chunks * chunk_size + (N - 1)) / N;
-                        alignas(alignment) std::int16_t buffer_a[inc_i * N];
+                        internal::scratch_buffer<std::int16_t> buffer_a(inc_i * N);
                         // matrix vector multiplication on the current block
                         for (std::size_t i = 0; i < M; i += inc_i)
                         {
@@ -94,7 +377,7 @@ namespace FP_NAMESPACE
                     }
                     else
                     {
-                        alignas(alignment) std::int16_t buffer_a[N];
+                        internal::scratch_buffer<std::int16_t> buffer_a(N);
                         // matrix vector multiplication on the current block
                         for (std::size_t i = 0; i < M; ++i)
                         {
@@ -133,9 +416,9 @@ namespace FP_NAMESPACE
                     y[j] = f_0;
                 }
 
-            #if defined(__AVX2__) || defined(__AVX512F__)
+            #if defined(FP_SIMD_AVX2)
                 constexpr bool use_simd_intrinsics = std::is_same<T_1, std::uint8_t>::value;
-                if (use_simd_intrinsics)
+                if (use_simd_intrinsics && internal::use_simd_isa(simd_isa::avx2))
                 {
                     // 32 8-bit integers fit into one AVX2 register
                     constexpr std::size_t chunk_size = 32;
@@ -146,7 +429,7 @@ namespace FP_NAMESPACE
                     {
                         // determine the number of rows to be loaded
                         const std::size_t inc_j = (chunks * chunk_size + (M - 1)) / M;
-                        alignas(alignment) std::int16_t buffer_a[inc_j * M];
+                        internal::scratch_buffer<std::int16_t> buffer_a(inc_j * M);
                         // matrix vector multiplication on the current block
                         for (std::size_t j = 0; j < N; j += inc_j)
                         {
@@ -168,7 +451,7 @@ namespace FP_NAMESPACE
                     }
                     else
                     {
-                        alignas(alignment) std::int16_t buffer_a[M];
+                        internal::scratch_buffer<std::int16_t> buffer_a(M);
                         // matrix vector multiplication on the current block
                         for (std::size_t j = 0; j < N; ++j)
                         {
@@ -200,7 +483,102 @@ namespace FP_NAMESPACE
                 }
             }
         }
-        
+
+        //! \brief General matrix vector multiplication with 4-bit integer matrix and floating point vectors
+        //!
+        //! The matrix is unpacked into 8-bit integers, which are then processed as above.
+        //!
+        //! \tparam T floating point input and output type of vectors 'x' and 'y'
+        //! \param layout row or column major order
+        //! \param transpose transpose matrix 'a'
+        //! \param m number of rows of matrix 'a'
+        //! \param n number of columns of matrix 'a'
+        //! \param a matrix
+        //! \param x input vector
+        //! \param y output vector
+        template <typename T>
+        static void gemv(const matrix_layout layout, const bool transpose, const std::size_t m, const std::size_t n, const uint4x2_t* a, const T* x, T* y)
+        {
+            if (m == 0 || n == 0) return;
+
+            // the 8-bit SIMD recoding reads beyond the end of the matrix: padding
+            internal::scratch_buffer<std::uint8_t> buffer_a(m * n + 32);
+            internal::unpack_uint4_kernel(a, &buffer_a[0], m * n);
+
+            gemv(layout, transpose, m, n, &buffer_a[0], x, y);
+        }
+
+        //! \brief General matrix multi-vector multiplication with integer matrix and floating point vectors
+        //!
+        //! The integer matrix 'a' is converted once and then applied to all 'k' vectors using a BLAS gemm call.
+        //! The vectors are stored one after another with leading dimensions 'ldx' and 'ldy'.
+        //! Other than for the cblas_*gemm call, there is no 'alpha' and 'beta' parameters:
+        //! they are 1.0 and 0.0 implicitly!
+        //!
+        //! \tparam T_1 integer input type of matrix 'a'
+        //! \tparam T_2 floating point input and output type of vectors 'x' and 'y'
+        //! \param layout row or column major order
+        //! \param transpose transpose matrix 'a'
+        //! \param m number of rows of matrix 'a'
+        //! \param n number of columns of matrix 'a'
+        //! \param k number of vectors
+        //! \param a matrix
+        //! \param x input vectors
+        //! \param ldx leading dimension of 'x'
+        //! \param y output vectors
+        //! \param ldy leading dimension of 'y'
+        template <typename T_1, typename T_2, typename X = typename std::enable_if<!((std::is_integral<T_1>::value || std::is_same<T_1, uint4x2_t>::value) && std::is_floating_point<T_2>::value)>::type>
+        static void gemm(const matrix_layout layout, const bool transpose, const std::size_t m, const std::size_t n, const std::size_t k, const T_1* a, const T_2* x, const std::size_t ldx, T_2* y, const std::size_t ldy, const X* dummy = nullptr);
+
+        template <typename T_1, typename T_2, typename X = typename std::enable_if<std::is_integral<T_1>::value && std::is_floating_point<T_2>::value>::type>
+        static void gemm(const matrix_layout layout, const bool transpose, const std::size_t m, const std::size_t n, const std::size_t k, const T_1* a, const T_2* x, const std::size_t ldx, T_2* y, const std::size_t ldy)
+        {
+            static_assert(std::is_integral<T_1>::value && (8 * sizeof(T_1) <= 16) && std::is_floating_point<T_2>::value, "error: only integer matrix and floating point vectors are allowed");
+
+            constexpr T_2 f_0 = static_cast<T_2>(0.0);
+            constexpr T_2 f_1 = static_cast<T_2>(1.0);
+
+            if (m == 0 || n == 0 || k == 0) return;
+
+            // convert the matrix: integers with up to 16 bits are represented exactly
+            internal::scratch_buffer<T_2> buffer_a(m * n);
+            for (std::size_t i = 0; i < (m * n); ++i)
+            {
+                buffer_a[i] = a[i];
+            }
+
+            // the vectors are stored column major: a row major matrix is the transpose of a column major matrix
+            const bool transpose_colmajor = (layout == matrix_layout::rowmajor ? !transpose : transpose);
+            const std::size_t lda = (layout == matrix_layout::rowmajor ? n : m);
+            gemm(CblasColMajor, (transpose_colmajor ? CblasTrans : CblasNoTrans), CblasNoTrans, (transpose ? n : m), k, (transpose ? m : n), f_1, &buffer_a[0], lda, x, ldx, f_0, y, ldy);
+        }
+
+        //! \brief General matrix multi-vector multiplication with 4-bit integer matrix and floating point vectors
+        //!
+        //! The matrix is unpacked into 8-bit integers, which are then processed as above.
+        //!
+        //! \tparam T floating point input and output type of vectors 'x' and 'y'
+        //! \param layout row or column major order
+        //! \param transpose transpose matrix 'a'
+        //! \param m number of rows of matrix 'a'
+        //! \param n number of columns of matrix 'a'
+        //! \param k number of vectors
+        //! \param a matrix
+        //! \param x input vectors
+        //! \param ldx leading dimension of 'x'
+        //! \param y output vectors
+        //! \param ldy leading dimension of 'y'
+        template <typename T>
+        static void gemm(const matrix_layout layout, const bool transpose, const std::size_t m, const std::size_t n, const std::size_t k, const uint4x2_t* a, const T* x, const std::size_t ldx, T* y, const std::size_t ldy)
+        {
+            if (m == 0 || n == 0 || k == 0) return;
+
+            internal::scratch_buffer<std::uint8_t> buffer_a(m * n);
+            internal::unpack_uint4_kernel(a, &buffer_a[0], m * n);
+
+            gemm(layout, transpose, m, n, k, &buffer_a[0], x, ldx, y, ldy);
+        }
+
         //! \brief General matrix vector multiplication with integer matrix and floating point vectors
         //!
         //! This matrix applies matrix 'a' to 'x_1' and T('a') to 'x_2' and writes the output to 'y_1' and 'y_2'.
@@ -220,7 +598,7 @@ namespace FP_NAMESPACE
         //! \param y_1 output vector 1
         //! \param x_2 input vector 2
         //! \param y_2 output vector 2
-        template <typename T_1, typename T_2, typename X = typename std::enable_if<!(std::is_integral<T_1>::value && std::is_floating_point<T_2>::value)>::type>
+        template <typename T_1, typename T_2, typename X = typename std::enable_if<!((std::is_integral<T_1>::value || std::is_same<T_1, uint4x2_t>::value) && std::is_floating_point<T_2>::value)>::type>
         static void gem2v(const matrix_layout layout, const std::size_t m, const std::size_t n, const T_1* a, const T_2* x_1, T_2* y_1, const T_2* x_2, T_2* y_2, const X* dummy = nullptr);
 
         template <typename T_1, typename T_2, typename X = typename std::enable_if<std::is_integral<T_1>::value && std::is_floating_point<T_2>::value>::type>
@@ -254,10 +632,10 @@ namespace FP_NAMESPACE
                 ptr_y_2[j] = f_0;
             }
 
-        #if defined(__AVX2__) || defined(__AVX512F__)
+        #if defined(FP_SIMD_AVX2)
             // use SIMD intrinsics only if the input matrix is of 8-bit integer type
             constexpr bool use_simd_intrinsics = std::is_same<T_1, std::uint8_t>::value;
-            if (use_simd_intrinsics)
+            if (use_simd_intrinsics && internal::use_simd_isa(simd_isa::avx2))
             {
                 // 32 8-bit integers fit into one AVX2 register
                 constexpr std::size_t chunk_size = 32;
@@ -268,7 +646,7 @@ namespace FP_NAMESPACE
                 {
                     // determine the number of rows to be loaded
                     const std::size_t inc_j = (chunks * chunk_size + (M - 1)) / M;
-                    alignas(alignment) std::int16_t buffer_a[inc_j * M];
+                    internal::scratch_buffer<std::int16_t> buffer_a(inc_j * M);
                     // matrix vector multiplication on the current block
                     for (std::size_t j = 0; j < N; j += inc_j)
                     {
@@ -292,7 +670,7 @@ namespace FP_NAMESPACE
                 }
                 else
                 {
-                    alignas(alignment) std::int16_t buffer_a[M];
+                    internal::scratch_buffer<std::int16_t> buffer_a(M);
                     // matrix vector multiplication on the current block
                     for (std::size_t j = 0; j < N; ++j)
                     {
@@ -328,6 +706,32 @@ namespace FP_NAMESPACE
                 }
             }
         }
+
+        //! \brief General matrix vector multiplication with 4-bit integer matrix and floating point vectors
+        //!
+        //! This matrix applies matrix 'a' to 'x_1' and T('a') to 'x_2' and writes the output to 'y_1' and 'y_2'.
+        //! The matrix is unpacked into 8-bit integers, which are then processed as above.
+        //!
+        //! \tparam T floating point input and output type of vectors 'x' and 'y'
+        //! \param layout row or column major order
+        //! \param m number of rows of matrix 'a'
+        //! \param n number of columns of matrix 'a'
+        //! \param a matrix
+        //! \param x_1 input vector 1
+        //! \param y_1 output vector 1
+        //! \param x_2 input vector 2
+        //! \param y_2 output vector 2
+        template <typename T>
+        static void gem2v(const matrix_layout layout, const std::size_t m, const std::size_t n, const uint4x2_t* a, const T* x_1, T* y_1, const T* x_2, T* y_2)
+        {
+            if (m == 0 || n == 0) return;
+
+            // the 8-bit SIMD recoding reads beyond the end of the matrix: padding
+            internal::scratch_buffer<std::uint8_t> buffer_a(m * n + 32);
+            internal::unpack_uint4_kernel(a, &buffer_a[0], m * n);
+
+            gem2v(layout, m, n, &buffer_a[0], x_1, y_1, x_2, y_2);
+        }
     }
 }
 
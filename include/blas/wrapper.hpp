@@ -42,6 +42,31 @@ namespace FP_NAMESPACE
             cblas_sgemv(__Order, __TransA, __M, __N, __alpha, __A, __lda, __X, __incX, __beta, __Y, __incY);
         }
 
+        // BLAS call wrapper: matrix matrix multiply
+        template <typename T>
+        static void gemm(const CBLAS_LAYOUT __Order, const CBLAS_TRANSPOSE __TransA, const CBLAS_TRANSPOSE __TransB,
+            const std::size_t __M, const std::size_t __N, const std::size_t __K, const T __alpha, const T* __A, const std::size_t __lda,
+            const T* __B, const std::size_t __ldb,
+            const T __beta, T* __C, const std::size_t __ldc);
+
+        template <>
+        inline void gemm<double>(const CBLAS_LAYOUT __Order, const CBLAS_TRANSPOSE __TransA, const CBLAS_TRANSPOSE __TransB,
+            const std::size_t __M, const std::size_t __N, const std::size_t __K, const double __alpha, const double* __A, const std::size_t __lda,
+            const double* __B, const std::size_t __ldb,
+            const double __beta, double* __C, const std::size_t __ldc)
+        {
+            cblas_dgemm(__Order, __TransA, __TransB, __M, __N, __K, __alpha, __A, __lda, __B, __ldb, __beta, __C, __ldc);
+        }
+
+        template <>
+        inline void gemm<float>(const CBLAS_LAYOUT __Order, const CBLAS_TRANSPOSE __TransA, const CBLAS_TRANSPOSE __TransB,
+            const std::size_t __M, const std::size_t __N, const std::size_t __K, const float __alpha, const float* __A, const std::size_t __lda,
+            const float* __B, const std::size_t __ldb,
+            const float __beta, float* __C, const std::size_t __ldc)
+        {
+            cblas_sgemm(__Order, __TransA, __TransB, __M, __N, __K, __alpha, __A, __lda, __B, __ldb, __beta, __C, __ldc);
+        }
+
         // BLAS call wrapper: triangular packed matrix vector multiply
         template <typename T>
         static void tpmv(const CBLAS_LAYOUT __Order, const CBLAS_UPLO __Uplo, const CBLAS_TRANSPOSE __TransA, const CBLAS_DIAG __Diag,
@@ -104,6 +129,47 @@ namespace FP_NAMESPACE
         {
             cblas_stpsv(__Order, __Uplo, __TransA, __Diag, __N, __Ap, __X, __incX);
         }
+
+        // BLAS call wrapper: triangular solve
+        template <typename T>
+        static void trsv(const CBLAS_LAYOUT __Order, const CBLAS_UPLO __Uplo, const CBLAS_TRANSPOSE __TransA, const CBLAS_DIAG __Diag,
+            const std::size_t __N, const T* __A, const std::size_t __lda, T* __X, const std::size_t __incX);
+
+        template <>
+        inline void trsv<double>(const CBLAS_LAYOUT __Order, const CBLAS_UPLO __Uplo, const CBLAS_TRANSPOSE __TransA, const CBLAS_DIAG __Diag,
+            const std::size_t __N, const double* __A, const std::size_t __lda, double* __X, const std::size_t __incX)
+        {
+            cblas_dtrsv(__Order, __Uplo, __TransA, __Diag, __N, __A, __lda, __X, __incX);
+        }
+
+        template <>
+        inline void trsv<float>(const CBLAS_LAYOUT __Order, const CBLAS_UPLO __Uplo, const CBLAS_TRANSPOSE __TransA, const CBLAS_DIAG __Diag,
+            const std::size_t __N, const float* __A, const std::size_t __lda, float* __X, const std::size_t __incX)
+        {
+            cblas_strsv(__Order, __Uplo, __TransA, __Diag, __N, __A, __lda, __X, __incX);
+        }
+
+        // BLAS call wrapper: triangular matrix solve (multiple right hand sides)
+        template <typename T>
+        static void trsm(const CBLAS_LAYOUT __Order, const CBLAS_SIDE __Side, const CBLAS_UPLO __Uplo, const CBLAS_TRANSPOSE __TransA, const CBLAS_DIAG __Diag,
+            const std::size_t __M, const std::size_t __N, const T __alpha, const T* __A, const std::size_t __lda,
+            T* __B, const std::size_t __ldb);
+
+        template <>
+        inline void trsm<double>(const CBLAS_LAYOUT __Order, const CBLAS_SIDE __Side, const CBLAS_UPLO __Uplo, const CBLAS_TRANSPOSE __TransA, const CBLAS_DIAG __Diag,
+            const std::size_t __M, const std::size_t __N, const double __alpha, const double* __A, const std::size_t __lda,
+            double* __B, const std::size_t __ldb)
+        {
+            cblas_dtrsm(__Order, __Side, __Uplo, __TransA, __Diag, __M, __N, __alpha, __A, __lda, __B, __ldb);
+        }
+
+        template <>
+        inline void trsm<float>(const CBLAS_LAYOUT __Order, const CBLAS_SIDE __Side, const CBLAS_UPLO __Uplo, const CBLAS_TRANSPOSE __TransA, const CBLAS_DIAG __Diag,
+            const std::size_t __M, const std::size_t __N, const float __alpha, const float* __A, const std::size_t __lda,
+            float* __B, const std::size_t __ldb)
+        {
+            cblas_strsm(__Order, __Side, __Uplo, __TransA, __Diag, __M, __N, __alpha, __A, __lda, __B, __ldb);
+        }
     }
 }
 
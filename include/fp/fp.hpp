@@ -7,12 +7,63 @@
 #define FP_HPP
 
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <cmath>
 #include <limits>
 #include <type_traits>
+#include <algorithm>
+#include <new>
+#include <vector>
 #include <assert.h>
 #include <immintrin.h>
+#include <iostream>
+
+#if defined(FP_SCRATCH_HUGE_PAGES)
+#include <sys/mman.h>
+#endif
+
+// SIMD kernels: AVX2 and AVX-512 code paths
+//
+// By default, the code paths are compiled according to the compiler flags ('-mavx2', '-mavx512f').
+// With FP_SIMD_DISPATCH, all of them are compiled independently of the compiler flags (function attributes),
+// and the best one for the CPU is selected at first use (see 'internal::get_simd_isa').
+#if defined(FP_SIMD_DISPATCH) && !(defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+    #error "FP_SIMD_DISPATCH requires a GNU compatible compiler and an x86 target"
+#endif
+
+#if defined(FP_SIMD_DISPATCH) || defined(__AVX2__) || defined(__AVX512F__)
+    #define FP_SIMD_AVX2
+#endif
+
+#if defined(FP_SIMD_DISPATCH) || defined(__AVX512F__)
+    #define FP_SIMD_AVX512
+#endif
+
+// conversion between IEEE754 half and single precision (all AVX2 capable CPUs support F16C)
+#if defined(FP_SIMD_DISPATCH) || (defined(FP_SIMD_AVX2) && defined(__F16C__))
+    #define FP_SIMD_F16C
+#endif
+
+#if defined(FP_SIMD_DISPATCH) || (defined(__AVX512VNNI__) && defined(__AVX512BW__))
+    #define FP_SIMD_AVX512_VNNI
+#endif
+
+#if defined(FP_SIMD_DISPATCH) || (defined(FP_SIMD_AVX512_VNNI) && defined(__AVX512BF16__))
+    #define FP_SIMD_AVX512_BF16
+#endif
+
+#if defined(FP_SIMD_DISPATCH)
+    #define FP_TARGET_AVX2 __attribute__((target("avx2,fma,f16c")))
+    #define FP_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+    #define FP_TARGET_AVX512_VNNI __attribute__((target("avx512vnni,avx512bw,avx512f,avx2,fma")))
+    #define FP_TARGET_AVX512_BF16 __attribute__((target("avx512bf16,avx512vnni,avx512bw,avx512f,avx2,fma")))
+#else
+    #define FP_TARGET_AVX2
+    #define FP_TARGET_AVX512
+    #define FP_TARGET_AVX512_VNNI
+    #define FP_TARGET_AVX512_BF16
+#endif
 
 #if !defined(FP_NAMESPACE)
     #define FP_NAMESPACE fw 
@@ -20,14 +71,303 @@
 
 namespace FP_NAMESPACE
 {
+    //! SIMD instruction set extensions used by the kernels
+    enum class simd_isa { none = 0, avx2 = 1, avx512 = 2, avx512_vnni = 3, avx512_bf16 = 4 };
+
+    //! Two 4-bit unsigned integers packed into one byte: the first one is in the lower half
+    struct uint4x2_t
+    {
+        std::uint8_t value;
+    };
+
+    //! \brief Parameter 'BE' of the block floating point formats
+    //!
+    //! Groups of 'group_size' consecutive numbers share an 8-bit exponent, and each number has a (1 + 'BM')-bit integer mantissa,
+    //! e.g. fp_stream<7, block_exponent(16)> uses 8.5 bits per number.
+    //!
+    //! \param group_size number of numbers sharing an exponent
+    //! \return parameter 'BE'
+    constexpr std::uint32_t block_exponent(const std::uint32_t group_size)
+    {
+        return 0x100U | group_size;
+    }
+
+    //! \brief Parameter 'BE' of the bit-packed floating point formats with lane-interleaved layout
+    //!
+    //! Same compression as fp_stream<BM, be>, but the compressed numbers are distributed over 8 lanes of 32-bit words:
+    //! the i-th number of each group of 8 consecutive numbers goes to lane i, and within each lane the numbers are
+    //! packed contiguously. 8 numbers are then extracted with the same shift count for all lanes.
+    //!
+    //! \param be bits exponent
+    //! \return parameter 'BE'
+    constexpr std::uint32_t lane_interleaved(const std::uint32_t be)
+    {
+        return 0x200U | be;
+    }
+
     namespace internal
     {
-    #if defined(__AVX512F__)
+    #if defined(FP_SIMD_AVX512)
         constexpr std::size_t alignment = 64;
     #else
         constexpr std::size_t alignment = 32;
     #endif
 
+        //! \brief Per-thread scratch memory for the work buffers of the kernels
+        //!
+        //! Work buffers are taken from a thread local arena instead of the stack: their size is not limited by the
+        //! (OpenMP worker thread) stack size, and no memory allocation happens once the largest working set has been seen.
+        //! Memory is handed out in LIFO order (see 'scratch_buffer'). The arena grows by adding chunks, so that memory
+        //! handed out before stays valid. Chunks are kept until the thread terminates.
+        //!
+        //! With FP_SCRATCH_HUGE_PAGES, chunks are 2 MiB aligned and advised to be backed by transparent huge pages.
+        class scratch_arena
+        {
+            struct chunk
+            {
+                std::uint8_t* data;
+                std::size_t size;
+            };
+
+        #if defined(FP_SCRATCH_HUGE_PAGES)
+            static constexpr std::size_t chunk_alignment = (2UL << 20);
+            static constexpr std::size_t min_chunk_size = (2UL << 20);
+        #else
+            static constexpr std::size_t chunk_alignment = alignment;
+            static constexpr std::size_t min_chunk_size = (256UL << 10);
+        #endif
+
+            std::vector<chunk> chunks;
+            std::size_t current = 0;
+            std::size_t top = 0;
+
+            scratch_arena() = default;
+
+        public:
+            //! \brief Position in the arena to go back to
+            struct marker
+            {
+                std::size_t chunk;
+                std::size_t top;
+            };
+
+            scratch_arena(const scratch_arena&) = delete;
+            scratch_arena& operator=(const scratch_arena&) = delete;
+
+            ~scratch_arena()
+            {
+                for (auto& c : chunks)
+                {
+                    std::free(c.data);
+                }
+            }
+
+            //! \brief Get the arena of the calling thread
+            //!
+            //! \return arena
+            static scratch_arena& get()
+            {
+                static thread_local scratch_arena arena;
+                return arena;
+            }
+
+            //! \brief Get the current position in the arena
+            //!
+            //! \return marker
+            marker get_marker() const
+            {
+                return {current, top};
+            }
+
+            //! \brief Release all memory handed out after the marker has been taken
+            //!
+            //! \param m marker
+            void release(const marker& m)
+            {
+                current = m.chunk;
+                top = m.top;
+            }
+
+            //! \brief Get memory
+            //!
+            //! \param bytes number of bytes
+            //! \return pointer to 'alignment' aligned memory
+            void* allocate(std::size_t bytes)
+            {
+                bytes = ((bytes + alignment - 1) / alignment) * alignment;
+
+                // use the chunks that are already there
+                while (current < chunks.size())
+                {
+                    if ((top + bytes) <= chunks[current].size)
+                    {
+                        void* ptr = &chunks[current].data[top];
+                        top += bytes;
+                        return ptr;
+                    }
+
+                    ++current;
+                    top = 0;
+                }
+
+                // add a chunk that is at least twice as large as the last one
+                std::size_t size = (chunks.empty() ? min_chunk_size : 2 * chunks.back().size);
+                size = ((std::max(size, bytes) + chunk_alignment - 1) / chunk_alignment) * chunk_alignment;
+
+                void* ptr = nullptr;
+                if (posix_memalign(&ptr, chunk_alignment, size) != 0)
+                {
+                    std::cerr << "error: scratch_arena::allocate: cannot allocate " << size << " bytes" << std::endl;
+                    throw std::bad_alloc();
+                }
+            #if defined(FP_SCRATCH_HUGE_PAGES) && defined(MADV_HUGEPAGE)
+                madvise(ptr, size, MADV_HUGEPAGE);
+            #endif
+
+                chunks.push_back({static_cast<std::uint8_t*>(ptr), size});
+                current = chunks.size() - 1;
+                top = bytes;
+
+                return ptr;
+            }
+        };
+
+        //! \brief Work buffer taken from the scratch arena of the calling thread
+        //!
+        //! Drop-in replacement for a local array: the memory goes back to the arena when the buffer goes out of scope.
+        //! Buffers must be destroyed in reverse order of their creation, which is what block scoping does.
+        //!
+        //! \tparam T data type
+        template <typename T>
+        class scratch_buffer
+        {
+            static_assert(std::is_trivial<T>::value, "error: only trivial types are supported");
+
+            scratch_arena& arena;
+            const scratch_arena::marker m;
+            T* const ptr;
+
+        public:
+            scratch_buffer(const std::size_t n)
+                :
+                arena(scratch_arena::get()),
+                m(arena.get_marker()),
+                ptr(static_cast<T*>(arena.allocate(n * sizeof(T))))
+            {}
+
+            scratch_buffer(const scratch_buffer&) = delete;
+            scratch_buffer& operator=(const scratch_buffer&) = delete;
+
+            ~scratch_buffer()
+            {
+                arena.release(m);
+            }
+
+            //! \brief The buffer can be used like an array
+            operator T*() const
+            {
+                return ptr;
+            }
+        };
+
+        //! \brief Detect the SIMD instruction set extensions supported by both the CPU and the compiled code
+        //!
+        //! The environment variable FP_SIMD_ISA (any of "none", "avx2", "avx512", "avx512_vnni", "avx512_bf16") can be used to lower the result,
+        //! e.g. to compare the different code paths within one binary.
+        //!
+        //! \return SIMD instruction set extensions
+        static simd_isa detect_simd_isa()
+        {
+            simd_isa isa = simd_isa::none;
+
+        #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            __builtin_cpu_init();
+        #if defined(FP_SIMD_AVX2)
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c"))
+            {
+                isa = simd_isa::avx2;
+            }
+        #endif
+        #if defined(FP_SIMD_AVX512)
+            if (isa == simd_isa::avx2 && __builtin_cpu_supports("avx512f"))
+            {
+                isa = simd_isa::avx512;
+            }
+        #endif
+        #if defined(FP_SIMD_AVX512_VNNI)
+            if (isa == simd_isa::avx512 && __builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("avx512bw"))
+            {
+                isa = simd_isa::avx512_vnni;
+            }
+        #endif
+        #if defined(FP_SIMD_AVX512_BF16)
+            if (isa == simd_isa::avx512_vnni && __builtin_cpu_supports("avx512bf16"))
+            {
+                isa = simd_isa::avx512_bf16;
+            }
+        #endif
+        #else
+            // no runtime detection: rely on the compiler flags
+        #if defined(FP_SIMD_AVX512_BF16)
+            isa = simd_isa::avx512_bf16;
+        #elif defined(FP_SIMD_AVX512_VNNI)
+            isa = simd_isa::avx512_vnni;
+        #elif defined(FP_SIMD_AVX512)
+            isa = simd_isa::avx512;
+        #elif defined(FP_SIMD_AVX2)
+            isa = simd_isa::avx2;
+        #endif
+        #endif
+
+            const char* env = std::getenv("FP_SIMD_ISA");
+            if (env != nullptr)
+            {
+                const char* names[] = {"none", "avx2", "avx512", "avx512_vnni", "avx512_bf16"};
+                std::size_t i_requested = 0;
+                while (i_requested < 5 && std::strcmp(env, names[i_requested]) != 0)
+                {
+                    ++i_requested;
+                }
+
+                const bool known = (i_requested < 5);
+                const simd_isa requested = static_cast<simd_isa>(i_requested);
+                if (!known)
+                {
+                    std::cerr << "warning: FP_SIMD_ISA=" << env << " is unknown (use none, avx2, avx512, avx512_vnni or avx512_bf16)" << std::endl;
+                }
+                else if (static_cast<int>(requested) > static_cast<int>(isa))
+                {
+                    std::cerr << "warning: FP_SIMD_ISA=" << env << " is not available on this CPU / in this build" << std::endl;
+                }
+                else
+                {
+                    isa = requested;
+                }
+            }
+
+            return isa;
+        }
+
+        //! \brief SIMD instruction set extensions to be used by the kernels
+        //!
+        //! The detection happens once, at first use.
+        //!
+        //! \return SIMD instruction set extensions
+        static inline simd_isa get_simd_isa()
+        {
+            static const simd_isa isa = detect_simd_isa();
+            return isa;
+        }
+
+        //! \brief Test for SIMD instruction set extensions
+        //!
+        //! \param isa SIMD instruction set extensions
+        //! \return true if the kernels for 'isa' can be used
+        static inline bool use_simd_isa(const simd_isa isa)
+        {
+            return static_cast<int>(get_simd_isa()) >= static_cast<int>(isa);
+        }
+
         //! \brief Get maximum
         //!
         //! \tparam T data type
@@ -69,7 +409,7 @@ namespace FP_NAMESPACE
                 return f_0;
             }
 
-            T maximum = in[0];
+            T maximum = std::abs(in[0]);
 
             for (std::size_t i = 0; i < n; ++i)
             {
@@ -121,7 +461,7 @@ namespace FP_NAMESPACE
                 return f_0;
             }
 
-            T minimum = in[0];
+            T minimum = std::abs(in[0]);
 
             for (std::size_t i = 0; i < n; ++i)
             {
@@ -130,6 +470,123 @@ namespace FP_NAMESPACE
 
             return minimum;
         }
+
+        //! \brief Convert IEEE754 single into half precision (round to nearest even)
+        //!
+        //! \param in IEEE754 single precision number
+        //! \return bit pattern of the IEEE754 half precision number
+        static inline std::uint16_t float_to_half(const float in)
+        {
+            std::uint32_t x;
+            std::memcpy(&x, &in, sizeof(float));
+
+            const std::uint32_t sign = (x >> 16) & 0x8000U;
+            const std::uint32_t abs_x = x & 0x7FFFFFFFU;
+
+            if (abs_x >= 0x7F800000U)
+            {
+                // infinity or NaN (quiet, upper bits of the payload are kept)
+                return sign | 0x7C00U | (abs_x > 0x7F800000U ? (0x200U | ((abs_x >> 13) & 0x3FFU)) : 0x0U);
+            }
+            else if (abs_x >= 0x477FF000U)
+            {
+                // overflow: 65520 and larger round to infinity
+                return sign | 0x7C00U;
+            }
+            else if (abs_x >= 0x38800000U)
+            {
+                // normalized half precision number: rebias the exponent and round the mantissa
+                std::uint32_t y = (abs_x - 0x38000000U) >> 13;
+                const std::uint32_t remainder = abs_x & 0x1FFFU;
+                y += ((remainder > 0x1000U || (remainder == 0x1000U && (y & 0x1U))) ? 1 : 0);
+                return sign | y;
+            }
+            else if (abs_x > 0x33000000U)
+            {
+                // denormalized half precision number
+                const std::uint32_t shift = 126 - (abs_x >> 23);
+                const std::uint32_t mantissa = (abs_x & 0x7FFFFFU) | 0x800000U;
+                std::uint32_t y = mantissa >> shift;
+                const std::uint32_t remainder = mantissa & ((0x1U << shift) - 1);
+                const std::uint32_t half = 0x1U << (shift - 1);
+                y += ((remainder > half || (remainder == half && (y & 0x1U))) ? 1 : 0);
+                return sign | y;
+            }
+
+            // underflow
+            return sign;
+        }
+
+        //! \brief Convert IEEE754 half into single precision
+        //!
+        //! \param in bit pattern of the IEEE754 half precision number
+        //! \return IEEE754 single precision number
+        static inline float half_to_float(const std::uint16_t in)
+        {
+            const std::uint32_t sign = static_cast<std::uint32_t>(in & 0x8000U) << 16;
+            const std::uint32_t exponent = (in >> 10) & 0x1FU;
+            const std::uint32_t mantissa = in & 0x3FFU;
+
+            std::uint32_t y;
+            if (exponent == 0)
+            {
+                // zero or denormalized half precision number: m * 2^-24
+                const float tmp = static_cast<float>(mantissa) * 5.9604644775390625E-8F;
+                std::memcpy(&y, &tmp, sizeof(float));
+                y |= sign;
+            }
+            else if (exponent == 0x1FU)
+            {
+                // infinity or NaN (quiet)
+                y = sign | 0x7F800000U | (mantissa != 0 ? (0x400000U | (mantissa << 13)) : 0x0U);
+            }
+            else
+            {
+                y = sign | ((exponent + 112) << 23) | (mantissa << 13);
+            }
+
+            float out;
+            std::memcpy(&out, &y, sizeof(float));
+            return out;
+        }
+
+        //! \brief Convert IEEE754 single into bfloat16 (round to nearest even)
+        //!
+        //! Denormalized numbers become zero (same as the AVX512-BF16 conversion).
+        //!
+        //! \param in IEEE754 single precision number
+        //! \return bit pattern of the bfloat16 number
+        static inline std::uint16_t float_to_bfloat16(const float in)
+        {
+            std::uint32_t x;
+            std::memcpy(&x, &in, sizeof(float));
+
+            if ((x & 0x7FFFFFFFU) > 0x7F800000U)
+            {
+                // NaN (quiet)
+                return (x >> 16) | 0x40U;
+            }
+            else if ((x & 0x7F800000U) == 0)
+            {
+                // zero or denormalized number
+                return (x >> 16) & 0x8000U;
+            }
+
+            return (x + 0x7FFFU + ((x >> 16) & 0x1U)) >> 16;
+        }
+
+        //! \brief Convert bfloat16 into IEEE754 single precision
+        //!
+        //! \param in bit pattern of the bfloat16 number
+        //! \return IEEE754 single precision number
+        static inline float bfloat16_to_float(const std::uint16_t in)
+        {
+            const std::uint32_t y = static_cast<std::uint32_t>(in) << 16;
+
+            float out;
+            std::memcpy(&out, &y, sizeof(float));
+            return out;
+        }
     }
 
     //! \brief Bits IEEE754
@@ -212,6 +669,87 @@ namespace FP_NAMESPACE
             static constexpr bool value = true;
         };
 
+        //! \brief Test for IEEE754 half type
+        //!
+        //! The numbers are stored as a plain stream of half precision words.
+        //! With FP_HALF_BLOCK_SCALING, they are rescaled by a power of 2 and stored together with the scaling factor.
+        //!
+        //! \tparam BM bits mantissa
+        //! \tparam BE bits exponent
+        template <std::uint32_t BM, std::uint32_t BE>
+        struct is_ieee754_half_type
+        {
+            static constexpr bool value = false;
+        };
+
+        template <>
+        struct is_ieee754_half_type<10, 5>
+        {
+            static constexpr bool value = true;
+        };
+
+        //! \brief Test for 8-bit floating point type (E4M3 or E5M2)
+        //!
+        //! The numbers are stored together with a scaling factor (one byte per number).
+        //!
+        //! \tparam BM bits mantissa
+        //! \tparam BE bits exponent
+        template <std::uint32_t BM, std::uint32_t BE>
+        struct is_fp8_type
+        {
+            static constexpr bool value = false;
+        };
+
+        template <>
+        struct is_fp8_type<3, 4>
+        {
+            static constexpr bool value = true;
+        };
+
+        template <>
+        struct is_fp8_type<2, 5>
+        {
+            static constexpr bool value = true;
+        };
+
+        //! \brief Parameters of the 8-bit floating point types
+        //!
+        //! E4M3 has no infinities: the largest number is 448, and 0x7F is NaN.
+        //! E5M2 follows IEEE754: the largest number is 57344, 0x7C is infinity and 0x7D..0x7F are NaNs.
+        //! For all other types, the parameters are valid but not used.
+        //!
+        //! \tparam BM bits mantissa
+        //! \tparam BE bits exponent
+        template <std::uint32_t BM, std::uint32_t BE>
+        struct fp8_traits
+        {
+            static constexpr std::uint32_t bias = 1;
+            static constexpr std::uint32_t max_code = 0x0U;
+            static constexpr std::uint32_t nan_code = 0x0U;
+            static constexpr bool has_infinity = false;
+            static constexpr float max_value = 1.0F;
+        };
+
+        template <>
+        struct fp8_traits<3, 4>
+        {
+            static constexpr std::uint32_t bias = 7;
+            static constexpr std::uint32_t max_code = 0x7EU;
+            static constexpr std::uint32_t nan_code = 0x7FU;
+            static constexpr bool has_infinity = false;
+            static constexpr float max_value = 448.0F;
+        };
+
+        template <>
+        struct fp8_traits<2, 5>
+        {
+            static constexpr std::uint32_t bias = 15;
+            static constexpr std::uint32_t max_code = 0x7BU;
+            static constexpr std::uint32_t nan_code = 0x7EU;
+            static constexpr bool has_infinity = true;
+            static constexpr float max_value = 57344.0F;
+        };
+
         //! \brief Test for fixed point type
         //!
         //! Fixed point only if BE=0 
@@ -229,26 +767,172 @@ namespace FP_NAMESPACE
         {
             static constexpr bool value = true;
         };
-    }
 
-    //! \brief Floating / fixed point data stream
-    //! 
-    //! \tparam BM bits mantissa
-    //! \tparam BE bits exponent
-    template <std::uint32_t BM, std::uint32_t BE = 0>
-    class fp_stream
-    {
-        static constexpr bool is_supported()
+        //! \brief Test for block floating point type
+        //!
+        //! Block floating point only if BE=block_exponent(group size)
+        //!
+        //! \tparam BM bits mantissa
+        //! \tparam BE bits exponent
+        template <std::uint32_t BM, std::uint32_t BE>
+        struct is_block_floating_point_type
         {
-            // which BM and BE parameters are supported?
-            // note: this is just w.r.t. the internal representation!
-            constexpr bool is_supported_ieee754_fp_type = internal::is_ieee754_fp_type<BM, BE>::value;
-            constexpr bool is_supported_floating_point_type = !internal::is_fixed_point_type<BM, BE>::value && BE > 0 && (BM + BE) < 16;
-            constexpr bool is_supported_fixed_point_type = internal::is_fixed_point_type<BM, BE>::value && BM > 0 && BM <= 16;
-            return is_supported_ieee754_fp_type || is_supported_floating_point_type || is_supported_fixed_point_type;
-        }
+            static constexpr bool value = ((BE & 0x100U) != 0);
+            static constexpr std::uint32_t group_size = (BE & 0xFFU);
+        };
 
-        static_assert(is_supported(), "error: unsupported <BM, BE> parameters");
+        //! \brief Test for bit-packed floating point type with lane-interleaved layout
+        //!
+        //! Lane-interleaved layout only if BE=lane_interleaved(bits exponent)
+        //!
+        //! \tparam BM bits mantissa
+        //! \tparam BE bits exponent
+        template <std::uint32_t BM, std::uint32_t BE>
+        struct is_lane_interleaved_type
+        {
+            static constexpr bool value = ((BE & 0x200U) != 0);
+            static constexpr std::uint32_t be = (BE & 0xFFU);
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // HELPER: 8-bit floating point
+    ////////////////////////////////////////////////////////////////////////////////////
+    namespace internal
+    {
+        //! \brief Convert IEEE754 single into 8-bit floating point (round to nearest even)
+        //!
+        //! Numbers beyond the largest finite 8-bit floating point number (including infinities) saturate.
+        //!
+        //! \tparam BM bits mantissa
+        //! \tparam BE bits exponent
+        //! \param in IEEE754 single precision number
+        //! \return bit pattern of the 8-bit floating point number
+        template <std::uint32_t BM, std::uint32_t BE>
+        static inline std::uint8_t float_to_fp8(const float in)
+        {
+            using traits = fp8_traits<BM, BE>;
+            // other formats may instantiate this function without calling it: keep the shift counts valid
+            constexpr std::uint32_t bm = (is_fp8_type<BM, BE>::value ? BM : 3);
+            // smallest normalized number 2^(1 - bias), and the scaling of the denormalized numbers to integers
+            constexpr std::uint32_t min_normal = (128 - traits::bias) << 23;
+            constexpr float scale_denormal = static_cast<float>(0x1U << (traits::bias - 1 + bm));
+
+            std::uint32_t x;
+            std::memcpy(&x, &in, sizeof(float));
+
+            const std::uint32_t sign = (x >> 24) & 0x80U;
+            const std::uint32_t abs_x = x & 0x7FFFFFFFU;
+
+            if (abs_x > 0x7F800000U)
+            {
+                // NaN
+                return sign | traits::nan_code;
+            }
+
+            std::uint32_t y;
+            if (abs_x < min_normal)
+            {
+                // denormalized 8-bit floating point number: the rounding happens in floating point arithmetic
+                float abs_in;
+                std::memcpy(&abs_in, &abs_x, sizeof(float));
+                y = static_cast<std::uint32_t>(std::nearbyint(abs_in * scale_denormal));
+            }
+            else
+            {
+                // normalized 8-bit floating point number: rebias the exponent and round the mantissa
+                const std::uint32_t z = abs_x - ((127 - traits::bias) << 23);
+                y = (z + ((0x1U << (22 - bm)) - 1) + ((z >> (23 - bm)) & 0x1U)) >> (23 - bm);
+            }
+
+            return sign | (y < traits::max_code ? y : traits::max_code);
+        }
+
+        //! \brief Convert 8-bit floating point into IEEE754 single precision
+        //!
+        //! \tparam BM bits mantissa
+        //! \tparam BE bits exponent
+        //! \param in bit pattern of the 8-bit floating point number
+        //! \return IEEE754 single precision number
+        template <std::uint32_t BM, std::uint32_t BE>
+        static inline float fp8_to_float(const std::uint8_t in)
+        {
+            using traits = fp8_traits<BM, BE>;
+            // other formats may instantiate this function without calling it: keep the shift counts valid
+            constexpr std::uint32_t bm = (is_fp8_type<BM, BE>::value ? BM : 3);
+            constexpr std::uint32_t be = (is_fp8_type<BM, BE>::value ? BE : 4);
+
+            const std::int32_t exponent = (in >> bm) & ((0x1U << be) - 1);
+            const std::uint32_t mantissa = in & ((0x1U << bm) - 1);
+
+            float abs_out;
+            if ((in & 0x7FU) > traits::max_code)
+            {
+                // infinity or NaN: same bit pattern as for the conversion from IEEE754 half precision, see 'simd_decoder'
+                const std::uint32_t half = (traits::has_infinity ? ((in & 0x7FU) << 8) : 0x7F80U);
+                const std::uint32_t y = 0x7F800000U | ((half & 0x3FFU) << 13) | ((half & 0x3FFU) != 0 ? 0x400000U : 0x0U);
+                std::memcpy(&abs_out, &y, sizeof(float));
+            }
+            else if (exponent == 0)
+            {
+                abs_out = std::ldexp(static_cast<float>(mantissa), 1 - static_cast<std::int32_t>(traits::bias + bm));
+            }
+            else
+            {
+                abs_out = std::ldexp(static_cast<float>(mantissa + (0x1U << bm)), exponent - static_cast<std::int32_t>(traits::bias + bm));
+            }
+
+            return ((in & 0x80U) ? -abs_out : abs_out);
+        }
+
+        //! \brief Lookup table for the conversion of 8-bit floating point numbers into IEEE754 single precision
+        //!
+        //! \tparam BM bits mantissa
+        //! \tparam BE bits exponent
+        template <std::uint32_t BM, std::uint32_t BE>
+        struct fp8_table
+        {
+            alignas(alignment) float value[256];
+
+            fp8_table()
+            {
+                for (std::uint32_t i = 0; i < 256; ++i)
+                {
+                    value[i] = fp8_to_float<BM, BE>(static_cast<std::uint8_t>(i));
+                }
+            }
+        };
+
+        template <std::uint32_t BM, std::uint32_t BE>
+        static const fp8_table<BM, BE>& get_fp8_table()
+        {
+            static const fp8_table<BM, BE> table;
+            return table;
+        }
+    }
+
+    //! \brief Floating / fixed point data stream
+    //! 
+    //! \tparam BM bits mantissa
+    //! \tparam BE bits exponent
+    template <std::uint32_t BM, std::uint32_t BE = 0, typename Enabled = void>
+    class fp_stream
+    {
+        static constexpr bool is_supported()
+        {
+            // which BM and BE parameters are supported?
+            // note: this is just w.r.t. the internal representation!
+            constexpr bool is_supported_ieee754_fp_type = internal::is_ieee754_fp_type<BM, BE>::value;
+            constexpr bool is_supported_floating_point_type = !internal::is_fixed_point_type<BM, BE>::value && BE > 0 && (BM + BE) < 16;
+            constexpr bool is_supported_fixed_point_type = internal::is_fixed_point_type<BM, BE>::value && BM > 0 && BM <= 16;
+            return is_supported_ieee754_fp_type || is_supported_floating_point_type || is_supported_fixed_point_type;
+        }
+
+        static_assert(is_supported(), "error: unsupported <BM, BE> parameters");
+
+        // the lane-interleaved layout uses the compression of the bit-packed formats
+        template <std::uint32_t, std::uint32_t, typename>
+        friend class fp_stream;
 
         // do not allow instantiation
         fp_stream() { ; }
@@ -261,6 +945,16 @@ namespace FP_NAMESPACE
         static constexpr std::uint32_t be = BE;
         static constexpr std::uint32_t bits = (is_fixed_point_type ? BM : (1 + BM + BE));
 
+        // any other than IEEE754, bfloat16, 8-bit floating point and fixed point: compressed floating point numbers are bit-packed
+        static constexpr bool is_bit_packed_type = !internal::is_ieee754_fp_type<BM, BE>::value && !internal::is_ieee754_half_type<BM, BE>::value && !internal::is_bfloat16_fp_type<BM, BE>::value && !internal::is_fp8_type<BM, BE>::value && !is_fixed_point_type;
+
+        // IEEE754 half precision: the scaling factor is placed in front of the compressed numbers only with FP_HALF_BLOCK_SCALING
+    #if defined(FP_HALF_BLOCK_SCALING)
+        static constexpr bool has_half_scaling_factor = internal::is_ieee754_half_type<BM, BE>::value;
+    #else
+        static constexpr bool has_half_scaling_factor = false;
+    #endif
+
     private:
 
         // internal data type for the representation of the package
@@ -268,13 +962,17 @@ namespace FP_NAMESPACE
         static constexpr std::size_t pack_bytes = sizeof(pack_t);
         static constexpr std::size_t pack_size = (8 * pack_bytes) / bits;
 
+        // 8-bit floating point numbers are decoded as IEEE754 half precision numbers (exponent bias 15): correction factor
+        static constexpr float fp8_rebias = static_cast<float>(0x1U << (15 - internal::fp8_traits<BM, BE>::bias));
+
     public:
 
         // all non-IEEE754 floating point types are represented internally through integer-typed packages:
         // packages hold as many compressed floating point numbers as possible
         using type = typename std::conditional<internal::is_ieee754_double_type<BM, BE>::value, double, 
                      typename std::conditional<internal::is_ieee754_single_type<BM, BE>::value, float,
-                     typename std::conditional<internal::is_bfloat16_fp_type<BM, BE>::value, std::uint16_t, pack_t>::type>::type>::type;
+                     typename std::conditional<internal::is_bfloat16_fp_type<BM, BE>::value || internal::is_ieee754_half_type<BM, BE>::value, std::uint16_t,
+                     typename std::conditional<internal::is_fp8_type<BM, BE>::value, std::uint8_t, pack_t>::type>::type>::type>::type;
 
         // destructor
         ~fp_stream() { ; }
@@ -291,11 +989,16 @@ namespace FP_NAMESPACE
 
             if (n == 0) return 0;
 
-            if (is_ieee754_fp_type<BM, BE>::value || is_bfloat16_fp_type<BM, BE>::value)
+            if (is_ieee754_fp_type<BM, BE>::value || is_bfloat16_fp_type<BM, BE>::value || (is_ieee754_half_type<BM, BE>::value && !has_half_scaling_factor))
             {
-                // IEEE754 floating point numbers or bfloat16
+                // IEEE754 floating point numbers (also half precision without scaling factor) or bfloat16
                 return n * sizeof(type);
             }
+            else if (is_ieee754_half_type<BM, BE>::value || is_fp8_type<BM, BE>::value)
+            {
+                // IEEE754 half precision or 8-bit floating point numbers after the scaling factor
+                return pack_bytes + n * sizeof(type);
+            }
             else
             {
                 // we need to store the scaling factor as well
@@ -325,7 +1028,7 @@ namespace FP_NAMESPACE
             else
             {
                 // number of packages
-                return memory_footprint_bytes(n) / pack_bytes;
+                return memory_footprint_bytes(n) / sizeof(type);
             }
         }
 
@@ -366,35 +1069,96 @@ namespace FP_NAMESPACE
             }
             else if (is_bfloat16_fp_type<BM, BE>::value)
             {
-                // this special case can be handled by just storing the upper 16 bits
-                if (std::is_same<T, double>::value)
+                // this special case can be handled by storing the upper 16 bits after rounding
+                std::uint16_t* ptr_out = reinterpret_cast<std::uint16_t*>(out);
+
+                std::size_t i_start = 0;
+            #if defined(FP_SIMD_AVX512_BF16)
+                if (internal::use_simd_isa(simd_isa::avx512_bf16))
                 {
-                    for (std::size_t i = 0; i < n; ++i)
-                    {
-                        const float ftmp = in[i];
-                        const std::uint32_t itmp = *reinterpret_cast<const std::uint32_t*>(&ftmp) >> 16;
-                        out[i] = itmp;
-                    }
+                    i_start = compress_bfloat16_simd_intrinsics_avx512_bf16(in, ptr_out, n);
                 }
                 else
+            #endif
+            #if defined(FP_SIMD_AVX512)
+                if (internal::use_simd_isa(simd_isa::avx512))
                 {
-                    for (std::size_t i = 0; i < n; ++i)
-                    {
-                        const std::uint32_t itmp = *reinterpret_cast<const std::uint32_t*>(&in[i]) >> 16;
-                        out[i] = itmp;
-                    }
+                    i_start = compress_bfloat16_simd_intrinsics_avx512(in, ptr_out, n);
+                }
+                else
+            #endif
+            #if defined(FP_SIMD_AVX2)
+                if (internal::use_simd_isa(simd_isa::avx2))
+                {
+                    i_start = compress_bfloat16_simd_intrinsics(in, ptr_out, n);
+                }
+            #endif
+
+                for (std::size_t i = i_start; i < n; ++i)
+                {
+                    ptr_out[i] = float_to_bfloat16(static_cast<float>(in[i]));
                 }
             }
-            else
+            else if (is_ieee754_half_type<BM, BE>::value)
+            {
+                float a = 1.0F;
+                std::uint16_t* ptr_out = reinterpret_cast<std::uint16_t*>(out);
+                if (has_half_scaling_factor)
+                {
+                    // scale the absolute maximum into [2^14, 2^15): the scaling factor is a power of 2,
+                    // and there are no overflows when rounding to half precision
+                    const T abs_max = scan_absmax(in, n);
+                    int exponent = 0;
+                    std::frexp(static_cast<float>(abs_max), &exponent);
+                    a = ((abs_max > static_cast<T>(0.0) && std::isfinite(abs_max)) ? std::ldexp(1.0F, std::min(15 - exponent, 126)) : 1.0F);
+                    // place the scaling factor as the 1st element to the output stream
+                    float* fptr_out = reinterpret_cast<float*>(out);
+                    fptr_out[0] = 1.0F / a;
+                    fptr_out[1] = 0.0F;
+                    // all compressed floating point numbers are placed after the scaling factor
+                    ptr_out = reinterpret_cast<std::uint16_t*>(&fptr_out[2]);
+                }
+
+                std::size_t i_start = 0;
+            #if defined(FP_SIMD_F16C)
+                if (internal::use_simd_isa(simd_isa::avx2))
+                {
+                    i_start = compress_half_simd_intrinsics(in, ptr_out, n, a);
+                }
+            #endif
+
+                for (std::size_t i = i_start; i < n; ++i)
+                {
+                    ptr_out[i] = float_to_half(static_cast<float>(in[i]) * a);
+                }
+            }
+            else if (is_fp8_type<BM, BE>::value)
             {
-                // bit masks to extract IEEE754 exponent and mantissa of the single-type (float)
-                constexpr std::uint32_t get_exponent = 0x7F800000U;
-                constexpr std::uint32_t get_mantissa = 0x007FFFFFU;
+                // scale the absolute maximum to the largest finite 8-bit floating point number
+                const float abs_max = static_cast<float>(scan_absmax(in, n));
+                const float a = ((abs_max > 0.0F && std::isfinite(abs_max)) ? std::min(fp8_traits<BM, BE>::max_value / abs_max, std::ldexp(1.0F, 126)) : 1.0F);
+                // place the scaling factor as the 1st element to the output stream
+                float* fptr_out = reinterpret_cast<float*>(out);
+                fptr_out[0] = 1.0F / a;
+                fptr_out[1] = 0.0F;
+                // all compressed floating point numbers are placed after the scaling factor
+                std::uint8_t* ptr_out = reinterpret_cast<std::uint8_t*>(&fptr_out[2]);
 
-                // minimum and maximum number of the exponent with 'BE' bits
-                constexpr std::uint32_t range_min = 127 - ((0x1 << (BE - 1)) - 1);
-                constexpr std::uint32_t range_max = 127 + (0x1 << (BE - 1));
+                std::size_t i_start = 0;
+            #if defined(FP_SIMD_AVX2)
+                if (internal::use_simd_isa(simd_isa::avx2))
+                {
+                    i_start = compress_fp8_simd_intrinsics(in, ptr_out, n, a);
+                }
+            #endif
 
+                for (std::size_t i = i_start; i < n; ++i)
+                {
+                    ptr_out[i] = float_to_fp8<BM, BE>(static_cast<float>(in[i]) * a);
+                }
+            }
+            else
+            {
                 // for scaling, first determine the absolute maximum value among all uncompressed floating point numbers
                 const T abs_max = scan_absmax(in, n);
                 // calculate the scaling factor
@@ -409,8 +1173,17 @@ namespace FP_NAMESPACE
                 std::uint32_t buffer[pack_size];
                 float* fptr_buffer = reinterpret_cast<float*>(&buffer[0]);
 
+                // full packages are compressed using SIMD intrinsics (if available): the remainder is handled below
+                std::size_t i_start = 0;
+            #if defined(FP_SIMD_AVX2)
+                if (internal::use_simd_isa(simd_isa::avx2))
+                {
+                    i_start = compress_simd_intrinsics(in, ptr_out, n, a);
+                }
+            #endif
+
                 // process all input data in chunks of size 'package_size'
-                for (std::size_t i = 0, k = 0; i < n; i += pack_size, ++k)
+                for (std::size_t i = i_start, k = i_start / pack_size; i < n; i += pack_size, ++k)
                 {
                     // number of floating point numbers to compress / pack
                     const std::size_t ii_max = std::min(n - i, pack_size);
@@ -424,14 +1197,7 @@ namespace FP_NAMESPACE
                     // compress all 32-bit words individually: the resulting bit pattern begins at bit 0
                     for (std::size_t ii = 0; ii < ii_max; ++ii)
                     {
-                        const std::uint32_t current_element = buffer[ii];
-                        const std::uint32_t exponent = (current_element & get_exponent) >> ieee754_fp<float>::bm;
-                        const std::uint32_t sat_exponent = std::max(std::min(exponent, range_max), range_min);
-                        const std::uint32_t new_exponent = (sat_exponent - range_min) << BM;
-                        const std::uint32_t new_mantissa = (current_element & get_mantissa) >> (ieee754_fp<float>::bm - BM);
-                        const std::uint32_t new_sign = (current_element & 0x80000000) >> (31 - (BE + BM));
-
-                        buffer[ii] = (new_sign | new_exponent | new_mantissa);
+                        buffer[ii] = encode(buffer[ii]);
                     }
 
                     // pack the compressed floating point numbers
@@ -476,10 +1242,74 @@ namespace FP_NAMESPACE
             {
                 // this special case can be handled by just recovering the upper 16 bits:
                 // the lower 16 bits are zeroed
-                for (std::size_t i = 0; i < n; ++i)
+                const std::uint16_t* ptr_in = reinterpret_cast<const std::uint16_t*>(in);
+
+                std::size_t i_start = 0;
+            #if defined(FP_SIMD_AVX512)
+                if (internal::use_simd_isa(simd_isa::avx512))
+                {
+                    i_start = decompress_bfloat16_simd_intrinsics_avx512(ptr_in, out, n);
+                }
+                else
+            #endif
+            #if defined(FP_SIMD_AVX2)
+                if (internal::use_simd_isa(simd_isa::avx2))
+                {
+                    i_start = decompress_bfloat16_simd_intrinsics(ptr_in, out, n);
+                }
+            #endif
+
+                for (std::size_t i = i_start; i < n; ++i)
+                {
+                    out[i] = bfloat16_to_float(ptr_in[i]);
+                }
+            }
+            else if (is_ieee754_half_type<BM, BE>::value)
+            {
+                float a = 1.0F;
+                const std::uint16_t* ptr_in = reinterpret_cast<const std::uint16_t*>(in);
+                if (has_half_scaling_factor)
+                {
+                    // recover the scaling factor (1st element) of the input stream
+                    const float* fptr_in = reinterpret_cast<const float*>(in);
+                    a = fptr_in[0];
+                    // move on to the IEEE754 half precision numbers
+                    ptr_in = reinterpret_cast<const std::uint16_t*>(&fptr_in[2]);
+                }
+
+                std::size_t i_start = 0;
+            #if defined(FP_SIMD_F16C)
+                if (internal::use_simd_isa(simd_isa::avx2))
+                {
+                    i_start = decompress_half_simd_intrinsics(ptr_in, out, n, a);
+                }
+            #endif
+
+                for (std::size_t i = i_start; i < n; ++i)
+                {
+                    out[i] = static_cast<T>(half_to_float(ptr_in[i]) * a);
+                }
+            }
+            else if (is_fp8_type<BM, BE>::value)
+            {
+                // recover the scaling factor (1st element) of the input stream
+                const float* fptr_in = reinterpret_cast<const float*>(in);
+                const float a = fptr_in[0];
+                // move on to the 8-bit floating point numbers
+                const std::uint8_t* ptr_in = reinterpret_cast<const std::uint8_t*>(&fptr_in[2]);
+
+                std::size_t i_start = 0;
+            #if defined(FP_SIMD_F16C)
+                if (internal::use_simd_isa(simd_isa::avx2))
+                {
+                    i_start = decompress_fp8_simd_intrinsics(ptr_in, out, n, a);
+                }
+            #endif
+
+                const fp8_table<BM, BE>& table = get_fp8_table<BM, BE>();
+                for (std::size_t i = i_start; i < n; ++i)
                 {
-                    const std::uint32_t tmp = static_cast<std::uint32_t>(in[i]) << 16;
-                    out[i] = *reinterpret_cast<const float*>(&tmp);
+                    out[i] = static_cast<T>(table.value[ptr_in[i]] * a);
                 }
             }
             else
@@ -495,7 +1325,23 @@ namespace FP_NAMESPACE
                 std::uint32_t buffer[pack_size];
                 const float* fptr_buffer = reinterpret_cast<const float*>(&buffer[0]);
 
-                for (std::size_t i = 0, k = 0; i < n; i += pack_size, ++k)
+                // full packages are decompressed using SIMD intrinsics (if available): the remainder is handled below
+                std::size_t i_start = 0;
+            #if defined(FP_SIMD_AVX512)
+                if (internal::use_simd_isa(simd_isa::avx512))
+                {
+                    i_start = decompress_simd_intrinsics_avx512(ptr_in, out, n, a);
+                }
+                else
+            #endif
+            #if defined(FP_SIMD_AVX2)
+                if (internal::use_simd_isa(simd_isa::avx2))
+                {
+                    i_start = decompress_simd_intrinsics(ptr_in, out, n, a);
+                }
+            #endif
+
+                for (std::size_t i = i_start, k = i_start / pack_size; i < n; i += pack_size, ++k)
                 {
                     // number of floating point numbers to unpack / decompress
                     const std::size_t ii_max = std::min(n - i, pack_size);
@@ -506,14 +1352,7 @@ namespace FP_NAMESPACE
                     // decompress all numbers individually
                     for (std::size_t ii = 0; ii < ii_max; ++ii)
                     {
-                        const std::uint32_t current_element = buffer[ii];
-                        const std::uint32_t exponent = (current_element & get_exponent[BE][BM]) >> BM;
-                        const std::uint32_t mantissa = (current_element & get_lower_bits[BM]);
-                        const std::uint32_t new_mantissa = mantissa << (31 - (ieee754_fp<float>::be + BM));
-                        const std::uint32_t new_exponent = (exponent - ((0x1 << (BE - 1)) - 1) + 127) << (31 - ieee754_fp<float>::be);
-                        const std::uint32_t new_sign = (buffer[ii] << (31 - (BE + BM))) & 0x80000000;
-
-                        buffer[ii] = (new_sign | new_exponent | new_mantissa);
+                        buffer[ii] = decode(buffer[ii]);
                     }
 
                     // store the floating point numbers and apply the scaling
@@ -605,370 +1444,2063 @@ namespace FP_NAMESPACE
                 out[i] = (in >> (i * bits)) & get_lower_bits[bits];
             }
         }                
-    };
 
-    ////////////////////////////////////////////////////////////////////////////////////
-    // HELPER: fixed point
-    ////////////////////////////////////////////////////////////////////////////////////
-    namespace internal
-    {
-    #if defined(__AVX2__) || defined(__AVX512F__)
-        namespace 
+        // the word-level kernels are used for the bit-packed formats only, but they are instantiated for all formats:
+        // use valid parameters for the other ones so that all shifts are within range
+        static constexpr std::uint32_t be_packed = (is_bit_packed_type ? BE : 1);
+        static constexpr std::uint32_t bm_packed = (is_bit_packed_type ? BM : 1);
+
+        //! \brief Compress a 32-bit word (IEEE754 single) into a (1 + 'BE' + 'BM')-bit word
+        //!
+        //! The exponent saturates and the mantissa is truncated: the resulting bit pattern begins at bit 0.
+        //!
+        //! \param in 32-bit word (IEEE754 single)
+        //! \return compressed word
+        static inline std::uint32_t encode(const std::uint32_t in)
         {
-            template <typename T, typename TT>
-            constexpr bool specialization_available()
-            {
-                constexpr bool double_or_float_to_uint8 = (std::is_same<T, double>::value || std::is_same<T, float>::value) && std::is_same<TT, std::uint8_t>::value;
-                constexpr bool uint8_to_double_or_float = std::is_same<T, std::uint8_t>::value && (std::is_same<TT, double>::value || std::is_same<TT, float>::value);
-                constexpr bool uint8_to_int32 = std::is_same<T, std::uint8_t>::value && std::is_same<T, std::int32_t>::value;
-                constexpr bool uint8_to_int16 = std::is_same<T, std::uint8_t>::value && std::is_same<T, std::int16_t>::value;
-                return double_or_float_to_uint8 || uint8_to_double_or_float || uint8_to_int32 || uint8_to_int16;
-            }
+            // bit masks to extract IEEE754 exponent and mantissa of the single-type (float)
+            constexpr std::uint32_t get_exponent = 0x7F800000U;
+            constexpr std::uint32_t get_mantissa = 0x007FFFFFU;
+
+            // minimum and maximum number of the exponent with 'BE' bits
+            constexpr std::uint32_t range_min = 127 - ((0x1 << (be_packed - 1)) - 1);
+            constexpr std::uint32_t range_max = 127 + (0x1 << (be_packed - 1));
+
+            const std::uint32_t exponent = (in & get_exponent) >> ieee754_fp<float>::bm;
+            const std::uint32_t sat_exponent = std::max(std::min(exponent, range_max), range_min);
+            const std::uint32_t new_exponent = (sat_exponent - range_min) << bm_packed;
+            const std::uint32_t new_mantissa = (in & get_mantissa) >> (ieee754_fp<float>::bm - bm_packed);
+            const std::uint32_t new_sign = (in & 0x80000000) >> (31 - (be_packed + bm_packed));
+
+            return (new_sign | new_exponent | new_mantissa);
         }
 
-        //! \brief Recode between different data types using SIMD intrinsics
+        //! \brief Decompress a (1 + 'BE' + 'BM')-bit word into a 32-bit word (IEEE754 single)
         //!
-        //! Supported: double <-> uint8_t, uint8_t -> uint[16,32]_t
+        //! The scaling is not applied.
         //!
-        //! \tparam T 'in' data type
-        //! \tparam TT 'out' data type
-        //! \param in pointer to the input sequence of type 'T'
-        //! \param out pointer to the output sequence of type 'TT'
-        //! \param n length of the input sequence
-        //! \param a (optional) rescaling factor
-        //! \param b (optional) rescaling factor
-        template <typename T, typename TT, typename X = typename std::enable_if<!(specialization_available<T, TT>())>::type>
-        static void recode_simd_intrinsics(const T* in, TT* out, const std::size_t n, const float a = 0.0F, const float b = 1.0F)
+        //! \param in compressed word
+        //! \return 32-bit word (IEEE754 single)
+        static inline std::uint32_t decode(const std::uint32_t in)
         {
-            std::cerr << "error: recode_simd_intrinsics() is not implemented for these data types" << std::endl;
+            const std::uint32_t exponent = (in & get_exponent[be_packed][bm_packed]) >> bm_packed;
+            const std::uint32_t mantissa = (in & get_lower_bits[bm_packed]);
+            const std::uint32_t new_mantissa = mantissa << (31 - (ieee754_fp<float>::be + bm_packed));
+            const std::uint32_t new_exponent = (exponent - ((0x1 << (be_packed - 1)) - 1) + 127) << (31 - ieee754_fp<float>::be);
+            const std::uint32_t new_sign = (in << (31 - (be_packed + bm_packed))) & 0x80000000;
+
+            return (new_sign | new_exponent | new_mantissa);
         }
 
-        template <typename T, typename TT, typename X = typename std::enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value>::type, typename Y = typename std::enable_if<std::is_same<TT, std::uint8_t>::value>::type>
-        inline void recode_simd_intrinsics(const T* in, std::uint8_t* out, const std::size_t n, const float a, const float b, const X* dummy = nullptr)
+    #if defined(FP_SIMD_AVX2)
+        //! \brief Compress 32-bit words (IEEE754 single) into (1 + 'BE' + 'BM')-bit words using SIMD intrinsics
+        //!
+        //! This is the vector version of the scalar truncation in 'compress': the resulting bit pattern begins at bit 0.
+        //!
+        //! \param in 32-bit words (IEEE754 single)
+        //! \return compressed words
+        FP_TARGET_AVX2 static inline __m256i encode_simd_intrinsics(const __m256i in)
         {
-            if (!std::is_same<T, double>::value && !std::is_same<T, float>::value)
+            constexpr std::uint32_t range_min = 127 - ((0x1 << (be_packed - 1)) - 1);
+            constexpr std::uint32_t range_max = 127 + (0x1 << (be_packed - 1));
+
+            const __m256i exponent = _mm256_srli_epi32(_mm256_and_si256(in, _mm256_set1_epi32(0x7F800000)), ieee754_fp<float>::bm);
+            const __m256i sat_exponent = _mm256_max_epu32(_mm256_min_epu32(exponent, _mm256_set1_epi32(range_max)), _mm256_set1_epi32(range_min));
+            const __m256i new_exponent = _mm256_slli_epi32(_mm256_sub_epi32(sat_exponent, _mm256_set1_epi32(range_min)), bm_packed);
+            const __m256i new_mantissa = _mm256_srli_epi32(_mm256_and_si256(in, _mm256_set1_epi32(0x007FFFFF)), ieee754_fp<float>::bm - bm_packed);
+            const __m256i new_sign = _mm256_srli_epi32(_mm256_and_si256(in, _mm256_set1_epi32(0x80000000)), 31 - (be_packed + bm_packed));
+
+            return _mm256_or_si256(new_sign, _mm256_or_si256(new_exponent, new_mantissa));
+        }
+
+        //! \brief Compression of floating point numbers using SIMD intrinsics
+        //!
+        //! 4 packages are created at a time: groups of 4 consecutive elements of each package are loaded, scaled, compressed
+        //! and shifted to their position within the package, followed by a transpose-and-reduce step so that
+        //! each SIMD lane holds one package.
+        //! Only full packages are processed, and the output is bit-identical to that of the scalar code path.
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the packages (behind the scaling factor)
+        //! \param n length of the input sequence
+        //! \param a scaling factor
+        //! \return number of elements that have been compressed
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t compress_simd_intrinsics(const T* in, pack_t* out, const std::size_t n, const T a)
+        {
+            // 4 packages fit into an AVX2 register: each package is assembled from groups of 4 consecutive elements
+            constexpr std::size_t chunk_size = 4;
+            constexpr std::size_t group_size = 4;
+            constexpr std::size_t num_groups = (pack_size + group_size - 1) / group_size;
+            __m256i v256_shift[num_groups];
+            for (std::size_t g = 0; g < num_groups; ++g)
             {
-                std::cerr << "error: floating point format is not supported" << std::endl;
-                return;
+                // shift counts >= 64 clear those elements that belong to the next package
+                std::int64_t shift[group_size];
+                for (std::size_t ii = 0; ii < group_size; ++ii)
+                {
+                    const std::size_t i = g * group_size + ii;
+                    shift[ii] = (i < pack_size ? i * bits : 64);
+                }
+                v256_shift[g] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&shift[0]));
             }
 
-            // 32 8-bit words fit into an AVX2 register
-            constexpr std::size_t chunk_size = 32;
-            alignas(alignment) T buffer_in[chunk_size];
-            alignas(alignment) std::uint8_t buffer_out[chunk_size];
+            // the last group of the last package may extend beyond the chunk by up to 'group_size - 1' elements
+            const std::size_t num_packs = (n >= (group_size - 1) ? ((n - (group_size - 1)) / (chunk_size * pack_size)) * chunk_size : 0);
 
-            for (std::size_t i = 0; i < n; i += chunk_size)
+            for (std::size_t k = 0; k < num_packs; k += chunk_size)
             {
-                // determine the number of elements to be compressed / packed
-                const bool full_chunk = (std::min(n - i, chunk_size) == chunk_size ? true : false);
-                const T* ptr_in = &in[i];
-                if (!full_chunk)
+                const T* ptr_in = &in[k * pack_size];
+
+                __m256i v256_packed = _mm256_setzero_si256();
+                for (std::size_t g = 0; g < num_groups; ++g)
                 {
-                    // we want to read 'chunk_size' contiguous words: load the remainder loop data into the buffer...
-                    for (std::size_t ii = 0; ii < (n - i); ++ii)
+                    // compress 4 consecutive elements of each package (2 packages at a time)
+                    __m256i v256_element[chunk_size];
+                    for (std::size_t p = 0; p < chunk_size; p += 2)
                     {
-                        buffer_in[ii] = in[i + ii];
+                        const T* ptr = &ptr_in[p * pack_size + g * group_size];
+                        __m256 v256_in;
+                        if (std::is_same<T, double>::value)
+                        {
+                            const __m256d v256_a = _mm256_set1_pd(a);
+                            const __m128 v128_lo = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(reinterpret_cast<const double*>(ptr)), v256_a));
+                            const __m128 v128_hi = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(reinterpret_cast<const double*>(ptr + pack_size)), v256_a));
+                            v256_in = _mm256_insertf128_ps(_mm256_castps128_ps256(v128_lo), v128_hi, 1);
+                        }
+                        else
+                        {
+                            const __m128 v128_lo = _mm_loadu_ps(reinterpret_cast<const float*>(ptr));
+                            const __m128 v128_hi = _mm_loadu_ps(reinterpret_cast<const float*>(ptr + pack_size));
+                            v256_in = _mm256_mul_ps(_mm256_insertf128_ps(_mm256_castps128_ps256(v128_lo), v128_hi, 1), _mm256_set1_ps(a));
+                        }
+
+                        // move the bit patterns to their position within the package (elements beyond the package become zero)
+                        const __m256i v256_encoded = encode_simd_intrinsics(_mm256_castps_si256(v256_in));
+                        v256_element[p + 0] = _mm256_sllv_epi64(_mm256_cvtepu32_epi64(_mm256_castsi256_si128(v256_encoded)), v256_shift[g]);
+                        v256_element[p + 1] = _mm256_sllv_epi64(_mm256_cvtepu32_epi64(_mm256_extracti128_si256(v256_encoded, 1)), v256_shift[g]);
                     }
-                    // and switch to the buffer for reading
-                    ptr_in = &buffer_in[0];
-                }
-                
-                __m256 v256_in_1, v256_in_2, v256_in_3, v256_in_4;
-                if (std::is_same<T, double>::value)
-                {
-                    // load 8 chunks of 4 'double' words, for a total of 32 'double's, and convert them to 'float'
-                    v256_in_1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[0])))),
-                                                     _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[4]))), 1);
-                    v256_in_2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[8])))),
-                                                     _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[12]))), 1);
-                    v256_in_3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[16])))),
-                                                     _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[20]))), 1);
-                    v256_in_4 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[24])))),
-                                                     _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[28]))), 1);
-                }
-                else
-                {
-                    // load 4 chunks of 8 'float' words, for a total of 32 'float's
-                    v256_in_1 = _mm256_loadu_ps(reinterpret_cast<const float*>(&ptr_in[0]));
-                    v256_in_2 = _mm256_loadu_ps(reinterpret_cast<const float*>(&ptr_in[8]));
-                    v256_in_3 = _mm256_loadu_ps(reinterpret_cast<const float*>(&ptr_in[16]));
-                    v256_in_4 = _mm256_loadu_ps(reinterpret_cast<const float*>(&ptr_in[24]));
+
+                    // transpose and reduce: the 'p'-th lane of the result holds the OR over all lanes of 'v256_element[p]'
+                    const __m256i v256_01 = _mm256_or_si256(_mm256_unpacklo_epi64(v256_element[0], v256_element[1]), _mm256_unpackhi_epi64(v256_element[0], v256_element[1]));
+                    const __m256i v256_23 = _mm256_or_si256(_mm256_unpacklo_epi64(v256_element[2], v256_element[3]), _mm256_unpackhi_epi64(v256_element[2], v256_element[3]));
+                    v256_packed = _mm256_or_si256(v256_packed, _mm256_or_si256(_mm256_permute2x128_si256(v256_01, v256_23, 0x20), _mm256_permute2x128_si256(v256_01, v256_23, 0x31)));
                 }
 
-                // apply the rescaling so that the ouput is within the range 0.0 .. 255.0
-                __m256 v256_unpacked_1 = _mm256_mul_ps(_mm256_sub_ps(v256_in_1, _mm256_set1_ps(a)), _mm256_set1_ps(b));
-                __m256 v256_unpacked_2 = _mm256_mul_ps(_mm256_sub_ps(v256_in_2, _mm256_set1_ps(a)), _mm256_set1_ps(b));
-                __m256 v256_unpacked_3 = _mm256_mul_ps(_mm256_sub_ps(v256_in_3, _mm256_set1_ps(a)), _mm256_set1_ps(b));
-                __m256 v256_unpacked_4 = _mm256_mul_ps(_mm256_sub_ps(v256_in_4, _mm256_set1_ps(a)), _mm256_set1_ps(b));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[k]), v256_packed);
+            }
 
-                // convert to integer and use unsigned saturation for the packing: 32-bits -> 16-bits -> 8-bit
-                __m256i v256_packedlo = _mm256_packus_epi32(_mm256_cvtps_epi32(v256_unpacked_1), _mm256_cvtps_epi32(v256_unpacked_2));
-                __m256i v256_packedhi = _mm256_packus_epi32(_mm256_cvtps_epi32(v256_unpacked_3), _mm256_cvtps_epi32(v256_unpacked_4));
-                // permute the output elements to recover the original order
-                __m256i v256_packed = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(v256_packedlo, v256_packedhi), _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+            return num_packs * pack_size;
+        }
 
-                // flush the compressed / packed data to the output
-                if (full_chunk)
-                {
-                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[i]), v256_packed);
-                }
-                else
+        //! \brief Permutation and shift table for the SIMD decompression
+        //!
+        //! A SIMD register holds 4 (AVX2) or 8 (AVX-512) packages (2 32-bit words each).
+        //! For each position 'j0' of the first element within the first package, the table holds for each SIMD lane the
+        //! 32-bit words that contain the bit pattern of the element, together with the shift counts to align it at bit 0.
+        //! Shift counts of 32 clear the (unused) upper word.
+        //! The first 8 entries of each row are valid also for a window of 4 packages.
+        struct unpack_table
+        {
+            static constexpr std::size_t simd_width = 16;
+
+            alignas(internal::alignment) std::int32_t index_lo[pack_size][simd_width];
+            alignas(internal::alignment) std::int32_t index_hi[pack_size][simd_width];
+            alignas(internal::alignment) std::int32_t shift_lo[pack_size][simd_width];
+            alignas(internal::alignment) std::int32_t shift_hi[pack_size][simd_width];
+
+            unpack_table()
+            {
+                for (std::size_t j0 = 0; j0 < pack_size; ++j0)
                 {
-                    _mm256_store_si256(reinterpret_cast<__m256i*>(&buffer_out[0]), v256_packed);
-                    for (std::size_t ii = 0; ii < (n - i); ++ii)
+                    for (std::size_t ii = 0; ii < simd_width; ++ii)
                     {
-                        out[i + ii] = buffer_out[ii];
+                        const std::size_t p = (j0 + ii) / pack_size;
+                        const std::size_t offset = ((j0 + ii) % pack_size) * bits;
+                        const std::size_t word = offset / 32;
+                        const std::size_t shift = offset % 32;
+
+                        index_lo[j0][ii] = 2 * p + word;
+                        shift_lo[j0][ii] = shift;
+                        // the bit pattern spans 2 words only if it starts in the lower word
+                        index_hi[j0][ii] = 2 * p + (word == 0 ? 1 : word);
+                        shift_hi[j0][ii] = (word == 0 ? (32 - shift) : 32);
                     }
                 }
             }
+        };
+
+        static const unpack_table& get_unpack_table()
+        {
+            static const unpack_table table;
+            return table;
         }
 
-        template <typename T, typename TT, typename X = typename std::enable_if<std::is_same<T, std::uint8_t>::value>::type, typename Y = typename std::enable_if<std::is_same<TT, double>::value || std::is_same<TT, float>::value>::type>
-        inline void recode_simd_intrinsics(const T* in, TT* out, const std::size_t n, const float a, const float b, const X* dummy = nullptr)
+        //! \brief Move the bit patterns of 8 consecutive elements into separate 32-bit lanes
+        //!
+        //! 8-bit and 16-bit words are zero extended (the packages are just arrays of them): 'j0' is zero in this case.
+        //!
+        //! \param in 4 packages
+        //! \param table unpack table
+        //! \param j0 position of the first element within the first package
+        //! \return compressed words (bits beyond the element are not cleared)
+        FP_TARGET_AVX2 static inline __m256i unpack_simd_intrinsics(const __m256i in, const unpack_table& table, const std::size_t j0)
         {
-            if (!std::is_same<TT, double>::value && !std::is_same<TT, float>::value)
+            if (bits == 16)
             {
-                std::cerr << "error: floating point format is not supported" << std::endl;
-                return;
+                return _mm256_cvtepu16_epi32(_mm256_castsi256_si128(in));
+            }
+            else if (bits == 8)
+            {
+                return _mm256_cvtepu8_epi32(_mm256_castsi256_si128(in));
             }
 
-            // 32 8-bit words fit into an AVX2 register
-            constexpr std::size_t chunk_size = 32;
-            alignas(alignment) TT buffer_out[chunk_size];
+            const __m256i lo = _mm256_srlv_epi32(_mm256_permutevar8x32_epi32(in, _mm256_load_si256(reinterpret_cast<const __m256i*>(&table.index_lo[j0][0]))), _mm256_load_si256(reinterpret_cast<const __m256i*>(&table.shift_lo[j0][0])));
+            if ((32 % bits) == 0)
+            {
+                // bit patterns do not span 2 words
+                return lo;
+            }
+            const __m256i hi = _mm256_sllv_epi32(_mm256_permutevar8x32_epi32(in, _mm256_load_si256(reinterpret_cast<const __m256i*>(&table.index_hi[j0][0]))), _mm256_load_si256(reinterpret_cast<const __m256i*>(&table.shift_hi[j0][0])));
 
-            for (std::size_t i = 0; i < n; i += chunk_size)
+            return _mm256_or_si256(lo, hi);
+        }
+
+        //! \brief Decompress (1 + 'BE' + 'BM')-bit words into 32-bit words (IEEE754 single) using SIMD intrinsics
+        //!
+        //! This is the vector version of the scalar code in 'decompress'.
+        //! Bits beyond the compressed word are cut off, and the scaling is not applied.
+        //!
+        //! \param in compressed words
+        //! \return IEEE754 single floating point numbers
+        FP_TARGET_AVX2 static inline __m256 decode_simd_intrinsics(const __m256i in)
+        {
+            static_assert((be_packed + bm_packed) < 32 && bm_packed <= ieee754_fp<float>::bm, "error: the compressed word must fit into 32 bits");
+
+            // unsigned 64-bit arithmetic: for more than 8 exponent bits, bias and mask wrap around exactly as in 'decode'
+            constexpr std::uint32_t bias = static_cast<std::uint32_t>((127ULL - ((1ULL << (be_packed - 1)) - 1)) << ieee754_fp<float>::bm);
+            constexpr std::uint32_t mask = static_cast<std::uint32_t>((1ULL << (ieee754_fp<float>::bm + be_packed)) - 1);
+
+            const __m256i sign = _mm256_and_si256(_mm256_slli_epi32(in, 31 - (be_packed + bm_packed)), _mm256_set1_epi32(0x80000000));
+            const __m256i exponent_mantissa = _mm256_and_si256(_mm256_slli_epi32(in, ieee754_fp<float>::bm - bm_packed), _mm256_set1_epi32(static_cast<std::int32_t>(mask)));
+
+            return _mm256_castsi256_ps(_mm256_or_si256(sign, _mm256_add_epi32(exponent_mantissa, _mm256_set1_epi32(static_cast<std::int32_t>(bias)))));
+        }
+
+    #if defined(FP_SIMD_AVX512)
+        FP_TARGET_AVX512 static inline __m512i unpack_simd_intrinsics(const __m512i in, const unpack_table& table, const std::size_t j0)
+        {
+            if (bits == 16)
             {
-                // load 256-bit word and permute the elements to match the reordering while unpacking: 
-                // this is always safe if data allocation happened with the 'memory_footprint*' method below
-                __m256i v256_packed = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i])), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
-                // unpack 8-bit into 16-bit words
-                __m256i v256_unpacked_lo = _mm256_unpacklo_epi8(v256_packed, _mm256_setzero_si256());
-                __m256i v256_unpacked_hi = _mm256_unpackhi_epi8(v256_packed, _mm256_setzero_si256());
+                return _mm512_cvtepu16_epi32(_mm512_castsi512_si256(in));
+            }
+            else if (bits == 8)
+            {
+                return _mm512_cvtepu8_epi32(_mm512_castsi512_si128(in));
+            }
 
-                // unpack into 32-bit words
-                __m256i v256_unpacked[4];
-                v256_unpacked[0] = _mm256_unpacklo_epi16(v256_unpacked_lo, _mm256_setzero_si256());
-                v256_unpacked[1] = _mm256_unpackhi_epi16(v256_unpacked_lo, _mm256_setzero_si256());
-                v256_unpacked[2] = _mm256_unpacklo_epi16(v256_unpacked_hi, _mm256_setzero_si256());
-                v256_unpacked[3] = _mm256_unpackhi_epi16(v256_unpacked_hi, _mm256_setzero_si256());
+            const __m512i lo = _mm512_srlv_epi32(_mm512_permutexvar_epi32(_mm512_load_si512(reinterpret_cast<const void*>(&table.index_lo[j0][0])), in), _mm512_load_si512(reinterpret_cast<const void*>(&table.shift_lo[j0][0])));
+            if ((32 % bits) == 0)
+            {
+                // bit patterns do not span 2 words
+                return lo;
+            }
+            const __m512i hi = _mm512_sllv_epi32(_mm512_permutexvar_epi32(_mm512_load_si512(reinterpret_cast<const void*>(&table.index_hi[j0][0])), in), _mm512_load_si512(reinterpret_cast<const void*>(&table.shift_hi[j0][0])));
 
-                // determine the number of elements to be unpacked / decompressed
-                const bool full_chunk = (std::min(n - i, chunk_size) == chunk_size ? true : false);
-                // write the output to the buffer in case of the loop remainder
-                TT* ptr_out = (full_chunk ? &out[i] : &buffer_out[0]);
+            return _mm512_or_si512(lo, hi);
+        }
 
-                if (std::is_same<TT, double>::value)
+        FP_TARGET_AVX512 static inline __m512 decode_simd_intrinsics(const __m512i in)
+        {
+            static_assert((be_packed + bm_packed) < 32 && bm_packed <= ieee754_fp<float>::bm, "error: the compressed word must fit into 32 bits");
+
+            // see the AVX2 version
+            constexpr std::uint32_t bias = static_cast<std::uint32_t>((127ULL - ((1ULL << (be_packed - 1)) - 1)) << ieee754_fp<float>::bm);
+            constexpr std::uint32_t mask = static_cast<std::uint32_t>((1ULL << (ieee754_fp<float>::bm + be_packed)) - 1);
+
+            const __m512i sign = _mm512_and_si512(_mm512_slli_epi32(in, 31 - (be_packed + bm_packed)), _mm512_set1_epi32(0x80000000));
+            const __m512i exponent_mantissa = _mm512_and_si512(_mm512_slli_epi32(in, ieee754_fp<float>::bm - bm_packed), _mm512_set1_epi32(static_cast<std::int32_t>(mask)));
+
+            return _mm512_castsi512_ps(_mm512_or_si512(sign, _mm512_add_epi32(exponent_mantissa, _mm512_set1_epi32(static_cast<std::int32_t>(bias)))));
+        }
+    #endif
+
+        //! \brief Decompression of floating point numbers using SIMD intrinsics
+        //!
+        //! Each SIMD lane decompresses one element: the 32-bit words containing its bit pattern are moved into the lane
+        //! (permutation), shifted and combined.
+        //! The IEEE754 single bit pattern is then restored, and the scaling is applied.
+        //! The output is bit-identical to that of the scalar code path.
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the packages (behind the scaling factor)
+        //! \param out pointer to the output sequence
+        //! \param n length of the output sequence
+        //! \param a scaling factor
+        //! \return number of elements that have been decompressed (multiple of 'pack_size')
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t decompress_simd_intrinsics(const pack_t* in, T* out, const std::size_t n, const float a)
+        {
+            // 8 elements from a window of 4 packages
+            constexpr std::size_t simd_width = 8;
+            constexpr std::size_t simd_window = 4;
+
+            const unpack_table& table = get_unpack_table();
+            // SIMD loads must not go beyond the last package
+            const std::size_t num_packs = (n + pack_size - 1) / pack_size;
+            std::size_t i = 0;
+
+            for (std::size_t k = 0, j0 = 0; (i + simd_width) <= n && (k + simd_window) <= num_packs; i += simd_width)
+            {
+                const __m256i v256_in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[k]));
+                const __m256 v256_out = _mm256_mul_ps(decode_simd_intrinsics(unpack_simd_intrinsics(v256_in, table, j0)), _mm256_set1_ps(a));
+
+                if (std::is_same<T, double>::value)
                 {
-                    for (std::size_t ii = 0; ii < 4; ++ii)
-                    {
-                        // convert 32-bit integers to 'double' and rescale
-                        __m256d tmp_1 = _mm256_fmadd_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(v256_unpacked[ii], 0)), _mm256_set1_pd(b), _mm256_set1_pd(a));
-                        __m256d tmp_2 = _mm256_fmadd_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(v256_unpacked[ii], 1)), _mm256_set1_pd(b), _mm256_set1_pd(a));
-                        _mm256_storeu_pd(reinterpret_cast<double*>(&ptr_out[ii * 8 + 0]), tmp_1);
-                        _mm256_storeu_pd(reinterpret_cast<double*>(&ptr_out[ii * 8 + 4]), tmp_2);
-                    }
+                    _mm256_storeu_pd(reinterpret_cast<double*>(&out[i]), _mm256_cvtps_pd(_mm256_castps256_ps128(v256_out)));
+                    _mm256_storeu_pd(reinterpret_cast<double*>(&out[i + 4]), _mm256_cvtps_pd(_mm256_extractf128_ps(v256_out, 1)));
                 }
                 else
                 {
-                    for (std::size_t ii = 0; ii < 4; ++ii)
-                    {
-                        // convert 32-bit integers to 'float' and rescale
-                        __m256 tmp = _mm256_fmadd_ps(_mm256_cvtepi32_ps(v256_unpacked[ii]), _mm256_set1_ps(b), _mm256_set1_ps(a));
-                        _mm256_storeu_ps(reinterpret_cast<float*>(&ptr_out[ii * 8]), tmp);
-                    }
+                    _mm256_storeu_ps(reinterpret_cast<float*>(&out[i]), v256_out);
                 }
 
-                // flush the buffer to the output if necessary
-                if (!full_chunk)
-                {
-                    for (std::size_t ii = 0; ii < (n - i); ++ii)
-                    {
-                        out[i + ii] = buffer_out[ii];
-                    }
-                }
+                // move on to the package that holds the next element
+                k += (j0 + simd_width) / pack_size;
+                j0 = (j0 + simd_width) % pack_size;
             }
+
+            return (i / pack_size) * pack_size;
         }
 
-        template <>
-        inline void recode_simd_intrinsics<std::uint8_t, std::int32_t>(const std::uint8_t* in, std::int32_t* out, const std::size_t n, const float a, const float b)
+    #if defined(FP_SIMD_AVX512)
+        //! \brief Decompression of floating point numbers using SIMD intrinsics (AVX-512)
+        //!
+        //! Same as above, but 16 elements at a time.
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the packages (behind the scaling factor)
+        //! \param out pointer to the output sequence
+        //! \param n length of the output sequence
+        //! \param a scaling factor
+        //! \return number of elements that have been decompressed (multiple of 'pack_size')
+        template <typename T>
+        FP_TARGET_AVX512 static std::size_t decompress_simd_intrinsics_avx512(const pack_t* in, T* out, const std::size_t n, const float a)
         {
-            // 32 8-bit words fit into an AVX2 register
-            constexpr std::size_t chunk_size = 32;
-            alignas(alignment) std::int32_t buffer_out[chunk_size];
+            // 16 elements from a window of 8 packages
+            constexpr std::size_t simd_width = 16;
+            constexpr std::size_t simd_window = 8;
 
-            for (std::size_t i = 0; i < n; i += chunk_size)
+            const unpack_table& table = get_unpack_table();
+            // SIMD loads must not go beyond the last package
+            const std::size_t num_packs = (n + pack_size - 1) / pack_size;
+            std::size_t i = 0;
+
+            for (std::size_t k = 0, j0 = 0; (i + simd_width) <= n && (k + simd_window) <= num_packs; i += simd_width)
             {
-                // load 256-bit word and permute the elements to match the reordering while unpacking: 
-                // this is always safe if data allocation happened with the 'memory_footprint*' method below
-                __m256i v256_packed = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i])), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
-                // unpack 8-bit into 16-bit words
-                __m256i v256_unpacked_lo = _mm256_unpacklo_epi8(v256_packed, _mm256_setzero_si256());
-                __m256i v256_unpacked_hi = _mm256_unpackhi_epi8(v256_packed, _mm256_setzero_si256());
+                const __m512i v512_in = _mm512_loadu_si512(reinterpret_cast<const void*>(&in[k]));
+                const __m512 v512_out = _mm512_mul_ps(decode_simd_intrinsics(unpack_simd_intrinsics(v512_in, table, j0)), _mm512_set1_ps(a));
 
-                // unpack into 32-bit words
-                __m256i v256_unpacked[4];
-                v256_unpacked[0] = _mm256_unpacklo_epi16(v256_unpacked_lo, _mm256_setzero_si256());
-                v256_unpacked[1] = _mm256_unpackhi_epi16(v256_unpacked_lo, _mm256_setzero_si256());
-                v256_unpacked[2] = _mm256_unpacklo_epi16(v256_unpacked_hi, _mm256_setzero_si256());
-                v256_unpacked[3] = _mm256_unpackhi_epi16(v256_unpacked_hi, _mm256_setzero_si256());
+                if (std::is_same<T, double>::value)
+                {
+                    _mm512_storeu_pd(reinterpret_cast<double*>(&out[i]), _mm512_cvtps_pd(_mm512_castps512_ps256(v512_out)));
+                    _mm512_storeu_pd(reinterpret_cast<double*>(&out[i + 8]), _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v512_out), 1))));
+                }
+                else
+                {
+                    _mm512_storeu_ps(reinterpret_cast<float*>(&out[i]), v512_out);
+                }
 
-                // determine the number of elements to be unpacked / decompressed
-                const bool full_chunk = (std::min(n - i, chunk_size) == chunk_size ? true : false);
-                // write the output to the buffer in case of the loop remainder
-                std::int32_t* ptr_out = (full_chunk ? &out[i] : &buffer_out[0]);
+                // move on to the package that holds the next element
+                k += (j0 + simd_width) / pack_size;
+                j0 = (j0 + simd_width) % pack_size;
+            }
 
-                // output the 32-bit integers WITHOUT converting to 'double'
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[0]), v256_unpacked[0]);
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[8]), v256_unpacked[1]);
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[16]), v256_unpacked[2]);
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[24]), v256_unpacked[3]);
+            return (i / pack_size) * pack_size;
+        }
+    #endif
 
-                // flush the buffer to the output if necessary
-                if (!full_chunk)
+    #if defined(FP_SIMD_F16C)
+        //! \brief Conversion of floating point numbers into IEEE754 half precision using SIMD intrinsics (F16C)
+        //!
+        //! The output is bit-identical to that of the scalar code path (round to nearest even).
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence (behind the scaling factor)
+        //! \param n length of the input sequence
+        //! \param a scaling factor
+        //! \return number of elements that have been converted (multiple of 8)
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t compress_half_simd_intrinsics(const T* in, std::uint16_t* out, const std::size_t n, const float a)
+        {
+            constexpr std::size_t simd_width = 8;
+            std::size_t i = 0;
+
+            for (; (i + simd_width) <= n; i += simd_width)
+            {
+                __m256 v256_in;
+                if (std::is_same<T, double>::value)
                 {
-                    for (std::size_t ii = 0; ii < (n - i); ++ii)
-                    {
-                        out[i + ii] = buffer_out[ii];
-                    }
+                    const __m128 v128_lo = _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&in[i])));
+                    const __m128 v128_hi = _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&in[i + 4])));
+                    v256_in = _mm256_insertf128_ps(_mm256_castps128_ps256(v128_lo), v128_hi, 1);
+                }
+                else
+                {
+                    v256_in = _mm256_loadu_ps(reinterpret_cast<const float*>(&in[i]));
                 }
+
+                const __m128i v128_out = _mm256_cvtps_ph(_mm256_mul_ps(v256_in, _mm256_set1_ps(a)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), v128_out);
             }
+
+            return i;
         }
-        
-        template <>
-        inline void recode_simd_intrinsics<std::uint8_t, std::int16_t>(const std::uint8_t* in, std::int16_t* out, const std::size_t n, const float a, const float b)
+
+        //! \brief Conversion of IEEE754 half precision numbers into floating point numbers using SIMD intrinsics (F16C)
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence (behind the scaling factor)
+        //! \param out pointer to the output sequence
+        //! \param n length of the output sequence
+        //! \param a scaling factor
+        //! \return number of elements that have been converted (multiple of 8)
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t decompress_half_simd_intrinsics(const std::uint16_t* in, T* out, const std::size_t n, const float a)
         {
-            // 32 8-bit words fit into an AVX2 register
-            constexpr std::size_t chunk_size = 32;
-            alignas(alignment) std::int16_t buffer_out[chunk_size];
+            constexpr std::size_t simd_width = 8;
+            std::size_t i = 0;
 
-            for (std::size_t i = 0; i < n; i += chunk_size)
+            for (; (i + simd_width) <= n; i += simd_width)
             {
-                // load 256-bit word and permute the elements to match the reordering while unpacking: 
-                // this is always safe if data allocation happened with the 'memory_footprint*' method below
-                __m256i v256_packed = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i])), _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7));
-                // unpack 8-bit into 16-bit words
-                __m256i v256_unpacked_lo = _mm256_unpacklo_epi8(v256_packed, _mm256_setzero_si256());
-                __m256i v256_unpacked_hi = _mm256_unpackhi_epi8(v256_packed, _mm256_setzero_si256());
+                const __m256 v256_out = _mm256_mul_ps(_mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]))), _mm256_set1_ps(a));
 
-                // determine the number of elements to be unpacked / decompressed
-                const bool full_chunk = (std::min(n - i, chunk_size) == chunk_size ? true : false);
-                // write the output to the buffer in case of the loop remainder
-                std::int16_t* ptr_out = (full_chunk ? &out[i] : &buffer_out[0]);
+                if (std::is_same<T, double>::value)
+                {
+                    _mm256_storeu_pd(reinterpret_cast<double*>(&out[i]), _mm256_cvtps_pd(_mm256_castps256_ps128(v256_out)));
+                    _mm256_storeu_pd(reinterpret_cast<double*>(&out[i + 4]), _mm256_cvtps_pd(_mm256_extractf128_ps(v256_out, 1)));
+                }
+                else
+                {
+                    _mm256_storeu_ps(reinterpret_cast<float*>(&out[i]), v256_out);
+                }
+            }
 
-                // output the 16-bit integers WITHOUT any further conversion
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[0]), v256_unpacked_lo);
-                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[16]), v256_unpacked_hi);
-                
-                // flush the buffer to the output if necessary
-                if (!full_chunk)
+            return i;
+        }
+    #endif
+
+        //! \brief Round IEEE754 single precision numbers to bfloat16 using SIMD intrinsics
+        //!
+        //! This is the vector version of 'float_to_bfloat16'.
+        //!
+        //! \param in 32-bit words (IEEE754 single)
+        //! \return bfloat16 bit patterns in the lower 16 bits of each 32-bit word
+        FP_TARGET_AVX2 static inline __m256i encode_bfloat16_simd_intrinsics(const __m256i in)
+        {
+            const __m256i is_nan = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(in), _mm256_castsi256_ps(in), _CMP_UNORD_Q));
+            const __m256i is_zero = _mm256_cmpeq_epi32(_mm256_and_si256(in, _mm256_set1_epi32(0x7F800000)), _mm256_setzero_si256());
+            // no rounding for NaNs
+            const __m256i increment = _mm256_andnot_si256(is_nan, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF), _mm256_and_si256(_mm256_srli_epi32(in, 16), _mm256_set1_epi32(0x1))));
+            const __m256i v256_rounded = _mm256_srli_epi32(_mm256_add_epi32(in, increment), 16);
+
+            // quiet NaNs, and only the sign remains for zero and denormalized numbers
+            return _mm256_andnot_si256(_mm256_and_si256(is_zero, _mm256_set1_epi32(0x7FFF)), _mm256_or_si256(v256_rounded, _mm256_and_si256(is_nan, _mm256_set1_epi32(0x40))));
+        }
+
+        //! \brief Conversion of floating point numbers into bfloat16 using SIMD intrinsics
+        //!
+        //! The output is bit-identical to that of the scalar code path (round to nearest even).
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence
+        //! \param n length of the input sequence
+        //! \return number of elements that have been converted (multiple of 16)
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t compress_bfloat16_simd_intrinsics(const T* in, std::uint16_t* out, const std::size_t n)
+        {
+            constexpr std::size_t simd_width = 16;
+            std::size_t i = 0;
+
+            for (; (i + simd_width) <= n; i += simd_width)
+            {
+                __m256i v256_encoded[2];
+                for (std::size_t ii = 0; ii < 2; ++ii)
                 {
-                    for (std::size_t ii = 0; ii < (n - i); ++ii)
+                    __m256 v256_in;
+                    if (std::is_same<T, double>::value)
                     {
-                        out[i + ii] = buffer_out[ii];
+                        const __m128 v128_lo = _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&in[i + ii * 8])));
+                        const __m128 v128_hi = _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&in[i + ii * 8 + 4])));
+                        v256_in = _mm256_insertf128_ps(_mm256_castps128_ps256(v128_lo), v128_hi, 1);
+                    }
+                    else
+                    {
+                        v256_in = _mm256_loadu_ps(reinterpret_cast<const float*>(&in[i + ii * 8]));
                     }
+
+                    v256_encoded[ii] = encode_bfloat16_simd_intrinsics(_mm256_castps_si256(v256_in));
                 }
+
+                // the packing happens within 128-bit lanes
+                const __m256i v256_out = _mm256_permute4x64_epi64(_mm256_packus_epi32(v256_encoded[0], v256_encoded[1]), 0xD8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[i]), v256_out);
             }
+
+            return i;
         }
-        #endif
-    
-        //! \brief Encode floating point into fixed point numbers
+
+        //! \brief Conversion of bfloat16 numbers into floating point numbers using SIMD intrinsics
         //!
         //! \tparam T floating point data type
-        //! \tparam TT 'out' data type
         //! \param in pointer to the input sequence
         //! \param out pointer to the output sequence
-        //! \param n length of the input sequence
-        //! \param a rescaling factor
-        //! \param b rescaling factor
-        template <typename T, typename TT>
-        static void encode_fixed_point_kernel(const T* in, TT* out, const std::size_t n, const T a, const T b)
+        //! \param n length of the output sequence
+        //! \return number of elements that have been converted (multiple of 8)
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t decompress_bfloat16_simd_intrinsics(const std::uint16_t* in, T* out, const std::size_t n)
         {
-            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed as input");
-            static_assert(std::is_integral<TT>::value, "error: only integers are allowed as output");
+            constexpr std::size_t simd_width = 8;
+            std::size_t i = 0;
 
-            if (n == 0) return;
-            
-            // the scaling parameters 'a' and 'b' are stored together with the output bitstream
-            float* fptr_out = reinterpret_cast<float*>(out);
-            fptr_out[0] = static_cast<float>(a);
-            fptr_out[1] = static_cast<float>(1.0 / b);
-            TT* ptr_out = reinterpret_cast<TT*>(&fptr_out[2]);
+            for (; (i + simd_width) <= n; i += simd_width)
+            {
+                const __m256 v256_out = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]))), 16));
+
+                if (std::is_same<T, double>::value)
+                {
+                    _mm256_storeu_pd(reinterpret_cast<double*>(&out[i]), _mm256_cvtps_pd(_mm256_castps256_ps128(v256_out)));
+                    _mm256_storeu_pd(reinterpret_cast<double*>(&out[i + 4]), _mm256_cvtps_pd(_mm256_extractf128_ps(v256_out, 1)));
+                }
+                else
+                {
+                    _mm256_storeu_ps(reinterpret_cast<float*>(&out[i]), v256_out);
+                }
+            }
+
+            return i;
+        }
+
+    #if defined(FP_SIMD_AVX512)
+        //! \brief Load 16 floating point numbers as IEEE754 single precision numbers (AVX-512)
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \return IEEE754 single precision numbers
+        template <typename T>
+        FP_TARGET_AVX512 static inline __m512 load_ps_simd_intrinsics_avx512(const T* in)
+        {
+            if (std::is_same<T, double>::value)
+            {
+                const __m256 v256_lo = _mm512_cvtpd_ps(_mm512_loadu_pd(reinterpret_cast<const double*>(&in[0])));
+                const __m256 v256_hi = _mm512_cvtpd_ps(_mm512_loadu_pd(reinterpret_cast<const double*>(&in[8])));
+                return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(v256_lo)), _mm256_castps_pd(v256_hi), 1));
+            }
+            else
+            {
+                return _mm512_loadu_ps(reinterpret_cast<const float*>(&in[0]));
+            }
+        }
+
+        //! \brief Conversion of floating point numbers into bfloat16 using SIMD intrinsics (AVX-512)
+        //!
+        //! Same as above, but 16 elements at a time.
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence
+        //! \param n length of the input sequence
+        //! \return number of elements that have been converted (multiple of 16)
+        template <typename T>
+        FP_TARGET_AVX512 static std::size_t compress_bfloat16_simd_intrinsics_avx512(const T* in, std::uint16_t* out, const std::size_t n)
+        {
+            constexpr std::size_t simd_width = 16;
+            std::size_t i = 0;
+
+            for (; (i + simd_width) <= n; i += simd_width)
+            {
+                const __m512i v512_in = _mm512_castps_si512(load_ps_simd_intrinsics_avx512(&in[i]));
+                const __m512i v512_upper = _mm512_srli_epi32(v512_in, 16);
+                const __m512i v512_rounded = _mm512_srli_epi32(_mm512_add_epi32(v512_in, _mm512_add_epi32(_mm512_set1_epi32(0x7FFF), _mm512_and_si512(v512_upper, _mm512_set1_epi32(0x1)))), 16);
+                const __mmask16 is_nan = _mm512_cmpgt_epu32_mask(_mm512_and_si512(v512_in, _mm512_set1_epi32(0x7FFFFFFF)), _mm512_set1_epi32(0x7F800000));
+                const __mmask16 is_zero = _mm512_testn_epi32_mask(v512_in, _mm512_set1_epi32(0x7F800000));
+                __m512i v512_encoded = _mm512_mask_or_epi32(v512_rounded, is_nan, v512_upper, _mm512_set1_epi32(0x40));
+                v512_encoded = _mm512_mask_and_epi32(v512_encoded, is_zero, v512_upper, _mm512_set1_epi32(0x8000));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[i]), _mm512_cvtepi32_epi16(v512_encoded));
+            }
+
+            return i;
+        }
+
+        //! \brief Conversion of bfloat16 numbers into floating point numbers using SIMD intrinsics (AVX-512)
+        //!
+        //! Same as above, but 16 elements at a time.
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence
+        //! \param n length of the output sequence
+        //! \return number of elements that have been converted (multiple of 16)
+        template <typename T>
+        FP_TARGET_AVX512 static std::size_t decompress_bfloat16_simd_intrinsics_avx512(const std::uint16_t* in, T* out, const std::size_t n)
+        {
+            constexpr std::size_t simd_width = 16;
+            std::size_t i = 0;
+
+            for (; (i + simd_width) <= n; i += simd_width)
+            {
+                const __m512 v512_out = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i]))), 16));
+
+                if (std::is_same<T, double>::value)
+                {
+                    _mm512_storeu_pd(reinterpret_cast<double*>(&out[i]), _mm512_cvtps_pd(_mm512_castps512_ps256(v512_out)));
+                    _mm512_storeu_pd(reinterpret_cast<double*>(&out[i + 8]), _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v512_out), 1))));
+                }
+                else
+                {
+                    _mm512_storeu_ps(reinterpret_cast<float*>(&out[i]), v512_out);
+                }
+            }
+
+            return i;
+        }
+    #endif
+
+    #if defined(FP_SIMD_AVX512_BF16)
+        //! \brief Conversion of floating point numbers into bfloat16 using SIMD intrinsics (AVX512-BF16)
+        //!
+        //! 32 elements at a time (vcvtne2ps2bf16): the output is bit-identical to that of the scalar code path.
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence
+        //! \param n length of the input sequence
+        //! \return number of elements that have been converted (multiple of 32)
+        template <typename T>
+        FP_TARGET_AVX512_BF16 static std::size_t compress_bfloat16_simd_intrinsics_avx512_bf16(const T* in, std::uint16_t* out, const std::size_t n)
+        {
+            constexpr std::size_t simd_width = 32;
+            std::size_t i = 0;
+
+            for (; (i + simd_width) <= n; i += simd_width)
+            {
+                // the 2nd argument goes to the lower half of the output
+                const __m512bh v512_out = _mm512_cvtne2ps_pbh(load_ps_simd_intrinsics_avx512(&in[i + 16]), load_ps_simd_intrinsics_avx512(&in[i]));
+                _mm512_storeu_si512(reinterpret_cast<void*>(&out[i]), (__m512i)v512_out);
+            }
+
+            return i;
+        }
+    #endif
+
+        //! \brief Round IEEE754 single precision numbers to 8-bit floating point using SIMD intrinsics
+        //!
+        //! This is the vector version of 'float_to_fp8'.
+        //!
+        //! \param in IEEE754 single precision numbers
+        //! \return 8-bit floating point bit patterns in the lower 8 bits of each 32-bit word
+        FP_TARGET_AVX2 static inline __m256i encode_fp8_simd_intrinsics(const __m256 in)
+        {
+            using traits = internal::fp8_traits<BM, BE>;
+            constexpr std::uint32_t bm_fp8 = (internal::is_fp8_type<BM, BE>::value ? BM : 3);
+            constexpr std::uint32_t min_normal = (128 - traits::bias) << 23;
+            constexpr float scale_denormal = static_cast<float>(0x1U << (traits::bias - 1 + bm_fp8));
+
+            const __m256i v256_in = _mm256_castps_si256(in);
+            const __m256i v256_abs = _mm256_and_si256(v256_in, _mm256_set1_epi32(0x7FFFFFFF));
+            const __m256i v256_sign = _mm256_and_si256(_mm256_srli_epi32(v256_in, 24), _mm256_set1_epi32(0x80));
+
+            // normalized and denormalized 8-bit floating point numbers
+            const __m256i v256_z = _mm256_sub_epi32(v256_abs, _mm256_set1_epi32((127 - traits::bias) << 23));
+            const __m256i v256_increment = _mm256_add_epi32(_mm256_set1_epi32((0x1 << (22 - bm_fp8)) - 1), _mm256_and_si256(_mm256_srli_epi32(v256_z, 23 - bm_fp8), _mm256_set1_epi32(0x1)));
+            const __m256i v256_normal = _mm256_srli_epi32(_mm256_add_epi32(v256_z, v256_increment), 23 - bm_fp8);
+            const __m256i v256_denormal = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_castsi256_ps(v256_abs), _mm256_set1_ps(scale_denormal)));
+            const __m256i is_denormal = _mm256_cmpgt_epi32(_mm256_set1_epi32(min_normal), v256_abs);
+            __m256i v256_code = _mm256_min_epu32(_mm256_blendv_epi8(v256_normal, v256_denormal, is_denormal), _mm256_set1_epi32(traits::max_code));
+
+            // NaNs
+            const __m256i is_nan = _mm256_cmpgt_epi32(v256_abs, _mm256_set1_epi32(0x7F800000));
+            v256_code = _mm256_blendv_epi8(v256_code, _mm256_set1_epi32(traits::nan_code), is_nan);
+
+            return _mm256_or_si256(v256_code, v256_sign);
+        }
+
+        //! \brief Conversion of floating point numbers into 8-bit floating point using SIMD intrinsics
+        //!
+        //! The output is bit-identical to that of the scalar code path (round to nearest even).
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence (behind the scaling factor)
+        //! \param n length of the input sequence
+        //! \param a scaling factor
+        //! \return number of elements that have been converted (multiple of 16)
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t compress_fp8_simd_intrinsics(const T* in, std::uint8_t* out, const std::size_t n, const float a)
+        {
+            constexpr std::size_t simd_width = 16;
+            std::size_t i = 0;
+
+            for (; (i + simd_width) <= n; i += simd_width)
+            {
+                __m256i v256_encoded[2];
+                for (std::size_t ii = 0; ii < 2; ++ii)
+                {
+                    __m256 v256_in;
+                    if (std::is_same<T, double>::value)
+                    {
+                        const __m128 v128_lo = _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&in[i + ii * 8])));
+                        const __m128 v128_hi = _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&in[i + ii * 8 + 4])));
+                        v256_in = _mm256_insertf128_ps(_mm256_castps128_ps256(v128_lo), v128_hi, 1);
+                    }
+                    else
+                    {
+                        v256_in = _mm256_loadu_ps(reinterpret_cast<const float*>(&in[i + ii * 8]));
+                    }
+
+                    v256_encoded[ii] = encode_fp8_simd_intrinsics(_mm256_mul_ps(v256_in, _mm256_set1_ps(a)));
+                }
+
+                // the packing happens within 128-bit lanes: the 4 32-bit words holding the output are 0, 4, 1 and 5
+                const __m256i v256_packed = _mm256_packus_epi16(_mm256_packus_epi32(v256_encoded[0], v256_encoded[1]), _mm256_setzero_si256());
+                const __m128i v128_out = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v256_packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), v128_out);
+            }
+
+            return i;
+        }
+
+    #if defined(FP_SIMD_F16C)
+        //! \brief Conversion of 8 8-bit floating point numbers into IEEE754 single precision using SIMD intrinsics (F16C)
+        //!
+        //! The bit patterns are moved into IEEE754 half precision numbers with an exponent bias of 15 (instead of 7 for E4M3):
+        //! the correction is part of the scaling factor.
+        //!
+        //! \param in 8-bit floating point numbers (lower 64 bits)
+        //! \param a scaling factor including the exponent bias correction (see 'fp8_rebias')
+        //! \return IEEE754 single precision numbers
+        FP_TARGET_AVX2 static inline __m256 decode_fp8_simd_intrinsics(const __m128i in, const float a)
+        {
+            using traits = internal::fp8_traits<BM, BE>;
+
+            // E5M2 is the upper half of IEEE754 half precision
+            __m128i v128_half = _mm_unpacklo_epi8(_mm_setzero_si128(), in);
+
+            if (!traits::has_infinity)
+            {
+                // E4M3: move exponent and mantissa by 1 bit (the sign is duplicated and then removed)
+                v128_half = _mm_and_si128(_mm_srai_epi16(v128_half, 1), _mm_set1_epi16(static_cast<std::int16_t>(0xBFFF)));
+                // no infinities: all bits set means NaN (infinities and NaNs of E5M2 are the same as for IEEE754 half precision),
+                // and only for NaNs adding 0x80 carries into the upper bit of the exponent
+                v128_half = _mm_or_si128(v128_half, _mm_and_si128(_mm_add_epi16(v128_half, _mm_set1_epi16(0x80)), _mm_set1_epi16(0x4000)));
+            }
+
+            return _mm256_mul_ps(_mm256_cvtph_ps(v128_half), _mm256_set1_ps(a));
+        }
+
+        //! \brief Conversion of 8-bit floating point numbers into floating point numbers using SIMD intrinsics (F16C)
+        //!
+        //! The output is bit-identical to that of the scalar code path (lookup table).
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence (behind the scaling factor)
+        //! \param out pointer to the output sequence
+        //! \param n length of the output sequence
+        //! \param a scaling factor
+        //! \return number of elements that have been converted (multiple of 8)
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t decompress_fp8_simd_intrinsics(const std::uint8_t* in, T* out, const std::size_t n, const float a)
+        {
+            constexpr std::size_t simd_width = 8;
+            const float a_rebias = a * fp8_rebias;
+            std::size_t i = 0;
+
+            for (; (i + simd_width) <= n; i += simd_width)
+            {
+                const __m256 v256_out = decode_fp8_simd_intrinsics(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&in[i])), a_rebias);
+
+                if (std::is_same<T, double>::value)
+                {
+                    _mm256_storeu_pd(reinterpret_cast<double*>(&out[i]), _mm256_cvtps_pd(_mm256_castps256_ps128(v256_out)));
+                    _mm256_storeu_pd(reinterpret_cast<double*>(&out[i + 4]), _mm256_cvtps_pd(_mm256_extractf128_ps(v256_out, 1)));
+                }
+                else
+                {
+                    _mm256_storeu_ps(reinterpret_cast<float*>(&out[i]), v256_out);
+                }
+            }
+
+            return i;
+        }
+    #endif
+
+    public:
+
+        //! \brief SIMD decompression of a stream
+        //!
+        //! Each call to 'load' returns 'width' consecutive elements of the stream as IEEE754 single floating point numbers
+        //! (scaling applied) in an AVX register.
+        //! Kernels can feed them directly into their computation without storing the decompressed stream.
+        //! Only bfloat16, IEEE754 half and 8-bit floating point (both require F16C), and the bit-packed formats are supported.
+        class simd_decoder
+        {
+        #if defined(FP_SIMD_F16C)
+            static_assert(is_bit_packed_type || internal::is_bfloat16_fp_type<BM, BE>::value || internal::is_ieee754_half_type<BM, BE>::value || internal::is_fp8_type<BM, BE>::value, "error: simd_decoder supports bfloat16, IEEE754 half, 8-bit floating point and bit-packed formats only");
+        #else
+            static_assert(is_bit_packed_type || internal::is_bfloat16_fp_type<BM, BE>::value, "error: simd_decoder supports bfloat16 and bit-packed formats only");
+        #endif
+
+            const type* ptr_in;
+            // number of elements that can be accessed: for the bit-packed formats, this includes the padding of the last package
+            const std::size_t num_elements;
+            float a;
+            const unpack_table& table;
+
+        public:
+
+            // number of elements per call to 'load'
+            static constexpr std::size_t width = 8;
+
+            //! \brief Constructor
+            //!
+            //! \param in pointer to the compressed stream
+            //! \param n length of the stream
+            simd_decoder(const type* in, const std::size_t n)
+                :
+                ptr_in(in),
+                num_elements(is_bit_packed_type ? ((n + pack_size - 1) / pack_size) * pack_size : n),
+                a(1.0F),
+                table(get_unpack_table())
+            {
+                if (is_bit_packed_type || has_half_scaling_factor || internal::is_fp8_type<BM, BE>::value)
+                {
+                    // recover the scaling factor (1st element) of the input stream and move on to the packages
+                    const float* fptr_in = reinterpret_cast<const float*>(in);
+                    a = fptr_in[0] * (internal::is_fp8_type<BM, BE>::value ? fp8_rebias : 1.0F);
+                    ptr_in = reinterpret_cast<const type*>(&fptr_in[2]);
+                }
+            }
+
+            //! \brief Decompress 'width' elements
+            //!
+            //! Elements beyond the end of the stream are not accessed: the respective lanes hold arbitrary values.
+            //!
+            //! \param i position of the first element
+            //! \return decompressed elements
+            FP_TARGET_AVX2 inline __m256 load(const std::size_t i) const
+            {
+                __m256i v256_element;
+
+                if (bits == 16 || bits == 8)
+                {
+                    // 8-bit and 16-bit words can be accessed directly
+                    using word_t = typename std::conditional<bits == 16, std::uint16_t, std::uint8_t>::type;
+                    const word_t* in = reinterpret_cast<const word_t*>(ptr_in);
+                    __m128i v128_in;
+                    if ((i + width) <= num_elements)
+                    {
+                        v128_in = (bits == 16 ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i])) : _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&in[i])));
+                    }
+                    else
+                    {
+                        // do not read beyond the end of the stream
+                        alignas(internal::alignment) word_t buffer[16] = {0};
+                        for (std::size_t ii = i; ii < num_elements; ++ii)
+                        {
+                            buffer[ii - i] = in[ii];
+                        }
+                        v128_in = _mm_load_si128(reinterpret_cast<const __m128i*>(&buffer[0]));
+                    }
+                #if defined(FP_SIMD_F16C)
+                    if (internal::is_ieee754_half_type<BM, BE>::value)
+                    {
+                        return _mm256_mul_ps(_mm256_cvtph_ps(v128_in), _mm256_set1_ps(a));
+                    }
+                    else if (internal::is_fp8_type<BM, BE>::value)
+                    {
+                        return decode_fp8_simd_intrinsics(v128_in, a);
+                    }
+                #endif
+                    v256_element = (bits == 16 ? _mm256_cvtepu16_epi32(v128_in) : _mm256_cvtepu8_epi32(v128_in));
+                }
+                else
+                {
+                    const pack_t* in = reinterpret_cast<const pack_t*>(ptr_in);
+                    const std::size_t k = i / pack_size;
+                    const std::size_t j0 = i % pack_size;
+                    __m256i v256_in;
+                    if ((k + 4) * pack_size <= num_elements)
+                    {
+                        v256_in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[k]));
+                    }
+                    else
+                    {
+                        // do not read beyond the last package
+                        alignas(internal::alignment) pack_t buffer[4] = {0, 0, 0, 0};
+                        for (std::size_t kk = k; (kk * pack_size) < num_elements; ++kk)
+                        {
+                            buffer[kk - k] = in[kk];
+                        }
+                        v256_in = _mm256_load_si256(reinterpret_cast<const __m256i*>(&buffer[0]));
+                    }
+                    v256_element = unpack_simd_intrinsics(v256_in, table, j0);
+                }
+
+                if (internal::is_bfloat16_fp_type<BM, BE>::value)
+                {
+                    // recover the upper 16 bits
+                    return _mm256_castsi256_ps(_mm256_slli_epi32(v256_element, 16));
+                }
+                else
+                {
+                    return _mm256_mul_ps(decode_simd_intrinsics(v256_element), _mm256_set1_ps(a));
+                }
+            }
+        };
+    #endif
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // HELPER: fixed point
+    ////////////////////////////////////////////////////////////////////////////////////
+    namespace internal
+    {
+    #if defined(FP_SIMD_AVX2)
+        namespace 
+        {
+            template <typename T, typename TT>
+            constexpr bool specialization_available()
+            {
+                constexpr bool double_or_float_to_uint8 = (std::is_same<T, double>::value || std::is_same<T, float>::value) && std::is_same<TT, std::uint8_t>::value;
+                constexpr bool uint8_to_double_or_float = std::is_same<T, std::uint8_t>::value && (std::is_same<TT, double>::value || std::is_same<TT, float>::value);
+                constexpr bool uint8_to_int32 = std::is_same<T, std::uint8_t>::value && std::is_same<T, std::int32_t>::value;
+                constexpr bool uint8_to_int16 = std::is_same<T, std::uint8_t>::value && std::is_same<T, std::int16_t>::value;
+                return double_or_float_to_uint8 || uint8_to_double_or_float || uint8_to_int32 || uint8_to_int16;
+            }
+        }
+
+        //! \brief Recode between different data types using SIMD intrinsics
+        //!
+        //! Supported: double <-> uint8_t, uint8_t -> uint[16,32]_t
+        //!
+        //! \tparam T 'in' data type
+        //! \tparam TT 'out' data type
+        //! \param in pointer to the input sequence of type 'T'
+        //! \param out pointer to the output sequence of type 'TT'
+        //! \param n length of the input sequence
+        //! \param a (optional) rescaling factor
+        //! \param b (optional) rescaling factor
+        template <typename T, typename TT, typename X = typename std::enable_if<!(specialization_available<T, TT>())>::type>
+        FP_TARGET_AVX2 static void recode_simd_intrinsics(const T* in, TT* out, const std::size_t n, const float a = 0.0F, const float b = 1.0F)
+        {
+            std::cerr << "error: recode_simd_intrinsics() is not implemented for these data types" << std::endl;
+        }
+
+        template <typename T, typename TT, typename X = typename std::enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value>::type, typename Y = typename std::enable_if<std::is_same<TT, std::uint8_t>::value>::type>
+        FP_TARGET_AVX2 inline void recode_simd_intrinsics(const T* in, std::uint8_t* out, const std::size_t n, const float a, const float b, const X* dummy = nullptr)
+        {
+            if (!std::is_same<T, double>::value && !std::is_same<T, float>::value)
+            {
+                std::cerr << "error: floating point format is not supported" << std::endl;
+                return;
+            }
+
+            // 32 8-bit words fit into an AVX2 register
+            constexpr std::size_t chunk_size = 32;
+            alignas(alignment) T buffer_in[chunk_size];
+            alignas(alignment) std::uint8_t buffer_out[chunk_size];
+
+            for (std::size_t i = 0; i < n; i += chunk_size)
+            {
+                // determine the number of elements to be compressed / packed
+                const bool full_chunk = (std::min(n - i, chunk_size) == chunk_size ? true : false);
+                const T* ptr_in = &in[i];
+                if (!full_chunk)
+                {
+                    // we want to read 'chunk_size' contiguous words: load the remainder loop data into the buffer...
+                    for (std::size_t ii = 0; ii < (n - i); ++ii)
+                    {
+                        buffer_in[ii] = in[i + ii];
+                    }
+                    // and switch to the buffer for reading
+                    ptr_in = &buffer_in[0];
+                }
+                
+                __m256 v256_in_1, v256_in_2, v256_in_3, v256_in_4;
+                if (std::is_same<T, double>::value)
+                {
+                    // load 8 chunks of 4 'double' words, for a total of 32 'double's, and convert them to 'float'
+                    v256_in_1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[0])))),
+                                                     _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[4]))), 1);
+                    v256_in_2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[8])))),
+                                                     _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[12]))), 1);
+                    v256_in_3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[16])))),
+                                                     _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[20]))), 1);
+                    v256_in_4 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[24])))),
+                                                     _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[28]))), 1);
+                }
+                else
+                {
+                    // load 4 chunks of 8 'float' words, for a total of 32 'float's
+                    v256_in_1 = _mm256_loadu_ps(reinterpret_cast<const float*>(&ptr_in[0]));
+                    v256_in_2 = _mm256_loadu_ps(reinterpret_cast<const float*>(&ptr_in[8]));
+                    v256_in_3 = _mm256_loadu_ps(reinterpret_cast<const float*>(&ptr_in[16]));
+                    v256_in_4 = _mm256_loadu_ps(reinterpret_cast<const float*>(&ptr_in[24]));
+                }
+
+                // apply the rescaling so that the ouput is within the range 0.0 .. 255.0
+                __m256 v256_unpacked_1 = _mm256_mul_ps(_mm256_sub_ps(v256_in_1, _mm256_set1_ps(a)), _mm256_set1_ps(b));
+                __m256 v256_unpacked_2 = _mm256_mul_ps(_mm256_sub_ps(v256_in_2, _mm256_set1_ps(a)), _mm256_set1_ps(b));
+                __m256 v256_unpacked_3 = _mm256_mul_ps(_mm256_sub_ps(v256_in_3, _mm256_set1_ps(a)), _mm256_set1_ps(b));
+                __m256 v256_unpacked_4 = _mm256_mul_ps(_mm256_sub_ps(v256_in_4, _mm256_set1_ps(a)), _mm256_set1_ps(b));
+
+                // convert to integer and use unsigned saturation for the packing: 32-bits -> 16-bits -> 8-bit
+                __m256i v256_packedlo = _mm256_packus_epi32(_mm256_cvtps_epi32(v256_unpacked_1), _mm256_cvtps_epi32(v256_unpacked_2));
+                __m256i v256_packedhi = _mm256_packus_epi32(_mm256_cvtps_epi32(v256_unpacked_3), _mm256_cvtps_epi32(v256_unpacked_4));
+                // permute the output elements to recover the original order
+                __m256i v256_packed = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(v256_packedlo, v256_packedhi), _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+
+                // flush the compressed / packed data to the output
+                if (full_chunk)
+                {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[i]), v256_packed);
+                }
+                else
+                {
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(&buffer_out[0]), v256_packed);
+                    for (std::size_t ii = 0; ii < (n - i); ++ii)
+                    {
+                        out[i + ii] = buffer_out[ii];
+                    }
+                }
+            }
+        }
+
+        template <typename T, typename TT, typename X = typename std::enable_if<std::is_same<T, std::uint8_t>::value>::type, typename Y = typename std::enable_if<std::is_same<TT, double>::value || std::is_same<TT, float>::value>::type>
+        FP_TARGET_AVX2 inline void recode_simd_intrinsics(const T* in, TT* out, const std::size_t n, const float a, const float b, const X* dummy = nullptr)
+        {
+            if (!std::is_same<TT, double>::value && !std::is_same<TT, float>::value)
+            {
+                std::cerr << "error: floating point format is not supported" << std::endl;
+                return;
+            }
+
+            // 32 8-bit words fit into an AVX2 register
+            constexpr std::size_t chunk_size = 32;
+            alignas(alignment) TT buffer_out[chunk_size];
+
+            for (std::size_t i = 0; i < n; i += chunk_size)
+            {
+                // load 256-bit word and permute the elements to match the reordering while unpacking: 
+                // this is always safe if data allocation happened with the 'memory_footprint*' method below
+                __m256i v256_packed = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i])), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+                // unpack 8-bit into 16-bit words
+                __m256i v256_unpacked_lo = _mm256_unpacklo_epi8(v256_packed, _mm256_setzero_si256());
+                __m256i v256_unpacked_hi = _mm256_unpackhi_epi8(v256_packed, _mm256_setzero_si256());
+
+                // unpack into 32-bit words
+                __m256i v256_unpacked[4];
+                v256_unpacked[0] = _mm256_unpacklo_epi16(v256_unpacked_lo, _mm256_setzero_si256());
+                v256_unpacked[1] = _mm256_unpackhi_epi16(v256_unpacked_lo, _mm256_setzero_si256());
+                v256_unpacked[2] = _mm256_unpacklo_epi16(v256_unpacked_hi, _mm256_setzero_si256());
+                v256_unpacked[3] = _mm256_unpackhi_epi16(v256_unpacked_hi, _mm256_setzero_si256());
+
+                // determine the number of elements to be unpacked / decompressed
+                const bool full_chunk = (std::min(n - i, chunk_size) == chunk_size ? true : false);
+                // write the output to the buffer in case of the loop remainder
+                TT* ptr_out = (full_chunk ? &out[i] : &buffer_out[0]);
+
+                if (std::is_same<TT, double>::value)
+                {
+                    for (std::size_t ii = 0; ii < 4; ++ii)
+                    {
+                        // convert 32-bit integers to 'double' and rescale
+                        __m256d tmp_1 = _mm256_fmadd_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(v256_unpacked[ii], 0)), _mm256_set1_pd(b), _mm256_set1_pd(a));
+                        __m256d tmp_2 = _mm256_fmadd_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(v256_unpacked[ii], 1)), _mm256_set1_pd(b), _mm256_set1_pd(a));
+                        _mm256_storeu_pd(reinterpret_cast<double*>(&ptr_out[ii * 8 + 0]), tmp_1);
+                        _mm256_storeu_pd(reinterpret_cast<double*>(&ptr_out[ii * 8 + 4]), tmp_2);
+                    }
+                }
+                else
+                {
+                    for (std::size_t ii = 0; ii < 4; ++ii)
+                    {
+                        // convert 32-bit integers to 'float' and rescale
+                        __m256 tmp = _mm256_fmadd_ps(_mm256_cvtepi32_ps(v256_unpacked[ii]), _mm256_set1_ps(b), _mm256_set1_ps(a));
+                        _mm256_storeu_ps(reinterpret_cast<float*>(&ptr_out[ii * 8]), tmp);
+                    }
+                }
+
+                // flush the buffer to the output if necessary
+                if (!full_chunk)
+                {
+                    for (std::size_t ii = 0; ii < (n - i); ++ii)
+                    {
+                        out[i + ii] = buffer_out[ii];
+                    }
+                }
+            }
+        }
+
+        template <>
+        FP_TARGET_AVX2 inline void recode_simd_intrinsics<std::uint8_t, std::int32_t>(const std::uint8_t* in, std::int32_t* out, const std::size_t n, const float a, const float b)
+        {
+            // 32 8-bit words fit into an AVX2 register
+            constexpr std::size_t chunk_size = 32;
+            alignas(alignment) std::int32_t buffer_out[chunk_size];
+
+            for (std::size_t i = 0; i < n; i += chunk_size)
+            {
+                // load 256-bit word and permute the elements to match the reordering while unpacking: 
+                // this is always safe if data allocation happened with the 'memory_footprint*' method below
+                __m256i v256_packed = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i])), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+                // unpack 8-bit into 16-bit words
+                __m256i v256_unpacked_lo = _mm256_unpacklo_epi8(v256_packed, _mm256_setzero_si256());
+                __m256i v256_unpacked_hi = _mm256_unpackhi_epi8(v256_packed, _mm256_setzero_si256());
+
+                // unpack into 32-bit words
+                __m256i v256_unpacked[4];
+                v256_unpacked[0] = _mm256_unpacklo_epi16(v256_unpacked_lo, _mm256_setzero_si256());
+                v256_unpacked[1] = _mm256_unpackhi_epi16(v256_unpacked_lo, _mm256_setzero_si256());
+                v256_unpacked[2] = _mm256_unpacklo_epi16(v256_unpacked_hi, _mm256_setzero_si256());
+                v256_unpacked[3] = _mm256_unpackhi_epi16(v256_unpacked_hi, _mm256_setzero_si256());
+
+                // determine the number of elements to be unpacked / decompressed
+                const bool full_chunk = (std::min(n - i, chunk_size) == chunk_size ? true : false);
+                // write the output to the buffer in case of the loop remainder
+                std::int32_t* ptr_out = (full_chunk ? &out[i] : &buffer_out[0]);
+
+                // output the 32-bit integers WITHOUT converting to 'double'
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[0]), v256_unpacked[0]);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[8]), v256_unpacked[1]);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[16]), v256_unpacked[2]);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[24]), v256_unpacked[3]);
+
+                // flush the buffer to the output if necessary
+                if (!full_chunk)
+                {
+                    for (std::size_t ii = 0; ii < (n - i); ++ii)
+                    {
+                        out[i + ii] = buffer_out[ii];
+                    }
+                }
+            }
+        }
+        
+        template <>
+        FP_TARGET_AVX2 inline void recode_simd_intrinsics<std::uint8_t, std::int16_t>(const std::uint8_t* in, std::int16_t* out, const std::size_t n, const float a, const float b)
+        {
+            // 32 8-bit words fit into an AVX2 register
+            constexpr std::size_t chunk_size = 32;
+            alignas(alignment) std::int16_t buffer_out[chunk_size];
+
+            for (std::size_t i = 0; i < n; i += chunk_size)
+            {
+                // load 256-bit word and permute the elements to match the reordering while unpacking: 
+                // this is always safe if data allocation happened with the 'memory_footprint*' method below
+                __m256i v256_packed = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i])), _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7));
+                // unpack 8-bit into 16-bit words
+                __m256i v256_unpacked_lo = _mm256_unpacklo_epi8(v256_packed, _mm256_setzero_si256());
+                __m256i v256_unpacked_hi = _mm256_unpackhi_epi8(v256_packed, _mm256_setzero_si256());
+
+                // determine the number of elements to be unpacked / decompressed
+                const bool full_chunk = (std::min(n - i, chunk_size) == chunk_size ? true : false);
+                // write the output to the buffer in case of the loop remainder
+                std::int16_t* ptr_out = (full_chunk ? &out[i] : &buffer_out[0]);
+
+                // output the 16-bit integers WITHOUT any further conversion
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[0]), v256_unpacked_lo);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[16]), v256_unpacked_hi);
+                
+                // flush the buffer to the output if necessary
+                if (!full_chunk)
+                {
+                    for (std::size_t ii = 0; ii < (n - i); ++ii)
+                    {
+                        out[i + ii] = buffer_out[ii];
+                    }
+                }
+            }
+        }
+        #endif
+    
+        //! \brief Encode floating point into fixed point numbers
+        //!
+        //! \tparam T floating point data type
+        //! \tparam TT 'out' data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence
+        //! \param n length of the input sequence
+        //! \param a rescaling factor
+        //! \param b rescaling factor
+        template <typename T, typename TT>
+        static void encode_fixed_point_kernel(const T* in, TT* out, const std::size_t n, const T a, const T b)
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed as input");
+            static_assert(std::is_integral<TT>::value, "error: only integers are allowed as output");
+
+            if (n == 0) return;
+            
+            // the scaling parameters 'a' and 'b' are stored together with the output bitstream
+            float* fptr_out = reinterpret_cast<float*>(out);
+            fptr_out[0] = static_cast<float>(a);
+            // b = 0 marks constant input: the step is zero so that decoding gives exactly 'a'
+            fptr_out[1] = (b > static_cast<T>(0.0) ? static_cast<float>(1.0 / b) : 0.0F);
+            TT* ptr_out = reinterpret_cast<TT*>(&fptr_out[2]);
             
-        #if defined(__AVX2__) || defined(__AVX512F__)
+        #if defined(FP_SIMD_AVX2)
             // use SIMD intrinsics for the recoding only in case of 8-bit fixed point representation
             constexpr bool use_simd_intrinsics = std::is_same<TT, std::uint8_t>::value;
-            if (use_simd_intrinsics)
+            if (use_simd_intrinsics && use_simd_isa(simd_isa::avx2))
+            {
+                recode_simd_intrinsics<T, TT>(in, ptr_out, n, a, b);
+            }
+            else
+        #endif
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    ptr_out[i] = (in[i] - a) * b;
+                }
+            }
+        }
+
+        //! \brief Encode floating point into fixed point numbers
+        //!
+        //! \tparam T 'in' data type
+        //! \tparam TT floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence
+        //! \param n length of the input sequence
+        template <typename T, typename TT>
+        static void decode_fixed_point_kernel(const T* in, TT* out, const std::size_t n)
+        {
+            static_assert(std::is_integral<T>::value, "error: only integers are allowed as input");
+            static_assert(std::is_same<TT, double>::value || std::is_same<TT, float>::value, "error: only 'double' or 'float' are allowed as output");
+
+            if (n == 0) return;
+            
+            const float* fptr_in = reinterpret_cast<const float*>(in);
+            const float a = fptr_in[0];
+            const float b = fptr_in[1];
+
+        #if defined(FP_SIMD_AVX2)
+            constexpr bool use_simd_intrinsics = std::is_same<T, std::uint8_t>::value;
+            if (use_simd_intrinsics && use_simd_isa(simd_isa::avx2))
+            {
+                recode_simd_intrinsics<std::uint8_t, TT>(reinterpret_cast<const std::uint8_t*>(&fptr_in[2]), out, n, a, b);
+            }
+            else
+        #endif
+            {
+                const T* ptr_in = reinterpret_cast<const T*>(&fptr_in[2]);
+
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    out[i] = static_cast<float>(ptr_in[i]) * b + (b * 0.5F + a);
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // HELPER: fixed point with 4 bit
+    ////////////////////////////////////////////////////////////////////////////////////
+    namespace internal
+    {
+    #if defined(FP_SIMD_AVX2)
+        //! \brief Unpack 32 4-bit into 8-bit unsigned integers using SIMD intrinsics
+        //!
+        //! \param in 16 bytes holding 32 4-bit integers
+        //! \return 32 8-bit integers
+        FP_TARGET_AVX2 static inline __m256i unpack_uint4_simd_intrinsics(const __m128i in)
+        {
+            const __m128i mask = _mm_set1_epi8(0xF);
+            const __m128i lo = _mm_and_si128(in, mask);
+            const __m128i hi = _mm_and_si128(_mm_srli_epi16(in, 4), mask);
+            // interleave lower and upper halves to recover the original order
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi8(lo, hi)), _mm_unpackhi_epi8(lo, hi), 1);
+        }
+
+        //! \brief Unpack 4-bit into 8-bit unsigned integers using SIMD intrinsics
+        //!
+        //! \param in pointer to the packed input sequence
+        //! \param out pointer to the output sequence
+        //! \param n number of 4-bit integers
+        //! \return number of 4-bit integers unpacked (a multiple of 32)
+        FP_TARGET_AVX2 static std::size_t unpack_uint4_simd_intrinsics(const uint4x2_t* in, std::uint8_t* out, const std::size_t n)
+        {
+            // 32 4-bit integers fit into 128 bits
+            constexpr std::size_t chunk_size = 32;
+            const std::size_t n_simd = (n / chunk_size) * chunk_size;
+
+            for (std::size_t i = 0; i < n_simd; i += chunk_size)
+            {
+                const __m256i v256_unpacked = unpack_uint4_simd_intrinsics(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i / 2])));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[i]), v256_unpacked);
+            }
+
+            return n_simd;
+        }
+
+        //! \brief Decode 4-bit fixed point into floating point numbers using SIMD intrinsics
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the packed input sequence
+        //! \param out pointer to the output sequence
+        //! \param n length of the output sequence
+        //! \param a rescaling factor (offset)
+        //! \param b rescaling factor (step)
+        //! \return number of elements decoded (a multiple of 32)
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t decode_fixed_point_4bit_simd_intrinsics(const uint4x2_t* in, T* out, const std::size_t n, const float a, const float b)
+        {
+            // 32 4-bit integers fit into 128 bits
+            constexpr std::size_t chunk_size = 32;
+            const std::size_t n_simd = (n / chunk_size) * chunk_size;
+
+            for (std::size_t i = 0; i < n_simd; i += chunk_size)
+            {
+                const __m256i v256_unpacked = unpack_uint4_simd_intrinsics(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i / 2])));
+                const __m128i v128_unpacked[2] = {_mm256_castsi256_si128(v256_unpacked), _mm256_extracti128_si256(v256_unpacked, 1)};
+
+                for (std::size_t ii = 0; ii < 4; ++ii)
+                {
+                    // convert 8 8-bit integers to 'float' and rescale
+                    const __m128i tmp = (ii % 2 == 0 ? v128_unpacked[ii / 2] : _mm_srli_si128(v128_unpacked[ii / 2], 8));
+                    const __m256 v256_out = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(tmp)), _mm256_set1_ps(b), _mm256_set1_ps(a));
+
+                    if (std::is_same<T, double>::value)
+                    {
+                        _mm256_storeu_pd(reinterpret_cast<double*>(&out[i + ii * 8 + 0]), _mm256_cvtps_pd(_mm256_castps256_ps128(v256_out)));
+                        _mm256_storeu_pd(reinterpret_cast<double*>(&out[i + ii * 8 + 4]), _mm256_cvtps_pd(_mm256_extractf128_ps(v256_out, 1)));
+                    }
+                    else
+                    {
+                        _mm256_storeu_ps(reinterpret_cast<float*>(&out[i + ii * 8]), v256_out);
+                    }
+                }
+            }
+
+            return n_simd;
+        }
+    #endif
+
+        //! \brief Unpack 4-bit into 8-bit unsigned integers
+        //!
+        //! \param in pointer to the packed input sequence
+        //! \param out pointer to the output sequence
+        //! \param n number of 4-bit integers
+        static inline void unpack_uint4_kernel(const uint4x2_t* in, std::uint8_t* out, const std::size_t n)
+        {
+            std::size_t i = 0;
+
+        #if defined(FP_SIMD_AVX2)
+            if (use_simd_isa(simd_isa::avx2))
+            {
+                i = unpack_uint4_simd_intrinsics(in, out, n);
+            }
+        #endif
+
+            for ( ; i < n; ++i)
+            {
+                out[i] = (in[i / 2].value >> (4 * (i % 2))) & 0xF;
+            }
+        }
+
+        //! \brief Encode floating point into 4-bit fixed point numbers
+        //!
+        //! Other than for the 8 and 16 bit fixed point numbers, the encoding rounds to the nearest integer.
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence
+        //! \param n length of the input sequence
+        //! \param a rescaling factor
+        //! \param b rescaling factor
+        template <typename T>
+        static void encode_fixed_point_4bit_kernel(const T* in, uint4x2_t* out, const std::size_t n, const T a, const T b)
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed as input");
+
+            if (n == 0) return;
+
+            // the scaling parameters 'a' and 'b' are stored together with the output bitstream
+            float* fptr_out = reinterpret_cast<float*>(out);
+            fptr_out[0] = static_cast<float>(a);
+            // b = 0 marks constant input: the step is zero so that decoding gives exactly 'a'
+            fptr_out[1] = (b > static_cast<T>(0.0) ? static_cast<float>(1.0 / b) : 0.0F);
+            uint4x2_t* ptr_out = reinterpret_cast<uint4x2_t*>(&fptr_out[2]);
+
+            constexpr T f_0_5 = static_cast<T>(0.5);
+            for (std::size_t i = 0; i < n; i += 2)
+            {
+                const std::uint32_t lo = std::min(0xFU, static_cast<std::uint32_t>((in[i] - a) * b + f_0_5));
+                const std::uint32_t hi = ((i + 1) < n ? std::min(0xFU, static_cast<std::uint32_t>((in[i + 1] - a) * b + f_0_5)) : 0);
+                ptr_out[i / 2].value = static_cast<std::uint8_t>(lo | (hi << 4));
+            }
+        }
+
+        //! \brief Decode 4-bit fixed point into floating point numbers
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the output sequence
+        //! \param n length of the output sequence
+        template <typename T>
+        static void decode_fixed_point_4bit_kernel(const uint4x2_t* in, T* out, const std::size_t n)
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed as output");
+
+            if (n == 0) return;
+
+            const float* fptr_in = reinterpret_cast<const float*>(in);
+            const float a = fptr_in[0];
+            const float b = fptr_in[1];
+            const uint4x2_t* ptr_in = reinterpret_cast<const uint4x2_t*>(&fptr_in[2]);
+
+            std::size_t i = 0;
+
+        #if defined(FP_SIMD_AVX2)
+            if (use_simd_isa(simd_isa::avx2))
+            {
+                i = decode_fixed_point_4bit_simd_intrinsics(ptr_in, out, n, a, b);
+            }
+        #endif
+
+            for ( ; i < n; ++i)
+            {
+                out[i] = static_cast<float>((ptr_in[i / 2].value >> (4 * (i % 2))) & 0xF) * b + a;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // SPECIALIZATIONS: fixed precision with 8 and 16 bit
+    ////////////////////////////////////////////////////////////////////////////////////
+    template <std::uint32_t BM>
+    class fp_stream<BM, 0>
+    {
+        static_assert(BM == 8 || BM == 16, "error: only BM=8 or BM=16 is supported");
+
+        // do not allow instantiation
+        fp_stream() { ; }
+
+    public:
+
+        static constexpr bool is_fixed_point_type = true;
+        static constexpr bool is_bit_packed_type = false;
+
+        static constexpr std::uint32_t bm = BM;
+        static constexpr std::uint32_t be = 0;
+        static constexpr std::uint32_t bits = BM;
+
+        using type = typename std::conditional<(BM == 16), std::uint16_t, std::uint8_t>::type;
+
+        //! \brief Number of bytes needed to compress a sequence of 'n' words
+        //! 
+        //! \param n number of floating point numbers to be compressed
+        //! \return number of bytes
+        static std::size_t memory_footprint_bytes(const std::size_t n)
+        {
+            if (n == 0) return 0;
+
+            // we need to store the scaling factors as well
+            const std::size_t n_scaling_factor = 2;
+            // number of bytes needed
+            return n_scaling_factor * sizeof(float) + n * sizeof(type);
+        }
+
+        //! \brief Number of elements needed to compress a sequence of 'n' words
+        //!
+        //! \param n number of floating point numbers to be compressed
+        //! \return number of elements
+        static std::size_t memory_footprint_elements(const std::size_t n)
+        {
+            // number of elements
+            return memory_footprint_bytes(n) / sizeof(type);
+        }
+
+        //! \brief Compression of floating point numbers
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the compressed output bit stream
+        //! \param n length of the input sequence
+        template <typename T>
+        static void compress(const T* in, type* out, const std::size_t n)
+        {
+            using namespace internal;
+
+            if (n == 0) return;
+
+            // unsigned integer conversion: [minimum, maximum] -> [0, max_int]
+            const T minimum = scan_min(in, n);
+            const T maximum = scan_max(in, n);
+        
+            const T a = minimum;
+            // constant input: all words are encoded as zero with step zero, and decoded as 'a'
+            const T b = (maximum > a ? std::numeric_limits<type>::max() / (maximum - a) : static_cast<T>(0.0));
+
+            encode_fixed_point_kernel(in, out, n, a, b);
+        }
+
+        //! \brief Decompression of compressed floating point numbers
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the compressed input bit stream
+        //! \param out pointer to the decompressed output sequence
+        //! \param n length of the output sequence
+        template <typename T>
+        static void decompress(const type* in, T* out, const std::size_t n)
+        {
+            using namespace internal;
+
+            decode_fixed_point_kernel(in, out, n);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // SPECIALIZATIONS: fixed precision with 4 bit
+    ////////////////////////////////////////////////////////////////////////////////////
+    template <>
+    class fp_stream<4, 0>
+    {
+        // do not allow instantiation
+        fp_stream() { ; }
+
+    public:
+
+        static constexpr bool is_fixed_point_type = true;
+        static constexpr bool is_bit_packed_type = false;
+
+        static constexpr std::uint32_t bm = 4;
+        static constexpr std::uint32_t be = 0;
+        static constexpr std::uint32_t bits = 4;
+
+        // two 4-bit integers per byte
+        using type = uint4x2_t;
+
+        //! \brief Number of bytes needed to compress a sequence of 'n' words
+        //! 
+        //! \param n number of floating point numbers to be compressed
+        //! \return number of bytes
+        static std::size_t memory_footprint_bytes(const std::size_t n)
+        {
+            if (n == 0) return 0;
+
+            // we need to store the scaling factors as well
+            const std::size_t n_scaling_factor = 2;
+            // number of bytes needed
+            return n_scaling_factor * sizeof(float) + ((n + 1) / 2) * sizeof(type);
+        }
+
+        //! \brief Number of elements needed to compress a sequence of 'n' words
+        //!
+        //! \param n number of floating point numbers to be compressed
+        //! \return number of elements
+        static std::size_t memory_footprint_elements(const std::size_t n)
+        {
+            // number of elements
+            return memory_footprint_bytes(n) / sizeof(type);
+        }
+
+        //! \brief Compression of floating point numbers
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the compressed output bit stream
+        //! \param n length of the input sequence
+        template <typename T>
+        static void compress(const T* in, type* out, const std::size_t n)
+        {
+            using namespace internal;
+
+            if (n == 0) return;
+
+            // unsigned integer conversion: [minimum, maximum] -> [0, 15]
+            const T minimum = scan_min(in, n);
+            const T maximum = scan_max(in, n);
+        
+            const T a = minimum;
+            // constant input: all words are encoded as zero with step zero, and decoded as 'a'
+            const T b = (maximum > a ? static_cast<T>(0xF) / (maximum - a) : static_cast<T>(0.0));
+
+            encode_fixed_point_4bit_kernel(in, out, n, a, b);
+        }
+
+        //! \brief Decompression of compressed floating point numbers
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the compressed input bit stream
+        //! \param out pointer to the decompressed output sequence
+        //! \param n length of the output sequence
+        template <typename T>
+        static void decompress(const type* in, T* out, const std::size_t n)
+        {
+            using namespace internal;
+
+            decode_fixed_point_4bit_kernel(in, out, n);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////
+    // HELPER: block floating point
+    ////////////////////////////////////////////////////////////////////////////////////
+    namespace internal
+    {
+        //! \brief Shared exponent of a group of block floating point numbers
+        //!
+        //! Numbers are decoded as 'mantissa * 2^(exponent - 127)'.
+        //! The exponent is taken from the bit pattern of the absolute maximum within the group,
+        //! so that all mantissas are below 2^BM in magnitude (rounding up to 2^BM saturates).
+        //!
+        //! \tparam BM bits mantissa (without the sign)
+        //! \param abs_max bit pattern of the absolute maximum (IEEE754 single) within the group
+        //! \return biased exponent
+        template <std::uint32_t BM>
+        static inline std::uint32_t block_exponent_from_abs_max(const std::uint32_t abs_max)
+        {
+            // abs_max < 2^((abs_max >> 23) - 126): zeros and very small numbers use the smallest exponent
+            const std::int32_t exponent = static_cast<std::int32_t>(abs_max >> 23) + 1 - static_cast<std::int32_t>(BM);
+            return static_cast<std::uint32_t>(exponent > 1 ? exponent : 1);
+        }
+
+        //! \brief Power of 2 from a biased exponent
+        //!
+        //! \param exponent biased exponent (between 1 and 254)
+        //! \return 2^(exponent - 127)
+        static inline float block_scaling_factor(const std::uint32_t exponent)
+        {
+            const std::uint32_t y = exponent << 23;
+            float out;
+            std::memcpy(&out, &y, sizeof(float));
+            return out;
+        }
+
+    #if defined(FP_SIMD_AVX2)
+        //! \brief Sign extension of 8 block floating point mantissas to 32-bit integers
+        //!
+        //! \tparam TT integer data type of the mantissas
+        //! \param in mantissas (lower 64 or 128 bits)
+        //! \return 32-bit integers
+        template <typename TT>
+        FP_TARGET_AVX2 static inline __m256i block_mantissa_simd_intrinsics(const __m128i in)
+        {
+            return (sizeof(TT) == 1 ? _mm256_cvtepi8_epi32(in) : _mm256_cvtepi16_epi32(in));
+        }
+
+        //! \brief Encode floating point into block floating point numbers using SIMD intrinsics
+        //!
+        //! Only complete groups are processed. The output is bit-identical to that of the scalar code path.
+        //!
+        //! \tparam BM bits mantissa (without the sign)
+        //! \tparam G group size (multiple of 16)
+        //! \tparam T floating point data type
+        //! \tparam TT integer data type of the mantissas
+        //! \param in pointer to the input sequence
+        //! \param exponent pointer to the shared exponents
+        //! \param mantissa pointer to the mantissas
+        //! \param n length of the input sequence
+        //! \return number of elements that have been encoded (multiple of 'G')
+        template <std::uint32_t BM, std::uint32_t G, typename T, typename TT>
+        FP_TARGET_AVX2 static std::size_t encode_block_fp_simd_intrinsics(const T* in, std::uint8_t* exponent, TT* mantissa, const std::size_t n)
+        {
+            const __m256 limit = _mm256_set1_ps(static_cast<float>((0x1U << BM) - 1));
+            std::size_t i = 0;
+
+            for (std::size_t k = 0; (i + G) <= n; i += G, ++k)
+            {
+                // absolute maximum within the group: compare the bit patterns
+                __m256 v256_in[G / 8];
+                __m256i v256_abs_max = _mm256_setzero_si256();
+                for (std::size_t ii = 0; ii < (G / 8); ++ii)
+                {
+                    if (std::is_same<T, double>::value)
+                    {
+                        const __m128 v128_lo = _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&in[i + ii * 8])));
+                        const __m128 v128_hi = _mm256_cvtpd_ps(_mm256_loadu_pd(reinterpret_cast<const double*>(&in[i + ii * 8 + 4])));
+                        v256_in[ii] = _mm256_insertf128_ps(_mm256_castps128_ps256(v128_lo), v128_hi, 1);
+                    }
+                    else
+                    {
+                        v256_in[ii] = _mm256_loadu_ps(reinterpret_cast<const float*>(&in[i + ii * 8]));
+                    }
+                    v256_abs_max = _mm256_max_epu32(v256_abs_max, _mm256_and_si256(_mm256_castps_si256(v256_in[ii]), _mm256_set1_epi32(0x7FFFFFFF)));
+                }
+                __m128i v128_abs_max = _mm_max_epu32(_mm256_castsi256_si128(v256_abs_max), _mm256_extracti128_si256(v256_abs_max, 1));
+                v128_abs_max = _mm_max_epu32(v128_abs_max, _mm_shuffle_epi32(v128_abs_max, 0x4E));
+                v128_abs_max = _mm_max_epu32(v128_abs_max, _mm_shuffle_epi32(v128_abs_max, 0xB1));
+
+                const std::uint32_t e = block_exponent_from_abs_max<BM>(static_cast<std::uint32_t>(_mm_cvtsi128_si32(v128_abs_max)));
+                exponent[k] = static_cast<std::uint8_t>(e);
+                const __m256 scale = _mm256_set1_ps(block_scaling_factor(254 - e));
+
+                for (std::size_t ii = 0; ii < (G / 8); ii += 2)
+                {
+                    __m256i v256_mantissa[2];
+                    for (std::size_t jj = 0; jj < 2; ++jj)
+                    {
+                        // same operand order as in the scalar code path: NaNs saturate
+                        const __m256 v256_scaled = _mm256_mul_ps(v256_in[ii + jj], scale);
+                        v256_mantissa[jj] = _mm256_cvtps_epi32(_mm256_max_ps(_mm256_min_ps(v256_scaled, limit), _mm256_sub_ps(_mm256_setzero_ps(), limit)));
+                    }
+
+                    // the packing happens within 128-bit lanes
+                    const __m256i v256_packed = _mm256_packs_epi32(v256_mantissa[0], v256_mantissa[1]);
+                    if (sizeof(TT) == 2)
+                    {
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&mantissa[i + ii * 8]), _mm256_permute4x64_epi64(v256_packed, 0xD8));
+                    }
+                    else
+                    {
+                        const __m256i v256_packed_8 = _mm256_packs_epi16(v256_packed, _mm256_setzero_si256());
+                        const __m128i v128_out = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v256_packed_8, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(&mantissa[i + ii * 8]), v128_out);
+                    }
+                }
+            }
+
+            return i;
+        }
+
+        //! \brief Decode block floating point into floating point numbers using SIMD intrinsics
+        //!
+        //! Only complete groups are processed.
+        //!
+        //! \tparam G group size (multiple of 16)
+        //! \tparam T floating point data type
+        //! \tparam TT integer data type of the mantissas
+        //! \param exponent pointer to the shared exponents
+        //! \param mantissa pointer to the mantissas
+        //! \param out pointer to the output sequence
+        //! \param n length of the output sequence
+        //! \return number of elements that have been decoded (multiple of 'G')
+        template <std::uint32_t G, typename T, typename TT>
+        FP_TARGET_AVX2 static std::size_t decode_block_fp_simd_intrinsics(const std::uint8_t* exponent, const TT* mantissa, T* out, const std::size_t n)
+        {
+            std::size_t i = 0;
+
+            for (std::size_t k = 0; (i + G) <= n; i += G, ++k)
+            {
+                const __m256 scale = _mm256_set1_ps(block_scaling_factor(exponent[k]));
+
+                for (std::size_t ii = 0; ii < G; ii += 8)
+                {
+                    const __m128i v128_in = (sizeof(TT) == 2 ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(&mantissa[i + ii])) : _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&mantissa[i + ii])));
+                    const __m256 v256_out = _mm256_mul_ps(_mm256_cvtepi32_ps(block_mantissa_simd_intrinsics<TT>(v128_in)), scale);
+
+                    if (std::is_same<T, double>::value)
+                    {
+                        _mm256_storeu_pd(reinterpret_cast<double*>(&out[i + ii]), _mm256_cvtps_pd(_mm256_castps256_ps128(v256_out)));
+                        _mm256_storeu_pd(reinterpret_cast<double*>(&out[i + ii + 4]), _mm256_cvtps_pd(_mm256_extractf128_ps(v256_out, 1)));
+                    }
+                    else
+                    {
+                        _mm256_storeu_ps(reinterpret_cast<float*>(&out[i + ii]), v256_out);
+                    }
+                }
+            }
+
+            return i;
+        }
+    #endif
+
+        //! \brief Encode floating point into block floating point numbers
+        //!
+        //! Mantissas are rounded to the nearest integer (ties to even).
+        //! Non-finite numbers cannot be represented: they saturate, and the other numbers in the group become zero.
+        //!
+        //! \tparam BM bits mantissa (without the sign)
+        //! \tparam G group size
+        //! \tparam T floating point data type
+        //! \tparam TT integer data type of the mantissas
+        //! \param in pointer to the input sequence
+        //! \param exponent pointer to the shared exponents
+        //! \param mantissa pointer to the mantissas
+        //! \param n length of the input sequence
+        template <std::uint32_t BM, std::uint32_t G, typename T, typename TT>
+        static void encode_block_fp_kernel(const T* in, std::uint8_t* exponent, TT* mantissa, const std::size_t n)
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed as input");
+
+            constexpr float limit = static_cast<float>((0x1U << BM) - 1);
+            std::size_t i = 0;
+
+        #if defined(FP_SIMD_AVX2)
+            if (use_simd_isa(simd_isa::avx2))
             {
-                recode_simd_intrinsics<T, TT>(in, ptr_out, n, a, b);
+                i = encode_block_fp_simd_intrinsics<BM, G>(in, exponent, mantissa, n);
             }
-            else
         #endif
+
+            for (std::size_t k = i / G; i < n; i += G, ++k)
             {
-                for (std::size_t i = 0; i < n; ++i)
+                const std::size_t ii_max = std::min(n - i, static_cast<std::size_t>(G));
+
+                std::uint32_t abs_max = 0;
+                for (std::size_t ii = 0; ii < ii_max; ++ii)
                 {
-                    ptr_out[i] = (in[i] - a) * b;
+                    const float x = static_cast<float>(in[i + ii]);
+                    std::uint32_t y;
+                    std::memcpy(&y, &x, sizeof(float));
+                    abs_max = std::max(abs_max, y & 0x7FFFFFFFU);
+                }
+
+                const std::uint32_t e = block_exponent_from_abs_max<BM>(abs_max);
+                exponent[k] = static_cast<std::uint8_t>(e);
+                const float scale = block_scaling_factor(254 - e);
+
+                for (std::size_t ii = 0; ii < ii_max; ++ii)
+                {
+                    float x = static_cast<float>(in[i + ii]) * scale;
+                    x = (x < limit ? x : limit);
+                    x = (x > -limit ? x : -limit);
+                    mantissa[i + ii] = static_cast<TT>(std::nearbyint(x));
                 }
             }
         }
 
-        //! \brief Encode floating point into fixed point numbers
+        //! \brief Decode block floating point into floating point numbers
         //!
-        //! \tparam T 'in' data type
-        //! \tparam TT floating point data type
-        //! \param in pointer to the input sequence
+        //! \tparam G group size
+        //! \tparam T floating point data type
+        //! \tparam TT integer data type of the mantissas
+        //! \param exponent pointer to the shared exponents
+        //! \param mantissa pointer to the mantissas
         //! \param out pointer to the output sequence
-        //! \param n length of the input sequence
-        template <typename T, typename TT>
-        static void decode_fixed_point_kernel(const T* in, TT* out, const std::size_t n)
+        //! \param n length of the output sequence
+        template <std::uint32_t G, typename T, typename TT>
+        static void decode_block_fp_kernel(const std::uint8_t* exponent, const TT* mantissa, T* out, const std::size_t n)
         {
-            static_assert(std::is_integral<T>::value, "error: only integers are allowed as input");
-            static_assert(std::is_same<TT, double>::value || std::is_same<TT, float>::value, "error: only 'double' or 'float' are allowed as output");
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed as output");
 
-            if (n == 0) return;
-            
-            const float* fptr_in = reinterpret_cast<const float*>(in);
-            const float a = fptr_in[0];
-            const float b = fptr_in[1];
+            std::size_t i = 0;
 
-        #if defined(__AVX2__) || defined(__AVX512F__)
-            constexpr bool use_simd_intrinsics = std::is_same<T, std::uint8_t>::value;
-            if (use_simd_intrinsics)
+        #if defined(FP_SIMD_AVX2)
+            if (use_simd_isa(simd_isa::avx2))
             {
-                recode_simd_intrinsics<std::uint8_t, TT>(reinterpret_cast<const std::uint8_t*>(&fptr_in[2]), out, n, a, b);
+                i = decode_block_fp_simd_intrinsics<G>(exponent, mantissa, out, n);
             }
-            else
         #endif
+
+            for ( ; i < n; ++i)
             {
-                const T* ptr_in = reinterpret_cast<const T*>(&fptr_in[2]);
+                out[i] = static_cast<float>(mantissa[i]) * block_scaling_factor(exponent[i / G]);
+            }
+        }
+    }
 
-                for (std::size_t i = 0; i < n; ++i)
+    ////////////////////////////////////////////////////////////////////////////////////
+    // SPECIALIZATIONS: block floating point
+    ////////////////////////////////////////////////////////////////////////////////////
+    template <std::uint32_t BM, std::uint32_t BE>
+    class fp_stream<BM, BE, typename std::enable_if<internal::is_block_floating_point_type<BM, BE>::value>::type>
+    {
+        static constexpr std::uint32_t group_size = internal::is_block_floating_point_type<BM, BE>::group_size;
+
+        static_assert(BM == 7 || BM == 15, "error: only BM=7 or BM=15 is supported");
+        static_assert(group_size == 16 || group_size == 32 || group_size == 64, "error: only group sizes 16, 32 and 64 are supported");
+
+        // do not allow instantiation
+        fp_stream() { ; }
+
+        //! \brief Number of bytes needed for the shared exponents: the mantissas begin at a multiple of 8 bytes
+        //!
+        //! \param n number of floating point numbers
+        //! \return number of bytes
+        static std::size_t exponent_bytes(const std::size_t n)
+        {
+            return (((n + group_size - 1) / group_size + 7) / 8) * 8;
+        }
+
+    public:
+
+        static constexpr bool is_fixed_point_type = false;
+        static constexpr bool is_bit_packed_type = false;
+
+        static constexpr std::uint32_t bm = BM;
+        static constexpr std::uint32_t be = BE;
+        // bits per number without the shared exponent
+        static constexpr std::uint32_t bits = 1 + BM;
+
+        // the mantissas are signed integers
+        using type = typename std::conditional<(BM == 15), std::int16_t, std::int8_t>::type;
+
+        //! \brief Number of bytes needed to compress a sequence of 'n' words
+        //! 
+        //! \param n number of floating point numbers to be compressed
+        //! \return number of bytes
+        static std::size_t memory_footprint_bytes(const std::size_t n)
+        {
+            if (n == 0) return 0;
+
+            // the shared exponents are followed by the mantissas
+            return exponent_bytes(n) + n * sizeof(type);
+        }
+
+        //! \brief Number of elements needed to compress a sequence of 'n' words
+        //!
+        //! \param n number of floating point numbers to be compressed
+        //! \return number of elements
+        static std::size_t memory_footprint_elements(const std::size_t n)
+        {
+            // number of elements
+            return memory_footprint_bytes(n) / sizeof(type);
+        }
+
+        //! \brief Compression of floating point numbers
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the compressed output stream
+        //! \param n length of the input sequence
+        template <typename T>
+        static void compress(const T* in, type* out, const std::size_t n)
+        {
+            using namespace internal;
+
+            if (n == 0) return;
+
+            std::uint8_t* exponent = reinterpret_cast<std::uint8_t*>(out);
+            type* mantissa = reinterpret_cast<type*>(&exponent[exponent_bytes(n)]);
+
+            encode_block_fp_kernel<BM, group_size>(in, exponent, mantissa, n);
+        }
+
+        //! \brief Decompression of compressed floating point numbers
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the compressed input stream
+        //! \param out pointer to the decompressed output sequence
+        //! \param n length of the output sequence
+        template <typename T>
+        static void decompress(const type* in, T* out, const std::size_t n)
+        {
+            using namespace internal;
+
+            if (n == 0) return;
+
+            const std::uint8_t* exponent = reinterpret_cast<const std::uint8_t*>(in);
+            const type* mantissa = reinterpret_cast<const type*>(&exponent[exponent_bytes(n)]);
+
+            decode_block_fp_kernel<group_size>(exponent, mantissa, out, n);
+        }
+
+    #if defined(FP_SIMD_AVX2)
+        //! \brief SIMD decompression of a stream
+        //!
+        //! Same interface as for the other floating point formats: see the general 'fp_stream'.
+        class simd_decoder
+        {
+            const std::uint8_t* exponent;
+            const type* mantissa;
+            const std::size_t num_elements;
+            // the last group within the stream
+            const std::size_t last_group;
+
+        public:
+
+            // number of elements per call to 'load'
+            static constexpr std::size_t width = 8;
+
+            //! \brief Constructor
+            //!
+            //! \param in pointer to the compressed stream
+            //! \param n length of the stream
+            simd_decoder(const type* in, const std::size_t n)
+                :
+                exponent(reinterpret_cast<const std::uint8_t*>(in)),
+                mantissa(reinterpret_cast<const type*>(&exponent[exponent_bytes(n)])),
+                num_elements(n),
+                last_group(n > 0 ? (n - 1) / group_size : 0)
+            { ; }
+
+            //! \brief Decompress 'width' elements
+            //!
+            //! The elements can belong to two consecutive groups.
+            //! Elements beyond the end of the stream are not accessed: the respective lanes hold arbitrary values.
+            //!
+            //! \param i position of the first element
+            //! \return decompressed elements
+            FP_TARGET_AVX2 inline __m256 load(const std::size_t i) const
+            {
+                __m128i v128_in;
+                if ((i + width) <= num_elements)
                 {
-                    out[i] = static_cast<float>(ptr_in[i]) * b + (b * 0.5F + a);
+                    v128_in = (sizeof(type) == 2 ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(&mantissa[i])) : _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&mantissa[i])));
+                }
+                else
+                {
+                    // do not read beyond the end of the stream
+                    alignas(internal::alignment) type buffer[16] = {0};
+                    for (std::size_t ii = i; ii < num_elements; ++ii)
+                    {
+                        buffer[ii - i] = mantissa[ii];
+                    }
+                    v128_in = _mm_load_si128(reinterpret_cast<const __m128i*>(&buffer[0]));
                 }
+
+                // lanes beyond the end of the current group take the exponent of the next group
+                const std::size_t k = i / group_size;
+                const std::size_t k_next = (k < last_group ? k + 1 : k);
+                const __m256i is_next = _mm256_cmpgt_epi32(_mm256_add_epi32(_mm256_set1_epi32(i % group_size), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), _mm256_set1_epi32(group_size - 1));
+                const __m256i v256_exponent = _mm256_blendv_epi8(_mm256_set1_epi32(exponent[k]), _mm256_set1_epi32(exponent[k_next]), is_next);
+
+                return _mm256_mul_ps(_mm256_cvtepi32_ps(internal::block_mantissa_simd_intrinsics<type>(v128_in)), _mm256_castsi256_ps(_mm256_slli_epi32(v256_exponent, 23)));
             }
-        }
-    }
+        };
+    #endif
+    };
 
     ////////////////////////////////////////////////////////////////////////////////////
-    // SPECIALIZATIONS: fixed precision with 8 and 16 bit
+    // SPECIALIZATIONS: bit-packed floating point with lane-interleaved layout
     ////////////////////////////////////////////////////////////////////////////////////
-    template <std::uint32_t BM>
-    class fp_stream<BM, 0>
+    template <std::uint32_t BM, std::uint32_t BE>
+    class fp_stream<BM, BE, typename std::enable_if<internal::is_lane_interleaved_type<BM, BE>::value>::type>
     {
-        static_assert(BM == 8 || BM == 16, "error: only BM=8 or BM=16 is supported");
+        // compression of the single numbers is the same as for the bit-packed format
+        using base = fp_stream<BM, internal::is_lane_interleaved_type<BM, BE>::be>;
+
+        static_assert(base::is_bit_packed_type, "error: lane-interleaved layout is available for bit-packed formats only");
+
+        // the stream is organized in frames of 'lanes * slots' numbers: each slot holds one number per lane
+        static constexpr std::size_t lanes = 8;
+        static constexpr std::size_t slots = 32;
+        static constexpr std::size_t frame_size = lanes * slots;
 
         // do not allow instantiation
         fp_stream() { ; }
 
+        //! \brief Number of 32-bit words needed for a sequence of 'n' compressed numbers
+        //!
+        //! Full frames have 'bits' rows of 'lanes' words, the last frame has as many rows as needed.
+        //!
+        //! \param n number of floating point numbers
+        //! \return number of 32-bit words
+        static std::size_t num_words(const std::size_t n)
+        {
+            const std::size_t num_frames = n / frame_size;
+            const std::size_t num_slots = ((n - num_frames * frame_size) + lanes - 1) / lanes;
+            const std::size_t num_rows = (num_slots * bits + 31) / 32;
+
+            return (num_frames * bits + num_rows) * lanes;
+        }
+
     public:
 
-        static constexpr bool is_fixed_point_type = true;
+        static constexpr bool is_fixed_point_type = false;
+        static constexpr bool is_bit_packed_type = false;
 
         static constexpr std::uint32_t bm = BM;
-        static constexpr std::uint32_t be = 0;
-        static constexpr std::uint32_t bits = BM;
+        static constexpr std::uint32_t be = BE;
+        static constexpr std::uint32_t bits = base::bits;
 
-        using type = typename std::conditional<(BM == 16), std::uint16_t, std::uint8_t>::type;
+        using type = std::uint32_t;
 
         //! \brief Number of bytes needed to compress a sequence of 'n' words
         //! 
@@ -978,10 +3510,8 @@ namespace FP_NAMESPACE
         {
             if (n == 0) return 0;
 
-            // we need to store the scaling factors as well
-            const std::size_t n_scaling_factor = 2;
-            // number of bytes needed
-            return n_scaling_factor * sizeof(float) + n * sizeof(type);
+            // the scaling factor is followed by the frames
+            return (2 + num_words(n)) * sizeof(type);
         }
 
         //! \brief Number of elements needed to compress a sequence of 'n' words
@@ -996,31 +3526,67 @@ namespace FP_NAMESPACE
 
         //! \brief Compression of floating point numbers
         //!
+        //! The 'i'-th number goes to lane 'i % lanes' at bit position '(i / lanes) * bits' of that lane (within its frame).
+        //! Numbers can span two words of the same lane.
+        //!
         //! \tparam T floating point data type
         //! \param in pointer to the input sequence
-        //! \param out pointer to the compressed output bit stream
+        //! \param out pointer to the compressed output stream
         //! \param n length of the input sequence
         template <typename T>
         static void compress(const T* in, type* out, const std::size_t n)
         {
             using namespace internal;
 
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+
             if (n == 0) return;
 
-            // unsigned integer conversion: [minimum, maximum] -> [0, max_int]
-            const T minimum = scan_min(in, n);
-            const T maximum = scan_max(in, n);
-        
-            const T a = minimum;
-            const T b = std::numeric_limits<type>::max() / (maximum - a);
+            // for scaling, first determine the absolute maximum value among all uncompressed floating point numbers
+            const T abs_max = scan_absmax(in, n);
+            // calculate the scaling factor
+            const T a = static_cast<T>(base::scaling_factor[base::be]) / abs_max;
+            // place the scaling factor as the 1st element to the output stream
+            float* fptr_out = reinterpret_cast<float*>(out);
+            fptr_out[0] = static_cast<float>(1.0 / a);
+            fptr_out[1] = 0.0F;
+            // all compressed floating point numbers are placed after the scaling factor
+            type* ptr_out = &out[2];
+
+            // full frames are compressed using SIMD intrinsics (if available): the remainder is handled below
+            std::size_t i_start = 0;
+        #if defined(FP_SIMD_AVX2)
+            if (internal::use_simd_isa(simd_isa::avx2))
+            {
+                i_start = compress_simd_intrinsics(in, ptr_out, n, a);
+            }
+        #endif
 
-            encode_fixed_point_kernel(in, out, n, a, b);
+            std::memset(&ptr_out[num_words(i_start)], 0, (num_words(n) - num_words(i_start)) * sizeof(type));
+
+            for (std::size_t i = i_start; i < n; ++i)
+            {
+                // in case of T = 'double', there is an explicit down cast to 'float'
+                const float element = static_cast<float>(in[i] * a);
+                std::uint32_t buffer;
+                std::memcpy(&buffer, &element, sizeof(buffer));
+                const std::uint32_t encoded = base::encode(buffer);
+
+                const std::size_t bit_position = ((i % frame_size) / lanes) * bits;
+                const std::size_t shift = bit_position % 32;
+                type* ptr = &ptr_out[(i / frame_size) * bits * lanes + (bit_position / 32) * lanes + (i % lanes)];
+                ptr[0] |= (encoded << shift);
+                if ((shift + bits) > 32)
+                {
+                    ptr[lanes] |= (encoded >> (32 - shift));
+                }
+            }
         }
 
         //! \brief Decompression of compressed floating point numbers
         //!
         //! \tparam T floating point data type
-        //! \param in pointer to the compressed input bit stream
+        //! \param in pointer to the compressed input stream
         //! \param out pointer to the decompressed output sequence
         //! \param n length of the output sequence
         template <typename T>
@@ -1028,8 +3594,225 @@ namespace FP_NAMESPACE
         {
             using namespace internal;
 
-            decode_fixed_point_kernel(in, out, n);
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+
+            if (n == 0) return;
+
+            // recover the scaling factor (1st element) of the input stream
+            const float* fptr_in = reinterpret_cast<const float*>(in);
+            const float a = fptr_in[0];
+            // move on to the compressed floating point numbers
+            const type* ptr_in = &in[2];
+
+            // full frames are decompressed using SIMD intrinsics (if available): the remainder is handled below
+            std::size_t i_start = 0;
+        #if defined(FP_SIMD_AVX2)
+            if (internal::use_simd_isa(simd_isa::avx2))
+            {
+                i_start = decompress_simd_intrinsics(ptr_in, out, n, a);
+            }
+        #endif
+
+            for (std::size_t i = i_start; i < n; ++i)
+            {
+                const std::size_t bit_position = ((i % frame_size) / lanes) * bits;
+                const std::size_t shift = bit_position % 32;
+                const type* ptr = &ptr_in[(i / frame_size) * bits * lanes + (bit_position / 32) * lanes + (i % lanes)];
+                std::uint32_t encoded = (ptr[0] >> shift);
+                if ((shift + bits) > 32)
+                {
+                    encoded |= (ptr[lanes] << (32 - shift));
+                }
+
+                // in case of T = 'double', there is an explicit up cast from 'float' to 'double'
+                const std::uint32_t buffer = base::decode(encoded & base::get_lower_bits[bits]);
+                float element;
+                std::memcpy(&element, &buffer, sizeof(element));
+                out[i] = static_cast<T>(element * a);
+            }
+        }
+
+    private:
+
+    #if defined(FP_SIMD_AVX2)
+        //! \brief Compression of floating point numbers using SIMD intrinsics
+        //!
+        //! One slot (8 consecutive numbers) at a time: all lanes use the same shift counts, and each row of the frame
+        //! is written once it is complete.
+        //! Only full frames are processed, and the output is bit-identical to that of the scalar code path.
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the input sequence
+        //! \param out pointer to the frames (behind the scaling factor)
+        //! \param n length of the input sequence
+        //! \param a scaling factor
+        //! \return number of elements that have been compressed (multiple of 'frame_size')
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t compress_simd_intrinsics(const T* in, type* out, const std::size_t n, const T a)
+        {
+            const std::size_t num_frames = n / frame_size;
+
+            for (std::size_t f = 0; f < num_frames; ++f)
+            {
+                const T* ptr_in = &in[f * frame_size];
+                type* ptr_out = &out[f * bits * lanes];
+
+                __m256i v256_row = _mm256_setzero_si256();
+                for (std::size_t t = 0, w = 0; t < slots; ++t)
+                {
+                    __m256 v256_in;
+                    if (std::is_same<T, double>::value)
+                    {
+                        const __m256d v256_a = _mm256_set1_pd(a);
+                        const __m128 v128_lo = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[t * lanes])), v256_a));
+                        const __m128 v128_hi = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(reinterpret_cast<const double*>(&ptr_in[t * lanes + 4])), v256_a));
+                        v256_in = _mm256_insertf128_ps(_mm256_castps128_ps256(v128_lo), v128_hi, 1);
+                    }
+                    else
+                    {
+                        v256_in = _mm256_mul_ps(_mm256_loadu_ps(reinterpret_cast<const float*>(&ptr_in[t * lanes])), _mm256_set1_ps(a));
+                    }
+
+                    const __m256i v256_encoded = base::encode_simd_intrinsics(_mm256_castps_si256(v256_in));
+                    const std::uint32_t shift = (t * bits) % 32;
+                    v256_row = _mm256_or_si256(v256_row, _mm256_sll_epi32(v256_encoded, _mm_cvtsi32_si128(shift)));
+
+                    // the current row is complete: the upper bits of the number (if any) go to the next row
+                    if ((shift + bits) >= 32)
+                    {
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ptr_out[w * lanes]), v256_row);
+                        v256_row = _mm256_srl_epi32(v256_encoded, _mm_cvtsi32_si128(32 - shift));
+                        ++w;
+                    }
+                }
+            }
+
+            return num_frames * frame_size;
+        }
+
+        //! \brief Extract one slot using SIMD intrinsics
+        //!
+        //! \param in pointer to the frame
+        //! \param t slot
+        //! \return compressed numbers (the bits beyond the compressed word are not cut off)
+        FP_TARGET_AVX2 static inline __m256i extract_simd_intrinsics(const type* in, const std::size_t t)
+        {
+            const std::size_t bit_position = t * bits;
+            const std::uint32_t shift = bit_position % 32;
+            const type* ptr = &in[(bit_position / 32) * lanes];
+
+            __m256i v256_encoded = _mm256_srl_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)), _mm_cvtsi32_si128(shift));
+            if ((shift + bits) > 32)
+            {
+                v256_encoded = _mm256_or_si256(v256_encoded, _mm256_sll_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&ptr[lanes])), _mm_cvtsi32_si128(32 - shift)));
+            }
+
+            return v256_encoded;
+        }
+
+        //! \brief Decompression of floating point numbers using SIMD intrinsics
+        //!
+        //! \tparam T floating point data type
+        //! \param in pointer to the frames (behind the scaling factor)
+        //! \param out pointer to the output sequence
+        //! \param n length of the output sequence
+        //! \param a scaling factor
+        //! \return number of elements that have been decompressed (multiple of 'frame_size')
+        template <typename T>
+        FP_TARGET_AVX2 static std::size_t decompress_simd_intrinsics(const type* in, T* out, const std::size_t n, const float a)
+        {
+            const std::size_t num_frames = n / frame_size;
+
+            for (std::size_t f = 0; f < num_frames; ++f)
+            {
+                const type* ptr_in = &in[f * bits * lanes];
+                T* ptr_out = &out[f * frame_size];
+
+                for (std::size_t t = 0; t < slots; ++t)
+                {
+                    const __m256 v256_out = _mm256_mul_ps(base::decode_simd_intrinsics(extract_simd_intrinsics(ptr_in, t)), _mm256_set1_ps(a));
+
+                    if (std::is_same<T, double>::value)
+                    {
+                        _mm256_storeu_pd(reinterpret_cast<double*>(&ptr_out[t * lanes]), _mm256_cvtps_pd(_mm256_castps256_ps128(v256_out)));
+                        _mm256_storeu_pd(reinterpret_cast<double*>(&ptr_out[t * lanes + 4]), _mm256_cvtps_pd(_mm256_extractf128_ps(v256_out, 1)));
+                    }
+                    else
+                    {
+                        _mm256_storeu_ps(reinterpret_cast<float*>(&ptr_out[t * lanes]), v256_out);
+                    }
+                }
+            }
+
+            return num_frames * frame_size;
         }
+
+    public:
+
+        //! \brief SIMD decompression of a stream
+        //!
+        //! Same interface as for the other floating point formats: see the general 'fp_stream'.
+        class simd_decoder
+        {
+            const type* ptr;
+            const float a;
+            const std::size_t num_elements;
+
+            //! \brief Extract the 'g'-th slot of the stream
+            //!
+            //! \param g slot
+            //! \return compressed numbers
+            FP_TARGET_AVX2 inline __m256i extract(const std::size_t g) const
+            {
+                return extract_simd_intrinsics(&ptr[(g / slots) * bits * lanes], g % slots);
+            }
+
+        public:
+
+            // number of elements per call to 'load'
+            static constexpr std::size_t width = lanes;
+
+            //! \brief Constructor
+            //!
+            //! \param in pointer to the compressed stream
+            //! \param n length of the stream
+            simd_decoder(const type* in, const std::size_t n)
+                :
+                ptr(&in[2]),
+                a(reinterpret_cast<const float*>(in)[0]),
+                num_elements(n)
+            { ; }
+
+            //! \brief Decompress 'width' elements
+            //!
+            //! The elements can belong to two consecutive slots: both are rotated into place and blended.
+            //! Elements beyond the end of the stream are not accessed: the respective lanes hold arbitrary values.
+            //!
+            //! \param i position of the first element
+            //! \return decompressed elements
+            FP_TARGET_AVX2 inline __m256 load(const std::size_t i) const
+            {
+                const std::size_t g = i / lanes;
+                const std::uint32_t l0 = i % lanes;
+
+                __m256i v256_encoded = extract(g);
+                if (l0 != 0)
+                {
+                    const __m256i v256_lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+                    const __m256i v256_index = _mm256_and_si256(_mm256_add_epi32(v256_lane, _mm256_set1_epi32(l0)), _mm256_set1_epi32(lanes - 1));
+                    v256_encoded = _mm256_permutevar8x32_epi32(v256_encoded, v256_index);
+
+                    if (((g + 1) * lanes) < num_elements)
+                    {
+                        const __m256i is_next = _mm256_cmpgt_epi32(v256_lane, _mm256_set1_epi32(lanes - 1 - l0));
+                        v256_encoded = _mm256_blendv_epi8(v256_encoded, _mm256_permutevar8x32_epi32(extract(g + 1), v256_index), is_next);
+                    }
+                }
+
+                return _mm256_mul_ps(base::decode_simd_intrinsics(v256_encoded), _mm256_set1_ps(a));
+            }
+        };
+    #endif
     };
 
     //! \brief Definition of floating / fixed point data type
@@ -11,6 +11,8 @@
 #include <cstdint>
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <memory>
 #include <omp.h>
 
 #if !defined(FP_NAMESPACE)
@@ -46,6 +48,11 @@ namespace FP_NAMESPACE
 #include <blas/wrapper.hpp>
 #include <blas/integer_blas.hpp>
 
+// zero and constant blocks are not stored: the block offsets then depend on the matrix content
+#if defined(FP_CONSTANT_BLOCKS) && !defined(FP_BLOCK_OFFSET_TABLE)
+    #define FP_BLOCK_OFFSET_TABLE
+#endif
+
 namespace FP_NAMESPACE
 {
     namespace blas
@@ -55,6 +62,38 @@ namespace FP_NAMESPACE
         //! matrix type: general, triangular, lower triangular, upper triangular
         enum class matrix_type { general = 0, triangular = 1, lower_triangular = 2, upper_triangular = 3 };
 
+        //! execution policy for BLAS operations on a single matrix: sequential, or parallel using all threads of an OpenMP team
+        enum class execution_policy { sequential = 0, parallel = 1 };
+
+        //! \brief Matrix interface (abstract)
+        //!
+        //! This class is the common base of all compressed matrices, independent of the compression scheme.
+        //! It allows to select the compression scheme at runtime (see 'any_matrix').
+        class matrix_interface
+        {
+        public:
+
+            virtual ~matrix_interface() { ; }
+
+            virtual std::size_t memory_footprint_bytes() const = 0;
+
+        #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y) const = 0;                          \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y) const = 0; \
+            virtual void matrix_multi_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const std::size_t ldx, const std::size_t k, const TYPE_VEC beta, TYPE_VEC* y, const std::size_t ldy) const = 0 \
+
+            MACRO_MATRIX_VECTOR(double, double);
+            MACRO_MATRIX_VECTOR(double, float);
+            MACRO_MATRIX_VECTOR(float, double);
+            MACRO_MATRIX_VECTOR(float, float);
+
+        #undef MACRO_MATRIX_VECTOR
+        };
+
+        // compressed matrix with the compression scheme selected per block (see below)
+        template <typename T, matrix_layout L>
+        class adaptive_matrix;
+
         //! \brief Matrix base class (abstract)
         //!
         //! This class implements some basic functionality for the internal representation of an 'm x n' matrix as a collection of blocks.
@@ -67,10 +106,14 @@ namespace FP_NAMESPACE
         //! \tparam BM number of bits in the exponent
         //! \tparam BE number of bits in the mantissa
         template <typename T, matrix_layout L = matrix_layout::rowmajor, std::uint32_t BM = ieee754_fp<T>::bm, std::uint32_t BE = ieee754_fp<T>::be>
-        class matrix_base
+        class matrix_base : public matrix_interface
         {
             static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
 
+            // the adaptive matrix uses the block kernels of all compression schemes
+            template <typename, matrix_layout>
+            friend class adaptive_matrix;
+
         public:
 
             // extent of the matrix: 'm' rows and 'n' columns
@@ -104,6 +147,28 @@ namespace FP_NAMESPACE
                 const std::size_t num_elements;
             } const partition;
 
+        #if defined(FP_BLOCK_OFFSET_TABLE)
+            // offsets of all blocks w.r.t. to 'compressed_data': block (bj, bi) is at position 'bj * ((n + bs - 1) / bs) + bi'
+            std::vector<std::size_t> block_offset;
+        #endif
+
+            // kind of a block: blocks that are entirely zero or constant need not be stored
+            enum class block_kind : std::uint8_t { dense = 0, zero = 1, constant = 2 };
+
+            struct block_tag_t
+            {
+                block_kind kind;
+                // value of all elements of a zero or constant block
+                T value;
+            };
+
+        #if defined(FP_CONSTANT_BLOCKS)
+            // tags of all blocks: block (bj, bi) is at position 'bj * ((n + bs - 1) / bs) + bi'
+            std::vector<block_tag_t> block_tag;
+            // number of elements of type 'fp_type' actually stored
+            std::size_t num_elements_stored;
+        #endif
+
             //! \brief Create a matrix partitioning
             //!
             //! A simple blocking scheme of the matrix.
@@ -159,6 +224,61 @@ namespace FP_NAMESPACE
                 }
             }
 
+            //! \brief Create a table of block offsets
+            //!
+            //! The table is created by walking through the blocks in the same order as the matrix compression does,
+            //! so that it does not depend on the blocks having a fixed size.
+            //! Entries for blocks that are not stored (triangular matrices) are set to 'partition.num_elements'.
+            //! Zero and constant blocks (see 'tag') take no space: their offset is that of the next block.
+            //!
+            //! \tparam MT matrix type
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            //! \param partition the matrix partitioning
+            //! \param tag (optional) tags of all blocks
+            //! \return block offsets
+            template <matrix_type MT>
+            static std::vector<std::size_t> make_block_offset_table(const std::array<std::size_t, 2>& extent, const std::size_t bs, const partition_t& partition, const block_tag_t* tag = nullptr)
+            {
+                const std::size_t m = extent[0];
+                const std::size_t n = extent[1];
+                if (m == 0 || n == 0 || bs == 0) return {};
+
+                const std::size_t num_block_cols = (n + bs - 1) / bs;
+                std::vector<std::size_t> block_offset(((m + bs - 1) / bs) * num_block_cols, partition.num_elements);
+
+                for (std::size_t j = 0, k = 0; j < m; j += bs)
+                {
+                    const std::size_t i_start = (MT == matrix_type::upper_triangular ? j : 0);
+                    const std::size_t i_end = (MT == matrix_type::lower_triangular ? (j + 1) : n);
+
+                    for (std::size_t i = i_start; i < i_end; i += bs)
+                    {
+                        block_offset[(j / bs) * num_block_cols + (i / bs)] = k;
+
+                        // zero and constant blocks are not stored
+                        if (tag != nullptr && tag[(j / bs) * num_block_cols + (i / bs)].kind != block_kind::dense) continue;
+
+                        // move on to the next block
+                        if (MT == matrix_type::general)
+                        {
+                            k += ((n - i) < bs ? partition.num_elements_b : ((m - j) < bs ? partition.num_elements_c : partition.num_elements_a));
+                        }
+                        else if (i == j)
+                        {
+                            k += partition.num_elements_a;
+                        }
+                        else
+                        {
+                            const std::size_t ij = (MT == matrix_type::upper_triangular ? i : j);
+                            k += ((n - ij) < bs ? partition.num_elements_c : partition.num_elements_b);
+                        }
+                    }
+                }
+
+                return block_offset;
+            }
+
             //! \brief Constructor for triangular matrices
             //!
             //! \param data pointer to the input matrix
@@ -178,6 +298,10 @@ namespace FP_NAMESPACE
                     std::cerr << "error in matrix_base<..," << BM << "," << BE << ">::matrix_base: pointer is a nullptr" << std::endl;
                     throw std::exception();
                 }
+
+            #if defined(FP_CONSTANT_BLOCKS)
+                num_elements_stored = partition.num_elements;
+            #endif
             }
 
             //! \brief Constructor for general matrices
@@ -199,6 +323,29 @@ namespace FP_NAMESPACE
                     std::cerr << "error in matrix_base<..," << BM << "," << BE << ">::matrix_base: pointer is a nullptr" << std::endl;
                     throw std::exception();
                 }
+
+            #if defined(FP_CONSTANT_BLOCKS)
+                num_elements_stored = partition.num_elements;
+            #endif
+            }
+
+            //! \brief Classify a block
+            //!
+            //! \param in pointer to the block
+            //! \param n number of elements
+            //! \return tag holding the kind of the block and the value of its elements (zero or constant blocks)
+            static block_tag_t make_block_tag(const T* in, const std::size_t n)
+            {
+                const T value = in[0];
+                for (std::size_t i = 1; i < n; ++i)
+                {
+                    if (in[i] != value)
+                    {
+                        return {block_kind::dense, static_cast<T>(0.0)};
+                    }
+                }
+
+                return {(value == static_cast<T>(0.0) ? block_kind::zero : block_kind::constant), value};
             }
 
             //! \brief Matrix compression
@@ -212,8 +359,9 @@ namespace FP_NAMESPACE
             //! \param extent matrix dimensions
             //! \param bs block size
             //! \param partition the matrix partitioning
+            //! \param tag (optional) if specified, zero and constant blocks are not stored and the tags of all blocks are written to 'tag'
             template <matrix_type MT>
-            static ptrdiff_t compress(const T* data, const std::size_t ld_data, fp_type* compressed_data, const std::array<std::size_t, 2>& extent, const std::size_t bs, const partition_t& partition)
+            static ptrdiff_t compress(const T* data, const std::size_t ld_data, fp_type* compressed_data, const std::array<std::size_t, 2>& extent, const std::size_t bs, const partition_t& partition, block_tag_t* tag = nullptr)
             {
                 if (data == nullptr || compressed_data == nullptr)
                 {
@@ -229,9 +377,11 @@ namespace FP_NAMESPACE
                 constexpr bool lower_colmajor = (MT == matrix_type::lower_triangular) && (L == matrix_layout::colmajor);
 
                 // compress the matrix block wise: blocks are copied into the buffer before the compression
-                alignas(alignment) T buffer[bs * bs];
+                internal::scratch_buffer<T> buffer(bs * bs);
                 // pointer to the first block
                 fp_type* ptr = compressed_data;
+                const std::size_t num_block_cols = (n + bs - 1) / bs;
+                bool last_block_stored = true;
 
                 for (std::size_t j = 0; j < m; j += bs)
                 {
@@ -283,16 +433,25 @@ namespace FP_NAMESPACE
                             }
                         }
 
+                        // zero and constant blocks are not stored
+                        if (tag != nullptr)
+                        {
+                            block_tag_t& block = tag[(j / bs) * num_block_cols + (i / bs)];
+                            block = make_block_tag(buffer, (MT != matrix_type::general && i == j ? ((mm * (mm + 1)) / 2) : mm * nn));
+                            last_block_stored = (block.kind == block_kind::dense);
+                            if (!last_block_stored) continue;
+                        }
+
                         // compress the 'buffer'
                         if (MT == matrix_type::general)
                         {
-                            fp_stream<BM, BE>::compress(buffer, ptr, mm * nn);
+                            fp_stream<BM, BE>::compress(&buffer[0], ptr, mm * nn);
                             // move on to the next block
                             ptr += ((n - i) < bs ? partition.num_elements_b : ((m - j) < bs ? partition.num_elements_c : partition.num_elements_a));
                         }
                         else
                         {
-                            fp_stream<BM, BE>::compress(buffer, ptr, (i == j ? ((mm * (mm + 1)) / 2) : mm * nn));
+                            fp_stream<BM, BE>::compress(&buffer[0], ptr, (i == j ? ((mm * (mm + 1)) / 2) : mm * nn));
                             // move on to the next block
                             if (i == j)
                             {
@@ -308,7 +467,7 @@ namespace FP_NAMESPACE
                 }
                 
                 // correct the last block's element count
-                if (partition.num_elements_d != 0)
+                if (partition.num_elements_d != 0 && last_block_stored)
                 {
                     if (MT == matrix_type::general)
                     {
@@ -321,7 +480,7 @@ namespace FP_NAMESPACE
                 }
 
                 const ptrdiff_t result = ptr - compressed_data;
-                if (result != partition.num_elements)
+                if (static_cast<std::size_t>(result) > partition.num_elements || (tag == nullptr && static_cast<std::size_t>(result) != partition.num_elements))
                 {
                     std::cerr << "error in matrix_base<..," << BM << "," << BE << ">::compress: out of bounds" << std::endl;
                 }
@@ -341,8 +500,9 @@ namespace FP_NAMESPACE
             //! \param extent matrix dimensions
             //! \param bs block size
             //! \param partition the matrix partitioning
+            //! \param tag (optional) tags of all blocks, if zero and constant blocks are not stored
             template <matrix_type MT>
-            static ptrdiff_t decompress(const fp_type* compressed_data, T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs, const partition_t& partition)
+            static ptrdiff_t decompress(const fp_type* compressed_data, T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs, const partition_t& partition, const block_tag_t* tag = nullptr)
             {
                 if (data == nullptr || compressed_data == nullptr)
                 {
@@ -358,9 +518,11 @@ namespace FP_NAMESPACE
                 constexpr bool lower_colmajor = (MT == matrix_type::lower_triangular) && (L == matrix_layout::colmajor);
 
                 // decompress the matrix block wise
-                alignas(alignment) T buffer[bs * bs];
+                internal::scratch_buffer<T> buffer(bs * bs);
                 // pointer to the first block
                 const fp_type* ptr = compressed_data;
+                const std::size_t num_block_cols = (n + bs - 1) / bs;
+                bool last_block_stored = true;
 
                 for (std::size_t j = 0; j < m; j += bs)
                 {
@@ -374,9 +536,20 @@ namespace FP_NAMESPACE
                     {
                         const std::size_t mm = std::min(m - j, bs);
                         const std::size_t nn = std::min(n - i, bs);
+                        const block_tag_t* block = (tag != nullptr ? &tag[(j / bs) * num_block_cols + (i / bs)] : nullptr);
+                        last_block_stored = (block == nullptr || block->kind == block_kind::dense);
                     
                         // decompress the 'buffer'
-                        if (MT == matrix_type::general)
+                        if (!last_block_stored)
+                        {
+                            // zero and constant blocks are not stored
+                            const std::size_t num_elements = (MT != matrix_type::general && i == j ? ((mm * (mm + 1)) / 2) : mm * nn);
+                            for (std::size_t kk = 0; kk < num_elements; ++kk)
+                            {
+                                buffer[kk] = block->value;
+                            }
+                        }
+                        else if (MT == matrix_type::general)
                         {
                             fp_stream<BM, BE>::decompress(ptr, &buffer[0], mm * nn);
                             // move on to the next block
@@ -384,7 +557,7 @@ namespace FP_NAMESPACE
                         }
                         else
                         {
-                            fp_stream<BM, BE>::decompress(ptr, buffer, (i == j ? ((mm * (mm + 1)) / 2) : mm * nn));
+                            fp_stream<BM, BE>::decompress(ptr, &buffer[0], (i == j ? ((mm * (mm + 1)) / 2) : mm * nn));
                             // move on to the next block
                             if (i == j)
                             {
@@ -428,7 +601,7 @@ namespace FP_NAMESPACE
                 }
 
                 // correct the last block's element count
-                if (partition.num_elements_d != 0)
+                if (partition.num_elements_d != 0 && last_block_stored)
                 {
                     if (MT == matrix_type::general)
                     {
@@ -441,7 +614,7 @@ namespace FP_NAMESPACE
                 }
 
                 const ptrdiff_t result = ptr - compressed_data;
-                if (result != partition.num_elements)
+                if (static_cast<std::size_t>(result) > partition.num_elements || (tag == nullptr && static_cast<std::size_t>(result) != partition.num_elements))
                 {
                     std::cerr << "error in matrix_base<..," << BM << "," << BE << ">::decompress: out of bounds" << std::endl;
                 }
@@ -505,8 +678,8 @@ namespace FP_NAMESPACE
 
                 // allocate local memory: work directly on 'y' if 'x' and 'y' do not overlap
                 const bool use_buffer = (same_mat_vec_type && std::abs(y - x) >= std::max(m, n) ? false : true);
-                alignas(alignment) Tmat buffer_x[use_buffer ? nm : 0];
-                alignas(alignment) Tmat buffer_y[use_buffer ? mn : 0];
+                internal::scratch_buffer<Tmat> buffer_x(use_buffer ? nm : 0);
+                internal::scratch_buffer<Tmat> buffer_y(use_buffer ? mn : 0);
 
                 // we use 'Tmat' for internal computation
                 const Tmat* ptr_x = nullptr;
@@ -588,385 +761,4714 @@ namespace FP_NAMESPACE
                 }
             }
 
-            // do not allow instantiation
-            matrix_base() = delete;
-
-        public:
-
-            std::size_t memory_footprint_elements() const
-            {
-                return partition.num_elements;
-            }
-
-            std::size_t memory_footprint_bytes() const
+            //! \brief Function body for different matrix multi-vector kernel implementations
+            //!
+            //! The same as 'blas2_frame', but for 'k' input and output vectors.
+            //! The vectors are stored one after another with leading dimensions 'ldx' and 'ldy'.
+            //!
+            //! \tparam F Lambda
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param kernel the operation (as a Lambda)
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param k number of vectors
+            //! \param beta scaling factor for the output vectors
+            //! \param y pointer to the output vectors
+            //! \param ldy leading dimension of 'y'
+            template <typename F, typename Tmat = T, typename Tvec = T>
+            void multi_vector_frame(const F& kernel, const bool transpose, const Tmat alpha, const Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec beta, Tvec* y, const std::size_t ldy) const
             {
-                return memory_footprint_elements() * sizeof(fp_type);
-            }
-
-        #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
-            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y) const = 0;                          \
-            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y) const = 0 \
-
-            MACRO_MATRIX_VECTOR(double, double);
-            MACRO_MATRIX_VECTOR(double, float);
-            MACRO_MATRIX_VECTOR(float, double);
-            MACRO_MATRIX_VECTOR(float, float);
-
-        #undef MACRO_MATRIX_VECTOR
-        };
-
-        //! \brief General matrix
-        //!
-        //! \tparam T initial data type before compression
-        //! \tparam L data layout/order (any of row major or column major)
-        //! \tparam BM number of bits in the exponent
-        //! \tparam BE number of bits in the mantissa
-        template <typename T, matrix_layout L = matrix_layout::rowmajor, std::uint32_t BM = ieee754_fp<T>::bm, std::uint32_t BE = ieee754_fp<T>::be>
-        class matrix : public matrix_base<T, L, BM, BE>
-        {
-            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
 
-            using this_class = matrix<T, L, BM, BE>;
-            using base_class = matrix_base<T, L, BM, BE>;
+                if (n == 0 || m == 0 || k == 0) return;
 
-            static constexpr CBLAS_LAYOUT cblas_layout = (L == matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+                static constexpr Tvec fvec_0 = static_cast<Tvec>(0.0);
+                static constexpr Tvec fvec_1 = static_cast<Tvec>(1.0);
 
-        public:
+                constexpr bool same_mat_vec_type = std::is_same<Tmat, Tvec>::value;
 
-            // extent of the matrix: 'm' rows and 'n' columns
-            using base_class::m;
-            using base_class::n;
+                const std::size_t mn = (transpose ? n : m);
+                const std::size_t nm = (transpose ? m : n);
 
-            // data type for the internal floating / fixed point representation
-            using fp_type = typename base_class::fp_type;
+                if (ldx < nm || ldy < mn)
+                {
+                    std::cerr << "error in matrix_base<..," << BM << "," << BE << ">::multi_vector_frame: leading dimension too small" << std::endl;
+                    return;
+                }
 
-            // (default) block size
-            static constexpr std::size_t bs_default = base_class::bs_default;
+                // work directly on 'x' and 'y' if they do not overlap
+                const bool use_buffer = (same_mat_vec_type && (y >= (x + k * ldx) || x >= (y + k * ldy)) ? false : true);
+                internal::scratch_buffer<Tmat> buffer_x(use_buffer && alpha != fmat_0 ? nm * k : 0);
+                internal::scratch_buffer<Tmat> buffer_y(use_buffer && alpha != fmat_0 ? mn * k : 0);
 
-        private:
+                if (use_buffer && alpha != fmat_0)
+                {
+                    // load the input before 'y' is touched: cast to 'Tmat' is implicit
+                    for (std::size_t c = 0; c < k; ++c)
+                    {
+                        for (std::size_t i = 0; i < nm; ++i)
+                        {
+                            buffer_x[c * nm + i] = x[c * ldx + i];
+                        }
+                    }
 
-            // block size
-            using base_class::bs;
+                    // zero the output buffer
+                    for (std::size_t j = 0; j < (mn * k); ++j)
+                    {
+                        buffer_y[j] = fmat_0;
+                    }
+                }
 
-            // compressed matrix
-            using base_class::memory;
-            using base_class::compressed_data;
+                // scale by 'beta'
+                if (beta != fvec_1)
+                {
+                    for (std::size_t c = 0; c < k; ++c)
+                    {
+                        for (std::size_t j = 0; j < mn; ++j)
+                        {
+                            y[c * ldy + j] = (beta == fvec_0 ? fvec_0 : beta * y[c * ldy + j]);
+                        }
+                    }
+                }
 
-            using partition_t = typename base_class::partition_t;
-            using base_class::partition;
+                if (alpha == fmat_0) return;
 
-        public:
+                if (use_buffer)
+                {
+                    // execute the kernel on the zeroed output buffer
+                    kernel(transpose, alpha, &buffer_x[0], nm, k, &buffer_y[0], mn);
 
-            // do not create a standard constructor
-            matrix() = delete;
+                    // accumulate on 'y'
+                    for (std::size_t c = 0; c < k; ++c)
+                    {
+                        for (std::size_t j = 0; j < mn; ++j)
+                        {
+                            y[c * ldy + j] += buffer_y[c * mn + j];
+                        }
+                    }
+                }
+                else
+                {
+                    // read / write directly from / to the input / output
+                    // note: the reinterpret cast is needed just for the compilation,
+                    //       but in all cases 'Tmat' is equal to 'Tvec'!
+                    kernel(transpose, alpha, reinterpret_cast<const Tmat*>(x), ldx, k, reinterpret_cast<Tmat*>(y), ldy);
+                }
+            }
 
-            //! \brief Constructor
+            //! \brief Apply a (decompressed) block to multiple vectors
             //!
-            //! This constructor applies the matrix compression:
-            //! if 'ld_data' is specified and larger than zero, it indicates that we are working on the raw input matrix.
+            //! Computes y = alpha * A(T) * x + y for 'k' vectors using a BLAS gemm call.
             //!
-            //! \param data pointer to the input matrix
-            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
-            //! \param extent matrix dimensions
-            //! \param bs block size
-            matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
-                :
-                base_class(data, ld_data, extent, bs)
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param transpose matrix transposition
+            //! \param mm number of rows of the block
+            //! \param nn number of columns of the block
+            //! \param k number of vectors
+            //! \param alpha scaling factor for the matrix
+            //! \param a pointer to the decompressed block (the leading dimension is 'nn' for row major and 'mm' for column major)
+            //! \param x pointer to the input vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param y pointer to the output vectors
+            //! \param ldy leading dimension of 'y'
+            template <typename Tmat>
+            static void matrix_multi_vector_block(const bool transpose, const std::size_t mm, const std::size_t nn, const std::size_t k, const Tmat alpha, const Tmat* a, const Tmat* x, const std::size_t ldx, Tmat* y, const std::size_t ldy)
             {
-                // create a compressed matrix with internal storage
-                if (ld_data > 0)
-                {
-                    // allocate memory for the compressed matrix
-                    memory.reserve(partition.num_elements);
-                    
-                    // compress the matrix
-                    base_class::template compress<matrix_type::general>(reinterpret_cast<const T*>(data), ld_data, &memory[0], extent, bs, partition);
-
-                    // set up the internal pointer to the compressed matrix
-                    compressed_data = reinterpret_cast<const fp_type*>(&memory[0]);
-                }
+                // the vectors are stored column major: a row major block is the transpose of a column major block
+                const bool transpose_colmajor = (L == matrix_layout::rowmajor ? !transpose : transpose);
+                const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
+                blas::gemm(CblasColMajor, (transpose_colmajor ? CblasTrans : CblasNoTrans), CblasNoTrans, (transpose ? nn : mm), k, (transpose ? mm : nn), alpha, a, lda, x, ldx, static_cast<Tmat>(1.0), y, ldy);
             }
 
-            //! \brief Constructor
+            //! \brief Get the tag of a block
             //!
-            //! \param data vector holding the input matrix
-            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
-            //! \param extent matrix dimensions
-            //! \param bs block size
-            matrix(const std::vector<T>& data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
-                :
-                matrix(&data[0], ld_data, extent, bs)
+            //! Without FP_CONSTANT_BLOCKS, all blocks are dense.
+            //!
+            //! \param bj block id (row)
+            //! \param bi block id (column)
+            //! \return tag of block (bj, bi)
+        #if defined(FP_CONSTANT_BLOCKS)
+            block_tag_t get_block_tag(const std::size_t bj, const std::size_t bi) const
             {
-                ;
+                return block_tag[bj * ((n + bs - 1) / bs) + bi];
+            }
+        #else
+            block_tag_t get_block_tag(const std::size_t, const std::size_t) const
+            {
+                return {block_kind::dense, static_cast<T>(0.0)};
             }
+        #endif
 
-            //! \brief Constructor
+            //! \brief Decompress a block
             //!
-            //! This constructor allows to bind an externally compressed matrix.
-            //! The internal storage then is not used.
-            //! For 'TT' being equal to 'T' and we cannot conclude that 'data' points to a compressed matrix.
-            //! We thus have to use an additional argument to to control the internal storage usage and data compression.
-            //! 
-            //! \param data pointer to either the compressed or uncompressed input matrix
-            //! \param extent matrix dimensions
-            //! \param bs block size
-            //! \param is_compressed (optional) 'data' points to a compressed matrix or not
-            template <typename TT, typename X = typename std::enable_if<std::is_same<T, TT>::value>::type>
-            matrix(const TT* data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default, const bool is_compressed = true)
-                :
-                // if 'data' points to a compressed matrix set 'ld_data' to zero to avoid using the internal storage,
-                // otherwise, deduce 'ld_data' from 'extent'
-                matrix(data, (is_compressed ? 0 : (L == matrix_layout::rowmajor ? extent[1] : extent[0])), extent, bs)
+            //! Zero and constant blocks are not stored: the output is filled with their value.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param bj block id (row)
+            //! \param bi block id (column)
+            //! \param offset offset of the block w.r.t. 'compressed_data'
+            //! \param a pointer to the decompressed block
+            //! \param num_elements number of elements of the block
+            template <typename Tmat>
+            void decompress_block(const std::size_t bj, const std::size_t bi, const std::size_t offset, Tmat* a, const std::size_t num_elements) const
             {
-                if (is_compressed)
+                const block_tag_t tag = get_block_tag(bj, bi);
+                if (tag.kind != block_kind::dense)
                 {
-                    if (std::is_same<TT, fp_type>::value)
+                    for (std::size_t k = 0; k < num_elements; ++k)
                     {
-                        // base class constructor makes sure that 'data' is not NULL
-                        compressed_data = reinterpret_cast<const fp_type*>(data);
-                    }
-                    else
-                    {
-                        std::cerr << "error in matrix<..," << BM << "," << BE << ">::matrix: external pointer type does not match fp_type" << std::endl;
+                        a[k] = static_cast<Tmat>(tag.value);
                     }
                 }
+                else
+                {
+                    fp_stream<BM, BE>::decompress(&compressed_data[offset], a, num_elements);
+                }
             }
 
-            //! \brief Constructor
+            //! \brief Matrix vector multiply for a block with all elements being the same
             //!
-            //! This constructor allows to bind an externally compressed matrix.
-            //! The internal storage then is not used.
-            //! This constructor complements the above one for 'T' not being equal to 'TT'.
-            //! In this case 'data' is assumed to point to an externally compressed matrix.
-            //! 
-            //! \param data pointer to the compressed input matrix
+            //! Computes y = alpha * value * A(T) * x + y, where all elements of A are one:
+            //! each output element is incremented by 'alpha * value' times the sum over 'x'.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param transpose matrix transposition
+            //! \param mm number of rows of the block
+            //! \param nn number of columns of the block
+            //! \param alpha scaling factor for the matrix (times the value of the block elements)
+            //! \param x pointer to the input vector
+            //! \param y pointer to the output vector
+            template <typename Tmat>
+            static void matrix_vector_constant(const bool transpose, const std::size_t mm, const std::size_t nn, const Tmat alpha, const Tmat* x, Tmat* y)
+            {
+                Tmat sum = static_cast<Tmat>(0.0);
+                for (std::size_t i = 0; i < (transpose ? mm : nn); ++i)
+                {
+                    sum += x[i];
+                }
+
+                for (std::size_t j = 0; j < (transpose ? nn : mm); ++j)
+                {
+                    y[j] += alpha * sum;
+                }
+            }
+
+            //! \brief Apply a (decompressed) block and its transpose in one pass over the block
+            //!
+            //! Computes y_1 = alpha * A * x_1 + y_1 and y_2 = alpha * A^T * x_2 + y_2, which is what an off-diagonal block
+            //! of a symmetric matrix contributes: each row (row major) or column (column major) of the block is used
+            //! for a dot product and an axpy operation at the same time.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param mm number of rows of the block
+            //! \param nn number of columns of the block
+            //! \param alpha scaling factor for the matrix
+            //! \param a pointer to the decompressed block (the leading dimension is 'nn' for row major and 'mm' for column major)
+            //! \param x_1 pointer to the input vector for the block ('nn' elements)
+            //! \param y_1 pointer to the output vector for the block ('mm' elements)
+            //! \param x_2 pointer to the input vector for the transposed block ('mm' elements)
+            //! \param y_2 pointer to the output vector for the transposed block ('nn' elements)
+            template <typename Tmat>
+            static void matrix_vector_symmetric_block(const std::size_t mm, const std::size_t nn, const Tmat alpha, const Tmat* a, const Tmat* x_1, Tmat* y_1, const Tmat* x_2, Tmat* y_2)
+            {
+                if (L == matrix_layout::rowmajor)
+                {
+                    for (std::size_t jj = 0; jj < mm; ++jj)
+                    {
+                        const Tmat* a_jj = &a[jj * nn];
+                        const Tmat x_2_jj = alpha * x_2[jj];
+                        Tmat sum = static_cast<Tmat>(0.0);
+                        #pragma omp simd reduction(+ : sum)
+                        for (std::size_t ii = 0; ii < nn; ++ii)
+                        {
+                            sum += a_jj[ii] * x_1[ii];
+                            y_2[ii] += a_jj[ii] * x_2_jj;
+                        }
+                        y_1[jj] += alpha * sum;
+                    }
+                }
+                else
+                {
+                    for (std::size_t ii = 0; ii < nn; ++ii)
+                    {
+                        const Tmat* a_ii = &a[ii * mm];
+                        const Tmat x_1_ii = alpha * x_1[ii];
+                        Tmat sum = static_cast<Tmat>(0.0);
+                        #pragma omp simd reduction(+ : sum)
+                        for (std::size_t jj = 0; jj < mm; ++jj)
+                        {
+                            y_1[jj] += a_ii[jj] * x_1_ii;
+                            sum += a_ii[jj] * x_2[jj];
+                        }
+                        y_2[ii] += alpha * sum;
+                    }
+                }
+            }
+
+        #if defined(FP_SIMD_AVX2)
+            // fused decompression and matrix vector multiplication is used for bfloat16, IEEE754 half and 8-bit floating point (both require F16C),
+            // and the bit-packed formats: for block floating point and the lane-interleaved layout, decompression into a buffer
+            // followed by gemv is faster for block sizes of 16 and larger, although both have a 'simd_decoder'
+            static constexpr bool use_fused_kernel_for_format = !internal::is_ieee754_fp_type<BM, BE>::value && !internal::is_fixed_point_type<BM, BE>::value
+                && !internal::is_block_floating_point_type<BM, BE>::value && !internal::is_lane_interleaved_type<BM, BE>::value;
+        #if defined(FP_SIMD_F16C)
+            static constexpr bool use_fused_kernel = use_fused_kernel_for_format;
+        #else
+            static constexpr bool use_fused_kernel = use_fused_kernel_for_format && !internal::is_ieee754_half_type<BM, BE>::value && !internal::is_fp8_type<BM, BE>::value;
+        #endif
+        #else
+            static constexpr bool use_fused_kernel = false;
+        #endif
+
+            // block sizes (number of elements) for which the fused kernel beats decompression followed by gemv (OpenBLAS, double vectors):
+            // it wins on blocks up to 16 x 16 elements, up to 8 x 8 elements for the bit-packed formats if decompression uses AVX-512.
+            // Decompression and gemv catch up from 32 x 32 elements on, until the decompressed block no longer fits into the L1 cache.
+            // For blocks of 128 x 128 elements and more, the fused kernel wins again, but only for the floating point formats
+            static constexpr std::size_t fused_kernel_max_block_elements = 16 * 16;
+            static constexpr std::size_t fused_kernel_max_block_elements_avx512 = (fp_stream<BM, BE>::is_bit_packed_type ? 8 * 8 : 16 * 16);
+            static constexpr std::size_t fused_kernel_min_large_block_elements = (fp_stream<BM, BE>::is_bit_packed_type ? 0 : 128 * 128);
+
+            //! \brief Horizontal reduction of AVX registers
+            FP_TARGET_AVX2 static inline double hsum(const __m256d in)
+            {
+                const __m128d tmp = _mm_add_pd(_mm256_castpd256_pd128(in), _mm256_extractf128_pd(in, 1));
+                return _mm_cvtsd_f64(_mm_add_sd(tmp, _mm_unpackhi_pd(tmp, tmp)));
+            }
+
+            FP_TARGET_AVX2 static inline float hsum(const __m256 in)
+            {
+                __m128 tmp = _mm_add_ps(_mm256_castps256_ps128(in), _mm256_extractf128_ps(in, 1));
+                tmp = _mm_add_ps(tmp, _mm_movehl_ps(tmp, tmp));
+                return _mm_cvtss_f32(_mm_add_ss(tmp, _mm_shuffle_ps(tmp, tmp, 0x1)));
+            }
+
+            //! \brief Fused decompression and dot products of 'N' consecutive rows (row major) or columns (column major) with 'x'
+            //!
+            //! Computes y[j] += alpha * dot(A[j], x) for j = 0..('N' - 1).
+            //! If the rows / columns are not a multiple of the SIMD width, the last chunk is masked.
+            //!
+            //! \tparam N number of rows / columns
+            //! \tparam D decoder type
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param decoder decoder of the compressed block
+            //! \param k position of the first element of the first row / column within the block
+            //! \param ld number of elements per row / column
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vector
+            //! \param y pointer to the output vector
+            template <std::size_t N, typename D, typename Tmat>
+            FP_TARGET_AVX2 static inline void dot_fused(const D& decoder, const std::size_t k, const std::size_t ld, const Tmat alpha, const Tmat* x, Tmat* y)
+            {
+                constexpr std::size_t width = D::width;
+                const std::size_t ld_simd = (ld / width) * width;
+                // masks for the remainder: 32-bit lanes for 'float', and 64-bit lanes for 'double'
+                const __m256i mask_ps = _mm256_cmpgt_epi32(_mm256_set1_epi32(ld - ld_simd), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+                if (std::is_same<Tmat, double>::value)
+                {
+                    const double* ptr_x = reinterpret_cast<const double*>(x);
+                    __m256d acc_1[N], acc_2[N];
+                    for (std::size_t jj = 0; jj < N; ++jj)
+                    {
+                        acc_1[jj] = _mm256_setzero_pd();
+                        acc_2[jj] = _mm256_setzero_pd();
+                    }
+
+                    for (std::size_t i = 0; i < ld_simd; i += width)
+                    {
+                        const __m256d v_x_1 = _mm256_loadu_pd(&ptr_x[i]);
+                        const __m256d v_x_2 = _mm256_loadu_pd(&ptr_x[i + 4]);
+                        for (std::size_t jj = 0; jj < N; ++jj)
+                        {
+                            const __m256 v_a = decoder.load(k + jj * ld + i);
+                            acc_1[jj] = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v_a)), v_x_1, acc_1[jj]);
+                            acc_2[jj] = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(v_a, 1)), v_x_2, acc_2[jj]);
+                        }
+                    }
+
+                    if (ld_simd < ld)
+                    {
+                        // mask out elements beyond the row / column
+                        const __m256d v_x_1 = _mm256_maskload_pd(&ptr_x[ld_simd], _mm256_cvtepi32_epi64(_mm256_castsi256_si128(mask_ps)));
+                        const __m256d v_x_2 = _mm256_maskload_pd(&ptr_x[ld_simd + 4], _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask_ps, 1)));
+                        for (std::size_t jj = 0; jj < N; ++jj)
+                        {
+                            const __m256 v_a = _mm256_and_ps(decoder.load(k + jj * ld + ld_simd), _mm256_castsi256_ps(mask_ps));
+                            acc_1[jj] = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v_a)), v_x_1, acc_1[jj]);
+                            acc_2[jj] = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(v_a, 1)), v_x_2, acc_2[jj]);
+                        }
+                    }
+
+                    for (std::size_t jj = 0; jj < N; ++jj)
+                    {
+                        y[jj] += alpha * static_cast<Tmat>(hsum(_mm256_add_pd(acc_1[jj], acc_2[jj])));
+                    }
+                }
+                else
+                {
+                    const float* ptr_x = reinterpret_cast<const float*>(x);
+                    __m256 acc[N];
+                    for (std::size_t jj = 0; jj < N; ++jj)
+                    {
+                        acc[jj] = _mm256_setzero_ps();
+                    }
+
+                    for (std::size_t i = 0; i < ld_simd; i += width)
+                    {
+                        const __m256 v_x = _mm256_loadu_ps(&ptr_x[i]);
+                        for (std::size_t jj = 0; jj < N; ++jj)
+                        {
+                            acc[jj] = _mm256_fmadd_ps(decoder.load(k + jj * ld + i), v_x, acc[jj]);
+                        }
+                    }
+
+                    if (ld_simd < ld)
+                    {
+                        // mask out elements beyond the row / column
+                        const __m256 v_x = _mm256_maskload_ps(&ptr_x[ld_simd], mask_ps);
+                        for (std::size_t jj = 0; jj < N; ++jj)
+                        {
+                            acc[jj] = _mm256_fmadd_ps(_mm256_and_ps(decoder.load(k + jj * ld + ld_simd), _mm256_castsi256_ps(mask_ps)), v_x, acc[jj]);
+                        }
+                    }
+
+                    for (std::size_t jj = 0; jj < N; ++jj)
+                    {
+                        y[jj] += alpha * static_cast<Tmat>(hsum(acc[jj]));
+                    }
+                }
+            }
+
+            //! \brief Fused decompression and general matrix vector multiplication on a single block
+            //!
+            //! Computes y = alpha * A(T) * x + y without decompressing the block into a buffer:
+            //! the block is decompressed a few elements at a time, which are fed directly into FMA operations.
+            //! Depending on the layout and transposition, the block is processed as a sequence of dot products or axpy operations
+            //! on its rows (row major) or columns (column major).
+            //! If these are not a multiple of the SIMD width, the last chunk is masked.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param transpose matrix transposition
+            //! \param m number of rows of the block
+            //! \param n number of columns of the block
+            //! \param alpha scaling factor for the matrix
+            //! \param a pointer to the compressed block
+            //! \param x pointer to the input vector
+            //! \param y pointer to the output vector
+            template <typename Tmat, bool Enabled = use_fused_kernel>
+            FP_TARGET_AVX2 static typename std::enable_if<Enabled>::type matrix_vector_fused(const bool transpose, const std::size_t m, const std::size_t n, const Tmat alpha, const fp_type* a, const Tmat* x, Tmat* y)
+            {
+                using decoder_t = typename fp_stream<BM, BE>::simd_decoder;
+                constexpr std::size_t width = decoder_t::width;
+                constexpr bool use_double = std::is_same<Tmat, double>::value;
+
+                // elements per row (row major) or column (column major)
+                const std::size_t ld = (L == matrix_layout::rowmajor ? n : m);
+                const std::size_t num_lines = (L == matrix_layout::rowmajor ? m : n);
+                const std::size_t ld_simd = (ld / width) * width;
+                const decoder_t decoder(a, m * n);
+
+                // masks for the remainder: 32-bit lanes for 'float', and 64-bit lanes for 'double'
+                const __m256i mask_ps = _mm256_cmpgt_epi32(_mm256_set1_epi32(ld - ld_simd), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+                const __m256i mask_pd_1 = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(mask_ps));
+                const __m256i mask_pd_2 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask_ps, 1));
+
+                if ((L == matrix_layout::rowmajor) != transpose)
+                {
+                    // dot products: row major (no transposition) or column major (transposition)
+                    // 4 rows / columns at a time to have independent accumulation chains
+                    std::size_t j = 0;
+                    for ( ; (j + 4) <= num_lines; j += 4)
+                    {
+                        dot_fused<4>(decoder, j * ld, ld, alpha, x, &y[j]);
+                    }
+                    for ( ; j < num_lines; ++j)
+                    {
+                        dot_fused<1>(decoder, j * ld, ld, alpha, x, &y[j]);
+                    }
+                }
+                else
+                {
+                    // axpy operations: row major (transposition) or column major (no transposition)
+                    for (std::size_t j = 0, k = 0; j < num_lines; ++j, k += ld)
+                    {
+                        if (use_double)
+                        {
+                            double* ptr_y = reinterpret_cast<double*>(y);
+                            const __m256d v_x = _mm256_set1_pd(alpha * x[j]);
+                            for (std::size_t i = 0; i < ld_simd; i += width)
+                            {
+                                const __m256 v_a = decoder.load(k + i);
+                                _mm256_storeu_pd(&ptr_y[i], _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v_a)), v_x, _mm256_loadu_pd(&ptr_y[i])));
+                                _mm256_storeu_pd(&ptr_y[i + 4], _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(v_a, 1)), v_x, _mm256_loadu_pd(&ptr_y[i + 4])));
+                            }
+                            if (ld_simd < ld)
+                            {
+                                // do not touch 'y' beyond the row / column
+                                const __m256 v_a = decoder.load(k + ld_simd);
+                                _mm256_maskstore_pd(&ptr_y[ld_simd], mask_pd_1, _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(v_a)), v_x, _mm256_maskload_pd(&ptr_y[ld_simd], mask_pd_1)));
+                                _mm256_maskstore_pd(&ptr_y[ld_simd + 4], mask_pd_2, _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(v_a, 1)), v_x, _mm256_maskload_pd(&ptr_y[ld_simd + 4], mask_pd_2)));
+                            }
+                        }
+                        else
+                        {
+                            float* ptr_y = reinterpret_cast<float*>(y);
+                            const __m256 v_x = _mm256_set1_ps(alpha * x[j]);
+                            for (std::size_t i = 0; i < ld_simd; i += width)
+                            {
+                                _mm256_storeu_ps(&ptr_y[i], _mm256_fmadd_ps(decoder.load(k + i), v_x, _mm256_loadu_ps(&ptr_y[i])));
+                            }
+                            if (ld_simd < ld)
+                            {
+                                // do not touch 'y' beyond the row / column
+                                _mm256_maskstore_ps(&ptr_y[ld_simd], mask_ps, _mm256_fmadd_ps(decoder.load(k + ld_simd), v_x, _mm256_maskload_ps(&ptr_y[ld_simd], mask_ps)));
+                            }
+                        }
+                    }
+                }
+            }
+
+        #if defined(FP_INTEGER_GEMV)
+            //! \brief Integer matrix vector multiplication on a fixed point block
+            //!
+            //! The integer kernels accept fixed point formats only (see integer_blas.hpp).
+            //! The call sites branch on 'is_fixed_point_type' at runtime: for all other formats they are never reached,
+            //! and these overloads do nothing, so that the integer kernels are not instantiated for them.
+            template <typename Tmat, bool Enabled = internal::is_fixed_point_type<BM, BE>::value>
+            static typename std::enable_if<Enabled>::type integer_gemv(const bool transpose, const std::size_t m, const std::size_t n, const fp_type* a, const Tmat* x, Tmat* y)
+            {
+                blas::gemv(L, transpose, m, n, a, x, y);
+            }
+
+            template <typename Tmat, bool Enabled = internal::is_fixed_point_type<BM, BE>::value>
+            static typename std::enable_if<!Enabled>::type integer_gemv(const bool, const std::size_t, const std::size_t, const fp_type*, const Tmat*, Tmat*)
+            {
+            }
+
+            //! \brief Integer matrix multi-vector multiplication on a fixed point block
+            //!
+            //! See 'integer_gemv'.
+            template <typename Tmat, bool Enabled = internal::is_fixed_point_type<BM, BE>::value>
+            static typename std::enable_if<Enabled>::type integer_gemm(const bool transpose, const std::size_t m, const std::size_t n, const std::size_t k, const fp_type* a, const Tmat* x, const std::size_t ldx, Tmat* y, const std::size_t ldy)
+            {
+                blas::gemm(L, transpose, m, n, k, a, x, ldx, y, ldy);
+            }
+
+            template <typename Tmat, bool Enabled = internal::is_fixed_point_type<BM, BE>::value>
+            static typename std::enable_if<!Enabled>::type integer_gemm(const bool, const std::size_t, const std::size_t, const std::size_t, const fp_type*, const Tmat*, const std::size_t, Tmat*, const std::size_t)
+            {
+            }
+
+            //! \brief Integer matrix vector multiplication with the block and its transpose on a fixed point block
+            //!
+            //! See 'integer_gemv'.
+            template <typename Tmat, bool Enabled = internal::is_fixed_point_type<BM, BE>::value>
+            static typename std::enable_if<Enabled>::type integer_gem2v(const std::size_t m, const std::size_t n, const fp_type* a, const Tmat* x_1, Tmat* y_1, const Tmat* x_2, Tmat* y_2)
+            {
+                blas::gem2v(L, m, n, a, x_1, y_1, x_2, y_2);
+            }
+
+            template <typename Tmat, bool Enabled = internal::is_fixed_point_type<BM, BE>::value>
+            static typename std::enable_if<!Enabled>::type integer_gem2v(const std::size_t, const std::size_t, const fp_type*, const Tmat*, Tmat*, const Tmat*, Tmat*)
+            {
+            }
+        #endif
+
+            //! \brief Fused decompression and general matrix vector multiplication on a single block, if available
+            //!
+            //! The fused kernel is used if it is available for the compression scheme, the CPU supports AVX2, and it is faster
+            //! than decompression followed by gemv for the block size (see 'fused_kernel_max_block_elements').
+            //! Otherwise, nothing is computed and the caller has to decompress the block.
+            //!
+            //! \return true if the fused kernel has been applied
+            template <typename Tmat, bool Enabled = use_fused_kernel>
+            static typename std::enable_if<Enabled, bool>::type try_matrix_vector_fused(const bool transpose, const std::size_t m, const std::size_t n, const Tmat alpha, const fp_type* a, const Tmat* x, Tmat* y)
+            {
+                if (!internal::use_simd_isa(simd_isa::avx2)) return false;
+
+                const std::size_t num_elements = m * n;
+                const std::size_t max_block_elements = (internal::use_simd_isa(simd_isa::avx512) ? fused_kernel_max_block_elements_avx512 : fused_kernel_max_block_elements);
+                const bool large_block = (fused_kernel_min_large_block_elements > 0 && num_elements >= fused_kernel_min_large_block_elements);
+                if (num_elements > max_block_elements && !large_block) return false;
+
+                matrix_vector_fused(transpose, m, n, alpha, a, x, y);
+                return true;
+            }
+
+            template <typename Tmat, bool Enabled = use_fused_kernel>
+            static typename std::enable_if<!Enabled, bool>::type try_matrix_vector_fused(const bool, const std::size_t, const std::size_t, const Tmat, const fp_type*, const Tmat*, Tmat*)
+            {
+                return false;
+            }
+
+            //! \brief Fused decompression, dot products and axpy operations on 'N' consecutive rows (row major) or columns (column major)
+            //!
+            //! Computes y_dot[j] += alpha * dot(A[j], x_dot) and y_axpy += alpha * x_axpy[j] * A[j] for j = 0..('N' - 1):
+            //! each decompressed element is used for both of them, and 'y_axpy' is loaded and stored once for all 'N' rows / columns.
+            //! If the rows / columns are not a multiple of the SIMD width, the last chunk is masked.
+            //!
+            //! \tparam N number of rows / columns
+            //! \tparam D decoder type
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param decoder decoder of the compressed block
+            //! \param k position of the first element of the first row / column within the block
+            //! \param ld number of elements per row / column
+            //! \param alpha scaling factor for the matrix
+            //! \param x_dot pointer to the input vector of the dot products
+            //! \param y_dot pointer to the output vector of the dot products
+            //! \param x_axpy pointer to the input vector of the axpy operations
+            //! \param y_axpy pointer to the output vector of the axpy operations
+            template <std::size_t N, typename D, typename Tmat>
+            FP_TARGET_AVX2 static inline void dot_axpy_fused(const D& decoder, const std::size_t k, const std::size_t ld, const Tmat alpha, const Tmat* x_dot, Tmat* y_dot, const Tmat* x_axpy, Tmat* y_axpy)
+            {
+                constexpr std::size_t width = D::width;
+                const std::size_t ld_simd = (ld / width) * width;
+                // masks for the remainder: 32-bit lanes for 'float', and 64-bit lanes for 'double'
+                const __m256i mask_ps = _mm256_cmpgt_epi32(_mm256_set1_epi32(ld - ld_simd), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+                if (std::is_same<Tmat, double>::value)
+                {
+                    const double* ptr_x_dot = reinterpret_cast<const double*>(x_dot);
+                    double* ptr_y_axpy = reinterpret_cast<double*>(y_axpy);
+                    const __m256i mask_pd_1 = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(mask_ps));
+                    const __m256i mask_pd_2 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(mask_ps, 1));
+                    __m256d acc_1[N], acc_2[N], v_x_axpy[N];
+                    for (std::size_t jj = 0; jj < N; ++jj)
+                    {
+                        acc_1[jj] = _mm256_setzero_pd();
+                        acc_2[jj] = _mm256_setzero_pd();
+                        v_x_axpy[jj] = _mm256_set1_pd(alpha * x_axpy[jj]);
+                    }
+
+                    for (std::size_t i = 0; i < ld_simd; i += width)
+                    {
+                        const __m256d v_x_1 = _mm256_loadu_pd(&ptr_x_dot[i]);
+                        const __m256d v_x_2 = _mm256_loadu_pd(&ptr_x_dot[i + 4]);
+                        __m256d v_y_1 = _mm256_loadu_pd(&ptr_y_axpy[i]);
+                        __m256d v_y_2 = _mm256_loadu_pd(&ptr_y_axpy[i + 4]);
+                        for (std::size_t jj = 0; jj < N; ++jj)
+                        {
+                            const __m256 v_a = decoder.load(k + jj * ld + i);
+                            const __m256d v_a_1 = _mm256_cvtps_pd(_mm256_castps256_ps128(v_a));
+                            const __m256d v_a_2 = _mm256_cvtps_pd(_mm256_extractf128_ps(v_a, 1));
+                            acc_1[jj] = _mm256_fmadd_pd(v_a_1, v_x_1, acc_1[jj]);
+                            acc_2[jj] = _mm256_fmadd_pd(v_a_2, v_x_2, acc_2[jj]);
+                            v_y_1 = _mm256_fmadd_pd(v_a_1, v_x_axpy[jj], v_y_1);
+                            v_y_2 = _mm256_fmadd_pd(v_a_2, v_x_axpy[jj], v_y_2);
+                        }
+                        _mm256_storeu_pd(&ptr_y_axpy[i], v_y_1);
+                        _mm256_storeu_pd(&ptr_y_axpy[i + 4], v_y_2);
+                    }
+
+                    if (ld_simd < ld)
+                    {
+                        // mask out elements beyond the row / column, and do not touch 'y_axpy' beyond the row / column
+                        const __m256d v_x_1 = _mm256_maskload_pd(&ptr_x_dot[ld_simd], mask_pd_1);
+                        const __m256d v_x_2 = _mm256_maskload_pd(&ptr_x_dot[ld_simd + 4], mask_pd_2);
+                        __m256d v_y_1 = _mm256_maskload_pd(&ptr_y_axpy[ld_simd], mask_pd_1);
+                        __m256d v_y_2 = _mm256_maskload_pd(&ptr_y_axpy[ld_simd + 4], mask_pd_2);
+                        for (std::size_t jj = 0; jj < N; ++jj)
+                        {
+                            const __m256 v_a = _mm256_and_ps(decoder.load(k + jj * ld + ld_simd), _mm256_castsi256_ps(mask_ps));
+                            const __m256d v_a_1 = _mm256_cvtps_pd(_mm256_castps256_ps128(v_a));
+                            const __m256d v_a_2 = _mm256_cvtps_pd(_mm256_extractf128_ps(v_a, 1));
+                            acc_1[jj] = _mm256_fmadd_pd(v_a_1, v_x_1, acc_1[jj]);
+                            acc_2[jj] = _mm256_fmadd_pd(v_a_2, v_x_2, acc_2[jj]);
+                            v_y_1 = _mm256_fmadd_pd(v_a_1, v_x_axpy[jj], v_y_1);
+                            v_y_2 = _mm256_fmadd_pd(v_a_2, v_x_axpy[jj], v_y_2);
+                        }
+                        _mm256_maskstore_pd(&ptr_y_axpy[ld_simd], mask_pd_1, v_y_1);
+                        _mm256_maskstore_pd(&ptr_y_axpy[ld_simd + 4], mask_pd_2, v_y_2);
+                    }
+
+                    for (std::size_t jj = 0; jj < N; ++jj)
+                    {
+                        y_dot[jj] += alpha * static_cast<Tmat>(hsum(_mm256_add_pd(acc_1[jj], acc_2[jj])));
+                    }
+                }
+                else
+                {
+                    const float* ptr_x_dot = reinterpret_cast<const float*>(x_dot);
+                    float* ptr_y_axpy = reinterpret_cast<float*>(y_axpy);
+                    __m256 acc[N], v_x_axpy[N];
+                    for (std::size_t jj = 0; jj < N; ++jj)
+                    {
+                        acc[jj] = _mm256_setzero_ps();
+                        v_x_axpy[jj] = _mm256_set1_ps(alpha * x_axpy[jj]);
+                    }
+
+                    for (std::size_t i = 0; i < ld_simd; i += width)
+                    {
+                        const __m256 v_x = _mm256_loadu_ps(&ptr_x_dot[i]);
+                        __m256 v_y = _mm256_loadu_ps(&ptr_y_axpy[i]);
+                        for (std::size_t jj = 0; jj < N; ++jj)
+                        {
+                            const __m256 v_a = decoder.load(k + jj * ld + i);
+                            acc[jj] = _mm256_fmadd_ps(v_a, v_x, acc[jj]);
+                            v_y = _mm256_fmadd_ps(v_a, v_x_axpy[jj], v_y);
+                        }
+                        _mm256_storeu_ps(&ptr_y_axpy[i], v_y);
+                    }
+
+                    if (ld_simd < ld)
+                    {
+                        // mask out elements beyond the row / column, and do not touch 'y_axpy' beyond the row / column
+                        const __m256 v_x = _mm256_maskload_ps(&ptr_x_dot[ld_simd], mask_ps);
+                        __m256 v_y = _mm256_maskload_ps(&ptr_y_axpy[ld_simd], mask_ps);
+                        for (std::size_t jj = 0; jj < N; ++jj)
+                        {
+                            const __m256 v_a = _mm256_and_ps(decoder.load(k + jj * ld + ld_simd), _mm256_castsi256_ps(mask_ps));
+                            acc[jj] = _mm256_fmadd_ps(v_a, v_x, acc[jj]);
+                            v_y = _mm256_fmadd_ps(v_a, v_x_axpy[jj], v_y);
+                        }
+                        _mm256_maskstore_ps(&ptr_y_axpy[ld_simd], mask_ps, v_y);
+                    }
+
+                    for (std::size_t jj = 0; jj < N; ++jj)
+                    {
+                        y_dot[jj] += alpha * static_cast<Tmat>(hsum(acc[jj]));
+                    }
+                }
+            }
+
+            //! \brief Fused decompression and symmetric matrix vector multiplication on a single (off-diagonal) block
+            //!
+            //! Computes y_1 = alpha * A * x_1 + y_1 and y_2 = alpha * A^T * x_2 + y_2 (see 'matrix_vector_symmetric_block')
+            //! without decompressing the block into a buffer: each decompressed element is read once and fed into the
+            //! FMA operations of both products. Rows (row major) or columns (column major) are processed 4 at a time.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param m number of rows of the block
+            //! \param n number of columns of the block
+            //! \param alpha scaling factor for the matrix
+            //! \param a pointer to the compressed block
+            //! \param x_1 pointer to the input vector for the block ('n' elements)
+            //! \param y_1 pointer to the output vector for the block ('m' elements)
+            //! \param x_2 pointer to the input vector for the transposed block ('m' elements)
+            //! \param y_2 pointer to the output vector for the transposed block ('n' elements)
+            template <typename Tmat, bool Enabled = use_fused_kernel>
+            FP_TARGET_AVX2 static typename std::enable_if<Enabled>::type matrix_vector_symmetric_fused(const std::size_t m, const std::size_t n, const Tmat alpha, const fp_type* a, const Tmat* x_1, Tmat* y_1, const Tmat* x_2, Tmat* y_2)
+            {
+                using decoder_t = typename fp_stream<BM, BE>::simd_decoder;
+                const decoder_t decoder(a, m * n);
+
+                // row major: dot products of the rows with 'x_1', and axpy operations on 'y_2'
+                // column major: dot products of the columns with 'x_2', and axpy operations on 'y_1'
+                const std::size_t ld = (L == matrix_layout::rowmajor ? n : m);
+                const std::size_t num_lines = (L == matrix_layout::rowmajor ? m : n);
+                const Tmat* x_dot = (L == matrix_layout::rowmajor ? x_1 : x_2);
+                Tmat* y_dot = (L == matrix_layout::rowmajor ? y_1 : y_2);
+                const Tmat* x_axpy = (L == matrix_layout::rowmajor ? x_2 : x_1);
+                Tmat* y_axpy = (L == matrix_layout::rowmajor ? y_2 : y_1);
+
+                std::size_t j = 0;
+                for ( ; (j + 4) <= num_lines; j += 4)
+                {
+                    dot_axpy_fused<4>(decoder, j * ld, ld, alpha, x_dot, &y_dot[j], &x_axpy[j], y_axpy);
+                }
+                for ( ; j < num_lines; ++j)
+                {
+                    dot_axpy_fused<1>(decoder, j * ld, ld, alpha, x_dot, &y_dot[j], &x_axpy[j], y_axpy);
+                }
+            }
+
+            //! \brief Fused decompression and symmetric matrix vector multiplication on a single (off-diagonal) block, if available
+            //!
+            //! See 'try_matrix_vector_fused'.
+            //!
+            //! \return true if the fused kernel has been applied
+            template <typename Tmat, bool Enabled = use_fused_kernel>
+            static typename std::enable_if<Enabled, bool>::type try_matrix_vector_symmetric_fused(const std::size_t m, const std::size_t n, const Tmat alpha, const fp_type* a, const Tmat* x_1, Tmat* y_1, const Tmat* x_2, Tmat* y_2)
+            {
+                if (!internal::use_simd_isa(simd_isa::avx2)) return false;
+
+                matrix_vector_symmetric_fused(m, n, alpha, a, x_1, y_1, x_2, y_2);
+                return true;
+            }
+
+            template <typename Tmat, bool Enabled = use_fused_kernel>
+            static typename std::enable_if<!Enabled, bool>::type try_matrix_vector_symmetric_fused(const std::size_t, const std::size_t, const Tmat, const fp_type*, const Tmat*, Tmat*, const Tmat*, Tmat*)
+            {
+                return false;
+            }
+
+            // do not allow instantiation
+            matrix_base() = delete;
+
+        public:
+
+            std::size_t memory_footprint_elements() const
+            {
+            #if defined(FP_CONSTANT_BLOCKS)
+                return num_elements_stored;
+            #else
+                return partition.num_elements;
+            #endif
+            }
+
+            virtual std::size_t memory_footprint_bytes() const
+            {
+            #if defined(FP_CONSTANT_BLOCKS)
+                // the block offsets and tags are part of the compressed matrix
+                return memory_footprint_elements() * sizeof(fp_type) + block_offset.size() * sizeof(std::size_t) + block_tag.size() * sizeof(block_tag_t);
+            #else
+                return memory_footprint_elements() * sizeof(fp_type);
+            #endif
+            }
+        };
+
+        //! \brief General matrix
+        //!
+        //! \tparam T initial data type before compression
+        //! \tparam L data layout/order (any of row major or column major)
+        //! \tparam BM number of bits in the exponent
+        //! \tparam BE number of bits in the mantissa
+        template <typename T, matrix_layout L = matrix_layout::rowmajor, std::uint32_t BM = ieee754_fp<T>::bm, std::uint32_t BE = ieee754_fp<T>::be>
+        class matrix : public matrix_base<T, L, BM, BE>
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+
+            using this_class = matrix<T, L, BM, BE>;
+            using base_class = matrix_base<T, L, BM, BE>;
+
+            static constexpr CBLAS_LAYOUT cblas_layout = (L == matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+        public:
+
+            // extent of the matrix: 'm' rows and 'n' columns
+            using base_class::m;
+            using base_class::n;
+
+            // data type for the internal floating / fixed point representation
+            using fp_type = typename base_class::fp_type;
+
+            // (default) block size
+            static constexpr std::size_t bs_default = base_class::bs_default;
+
+        private:
+
+            // block size
+            using base_class::bs;
+
+            // compressed matrix
+            using base_class::memory;
+            using base_class::compressed_data;
+
+            using partition_t = typename base_class::partition_t;
+            using base_class::partition;
+        #if defined(FP_BLOCK_OFFSET_TABLE)
+            using base_class::block_offset;
+        #endif
+
+            using block_kind = typename base_class::block_kind;
+            using block_tag_t = typename base_class::block_tag_t;
+        #if defined(FP_CONSTANT_BLOCKS)
+            using base_class::block_tag;
+            using base_class::num_elements_stored;
+        #endif
+
+            //! \brief Block offset computation
+            //!
+            //! get the offset w.r.t. to 0 for the block with Id=(bj, bi)
+            //!
+            //! \param bj block id
+            //! \param bi block id
+            //! \return offset w.r.t. to 0
+            std::size_t get_offset(const std::size_t bj, const std::size_t bi) const
+            {
+            #if defined(FP_BLOCK_OFFSET_TABLE)
+                return block_offset[bj * ((n + bs - 1) / bs) + bi];
+            #else
+                // all block rows except for the last one have the same number of elements
+                const std::size_t n_row = (n / bs) * partition.num_elements_a + ((n % bs) != 0 ? partition.num_elements_b : 0);
+
+                return (bj * n_row + bi * ((m - bj * bs) < bs ? partition.num_elements_c : partition.num_elements_a));
+            #endif
+            }
+
+        public:
+
+            // do not create a standard constructor
+            matrix() = delete;
+
+            //! \brief Constructor
+            //!
+            //! This constructor applies the matrix compression:
+            //! if 'ld_data' is specified and larger than zero, it indicates that we are working on the raw input matrix.
+            //!
+            //! \param data pointer to the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+                :
+                base_class(data, ld_data, extent, bs)
+            {
+            #if defined(FP_CONSTANT_BLOCKS)
+                // all blocks are dense unless the matrix compression finds zero or constant blocks
+                block_tag.assign(((m + bs - 1) / bs) * ((n + bs - 1) / bs), {block_kind::dense, static_cast<T>(0.0)});
+            #endif
+            #if defined(FP_BLOCK_OFFSET_TABLE)
+                block_offset = base_class::template make_block_offset_table<matrix_type::general>(extent, bs, partition);
+            #endif
+
+                // create a compressed matrix with internal storage
+                if (ld_data > 0)
+                {
+                #if defined(FP_CONSTANT_BLOCKS)
+                    // allocate memory for the compressed matrix
+                    memory.resize(partition.num_elements);
+
+                    // compress the matrix: zero and constant blocks are not stored, which changes the block offsets
+                    num_elements_stored = base_class::template compress<matrix_type::general>(reinterpret_cast<const T*>(data), ld_data, memory.data(), extent, bs, partition, block_tag.data());
+                    block_offset = base_class::template make_block_offset_table<matrix_type::general>(extent, bs, partition, block_tag.data());
+
+                    // release the memory of the blocks not stored: blocks are now packed densely and the SIMD decoders
+                    // may read up to one 256-bit word beyond the end of the last block
+                    memory.resize(num_elements_stored + (32 + sizeof(fp_type) - 1) / sizeof(fp_type));
+                    memory.shrink_to_fit();
+                #else
+                    // allocate memory for the compressed matrix
+                    memory.reserve(partition.num_elements);
+                    
+                    // compress the matrix
+                    base_class::template compress<matrix_type::general>(reinterpret_cast<const T*>(data), ld_data, &memory[0], extent, bs, partition);
+                #endif
+
+                    // set up the internal pointer to the compressed matrix
+                    compressed_data = reinterpret_cast<const fp_type*>(&memory[0]);
+                }
+            }
+
+            //! \brief Constructor
+            //!
+            //! \param data vector holding the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            matrix(const std::vector<T>& data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+                :
+                matrix(&data[0], ld_data, extent, bs)
+            {
+                ;
+            }
+
+            //! \brief Constructor
+            //!
+            //! This constructor allows to bind an externally compressed matrix.
+            //! The internal storage then is not used.
+            //! For 'TT' being equal to 'T' and we cannot conclude that 'data' points to a compressed matrix.
+            //! We thus have to use an additional argument to to control the internal storage usage and data compression.
+            //! 
+            //! \param data pointer to either the compressed or uncompressed input matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            //! \param is_compressed (optional) 'data' points to a compressed matrix or not
+            template <typename TT, typename X = typename std::enable_if<std::is_same<T, TT>::value>::type>
+            matrix(const TT* data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default, const bool is_compressed = true)
+                :
+                // if 'data' points to a compressed matrix set 'ld_data' to zero to avoid using the internal storage,
+                // otherwise, deduce 'ld_data' from 'extent'
+                matrix(data, (is_compressed ? 0 : (L == matrix_layout::rowmajor ? extent[1] : extent[0])), extent, bs)
+            {
+                if (is_compressed)
+                {
+                    if (std::is_same<TT, fp_type>::value)
+                    {
+                        // base class constructor makes sure that 'data' is not NULL
+                        compressed_data = reinterpret_cast<const fp_type*>(data);
+                    }
+                    else
+                    {
+                        std::cerr << "error in matrix<..," << BM << "," << BE << ">::matrix: external pointer type does not match fp_type" << std::endl;
+                    }
+                }
+            }
+
+            //! \brief Constructor
+            //!
+            //! This constructor allows to bind an externally compressed matrix.
+            //! The internal storage then is not used.
+            //! This constructor complements the above one for 'T' not being equal to 'TT'.
+            //! In this case 'data' is assumed to point to an externally compressed matrix.
+            //! 
+            //! \param data pointer to the compressed input matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            template <typename TT, typename X = typename std::enable_if<!std::is_same<T, TT>::value>::type>
+            matrix(const TT* data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+                :
+                // since 'data' points to a compressed matrix set 'ld_data' to zero to avoid using the internal storage
+                matrix(reinterpret_cast<const T*>(data), 0, extent, bs)
+            {
+                // base class constructor makes sure that 'data' is not NULL
+                compressed_data = reinterpret_cast<const fp_type*>(data);
+            }
+
+            //! \brief Move constructor 
+            matrix(matrix&& rhs) = default;
+
+            //! \brief Destructor
+            virtual ~matrix()
+            { 
+                compressed_data = nullptr;
+            }
+   
+            //! \brief (External) matrix compression
+            //!
+            //! This method can be used without object creation.
+            //!
+            //! \param data pointer to the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
+            //! \param compressed_data pointer to the compressed matrix
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            static ptrdiff_t compress(const T* data, const std::size_t ld_data, fp_type* compressed_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            {
+                if (data == nullptr || compressed_data == nullptr)
+                {
+                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::compress: any of the pointers is a nullptr" << std::endl;
+                    return 0;
+                }
+    
+                const std::size_t m = extent[0];
+                const std::size_t n = extent[1];
+                if (m == 0 || n == 0 || bs == 0) return 0;
+                
+                // create partitioning and use the base class compression method
+                const partition_t partition = base_class::template make_partition<matrix_type::general>(extent, bs);
+                return base_class::template compress<matrix_type::general>(data, ld_data, compressed_data, extent, bs, partition);
+            }
+
+            //! \brief (External) matrix decompression
+            //!
+            //! This method can be used without object creation.
+            //!
+            //! \param compressed_data pointer to the compressed matrix
+            //! \param data pointer to the (decompressed) output matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            static ptrdiff_t decompress(const fp_type* compressed_data, T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            {
+                if (data == nullptr || compressed_data == nullptr)
+                {
+                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::decompress: any of the pointers is a nullptr" << std::endl;
+                    return 0;
+                }
+
+                const std::size_t m = extent[0];
+                const std::size_t n = extent[1];
+                if (m == 0 || n == 0 || bs == 0) return 0;
+                
+                // create partitioning and use the base class decompression method
+                const partition_t partition = base_class::template make_partition<matrix_type::general>(extent, bs);
+                return base_class::template decompress<matrix_type::general>(compressed_data, data, ld_data, extent, bs, partition);
+            }
+
+            //! \brief Decompress this matrix
+            //!
+            //! \param data pointer to the (decompressed) output matrix
+            //! \param ld_data (optional) leading dimension of the memory allocation that is behind the output matrix
+            ptrdiff_t decompress(T* data, const std::size_t ld_data = 0) const
+            {
+                if (data == nullptr)
+                {
+                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::decompress: pointers is a nullptr" << std::endl;
+                    return 0;
+                }
+
+                // if 'ld_data' is not speficied, deduce it from the matrix dimensions
+            #if defined(FP_CONSTANT_BLOCKS)
+                return base_class::template decompress<matrix_type::general>(compressed_data, data, (ld_data == 0 ? (L == matrix_layout::rowmajor ? n : m) : ld_data), {m, n}, bs, partition, block_tag.data());
+            #else
+                return base_class::template decompress<matrix_type::general>(compressed_data, data, (ld_data == 0 ? (L == matrix_layout::rowmajor ? n : m) : ld_data), {m, n}, bs, partition);
+            #endif
+            }
+
+            //! \brief Access a compressed block
+            //!
+            //! Blocks can be accessed in any order.
+            //! Block (bj, bi) holds rows 'bj * bs' .. 'min(m, (bj + 1) * bs) - 1' and columns 'bi * bs' .. 'min(n, (bi + 1) * bs) - 1',
+            //! and can be decompressed using fp_stream<BM, BE>::decompress.
+            //!
+            //! \param bj block id (row)
+            //! \param bi block id (column)
+            //! \return pointer to the compressed block, or nullptr if the block does not exist or is not stored (zero or constant block)
+            const fp_type* get_block(const std::size_t bj, const std::size_t bi) const
+            {
+                if (bj >= ((m + bs - 1) / bs) || bi >= ((n + bs - 1) / bs))
+                {
+                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::get_block: block (" << bj << "," << bi << ") does not exist" << std::endl;
+                    return nullptr;
+                }
+
+                if (base_class::get_block_tag(bj, bi).kind != block_kind::dense) return nullptr;
+
+                return &compressed_data[get_offset(bj, bi)];
+            }
+
+            //! \brief Determine the number of elements needed to store the compressed matrix
+            //!
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            //! return number of elements of type 'fp_type'
+            static std::size_t memory_footprint_elements(const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            {
+                const std::size_t m = extent[0];
+                const std::size_t n = extent[1];
+                if (m == 0 || n == 0 || bs == 0) return 0;
+                
+                return (base_class::template make_partition<matrix_type::general>(extent, bs)).num_elements;
+            }
+
+            //! \brief Determine the number of bytes needed to store the compressed matrix
+            //!
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            //! return number of bytes
+            static std::size_t memory_footprint_bytes(const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            {
+                return memory_footprint_elements(extent, bs) * sizeof(fp_type);
+            }
+
+            using base_class::memory_footprint_elements;
+            using base_class::memory_footprint_bytes;
+
+            //! \brief General matrix vector multiply
+            //!
+            //! Computes y = alpha * A(T) * x + beta * y.
+            //!
+            //! With the parallel execution policy, the blocks are distributed across the threads of an OpenMP team
+            //! block row (no transposition) or block column (transposition) wise, so that each thread writes to a separate chunk of 'y'.
+            //! Use the sequential execution policy if the call happens within a parallel region, e.g. when processing many matrices concurrently.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vector
+            //! \param beta scaling factor for the output vector
+            //! \param y pointer to the output vector
+            //! \param policy (optional) sequential or parallel execution
+            template <typename Tmat = T, typename Tvec = T>
+            void matrix_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y, const execution_policy policy = execution_policy::sequential) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::matrix_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (m == 0 || n == 0) return;
+
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+                
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
+                { 
+                #if defined(FP_INTEGER_GEMV)
+                    // the matrix vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? (transpose ? m : n) / bs + 1 : 0);
+                    if (internal::is_fixed_point_type<BM, BE>::value)
+                    {
+                        const std::size_t mn = (transpose ? m : n);
+                        // the transformation between the fixed and floating point representation
+                        // contains an additive factor which is multiplied with the input vector:
+                        // we have to account for this by summing up chunks of the vector according to the partitioning
+                        for (std::size_t i = 0, k = 0; i < mn; i += bs, ++k)
+                        {
+                            rescale_p_2[k] = fmat_0;
+                            const std::size_t ii_max = std::min(mn - i, bs);
+                            for (std::size_t ii = 0; ii < ii_max; ++ii)
+                            {
+                                rescale_p_2[k] += x[i + ii];
+                            }
+                        }
+                    }
+                #endif
+
+                    const std::size_t num_block_rows = (m + bs - 1) / bs;
+                    const std::size_t num_block_cols = (n + bs - 1) / bs;
+
+                    // parallel execution: each thread processes a range of block rows (no transposition) or block columns (transposition)
+                    // sequential execution: blocks are processed in the order they are stored
+                    const bool use_threads = (policy == execution_policy::parallel && (transpose ? num_block_cols : num_block_rows) > 1);
+                    const bool by_block_cols = (use_threads && transpose);
+                    const std::size_t num_outer = (by_block_cols ? num_block_cols : num_block_rows);
+                    const std::size_t num_inner = (by_block_cols ? num_block_rows : num_block_cols);
+
+                    // apply blocks within the range [outer_begin, outer_end) to 'x' and add the result to 'y'
+                    auto apply_blocks = [&](const std::size_t outer_begin, const std::size_t outer_end)
+                    {
+                        // allocate local memory
+                        internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+                    #if defined(FP_INTEGER_GEMV)
+                        internal::scratch_buffer<Tmat> tmp_y(bs);
+                    #endif
+
+                        for (std::size_t b_outer = outer_begin; b_outer < outer_end; ++b_outer)
+                        {
+                            for (std::size_t b_inner = 0; b_inner < num_inner; ++b_inner)
+                            {
+                                const std::size_t j = (by_block_cols ? b_inner : b_outer) * bs;
+                                const std::size_t i = (by_block_cols ? b_outer : b_inner) * bs;
+                                const std::size_t k = get_offset(j / bs, i / bs);
+                                const std::size_t mm = std::min(m - j, bs);
+                                const std::size_t nn = std::min(n - i, bs);
+                                const std::size_t src_idx = (transpose ? j : i);
+                                const std::size_t dst_idx = (transpose ? i : j);
+
+                                // zero and constant blocks are not stored
+                                const block_tag_t tag = base_class::get_block_tag(j / bs, i / bs);
+                                if (tag.kind == block_kind::zero)
+                                {
+                                    continue;
+                                }
+                                else if (tag.kind == block_kind::constant)
+                                {
+                                    base_class::matrix_vector_constant(transpose, mm, nn, alpha * static_cast<Tmat>(tag.value), &x[src_idx], &y[dst_idx]);
+                                    continue;
+                                }
+
+                            #if defined(FP_INTEGER_GEMV)
+                                if (internal::is_fixed_point_type<BM, BE>::value)
+                                {
+                                    // extract scaling factors for the current block
+                                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
+                                    const Tmat rescale_p_3 = fptr[0];
+                                    const Tmat rescale_p_4 = fptr[1];
+                                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+
+                                    // integer gemv
+                                    base_class::integer_gemv(transpose, mm, nn, &tmp_a[0], &x[src_idx], &tmp_y[0]);
+                                    // ..finalize gemv call: rescaling
+                                    const Tmat a = rescale_p_4;
+                                    const Tmat b = rescale_p_2[src_idx / bs] * rescale_p_3;
+                                    for (std::size_t jj = 0; jj < (transpose ? nn : mm); ++jj)
+                                    {
+                                        y[dst_idx + jj] += alpha * (tmp_y[jj] * a + b);
+                                    }
+                                }
+                                else                            
+                            #endif
+                                // decompress the block on the fly, if the fused kernel is available
+                                if (!base_class::try_matrix_vector_fused(transpose, mm, nn, alpha, &compressed_data[k], &x[src_idx], &y[dst_idx]))
+                                {
+                                    // decompress the block
+                                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
+
+                                    // apply general blas matrix vector multiplication
+                                    const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
+                                    blas::gemv(cblas_layout, (transpose ? CblasTrans : CblasNoTrans), mm, nn, alpha, &buffer_a[0], lda, &x[src_idx], 1, fmat_1, &y[dst_idx], 1);
+                                }
+                            }
+                        }
+                    };
+
+                    if (use_threads)
+                    {
+                        #pragma omp parallel
+                        {
+                            // contiguous ranges of block rows / columns
+                            const std::size_t thread_id = omp_get_thread_num();
+                            const std::size_t num_threads = omp_get_num_threads();
+                            apply_blocks((thread_id * num_outer) / num_threads, ((thread_id + 1) * num_outer) / num_threads);
+                        }
+                    }
+                    else
+                    {
+                        apply_blocks(0, num_outer);
+                    }
+                }, transpose, alpha, x, beta, y);
+            }
+
+            //! \brief General matrix multi-vector multiply
+            //!
+            //! Computes Y = alpha * A(T) * X + beta * Y for 'k' vectors.
+            //! The vectors are stored one after another, i.e. X and Y are column major with leading dimensions 'ldx' and 'ldy'.
+            //! Each block is decompressed only once and then applied to all vectors using a BLAS gemm call.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param k number of vectors
+            //! \param beta scaling factor for the output vectors
+            //! \param y pointer to the output vectors
+            //! \param ldy leading dimension of 'y'
+            template <typename Tmat = T, typename Tvec = T>
+            void matrix_multi_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec beta, Tvec* y, const std::size_t ldy) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::matrix_multi_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (m == 0 || n == 0 || k == 0) return;
+
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::multi_vector_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, const std::size_t ldx, const std::size_t k, Tmat* y, const std::size_t ldy)
+                {
+                    // allocate local memory
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+
+                #if defined(FP_INTEGER_GEMV)
+                    // the matrix multi-vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix
+                    const std::size_t num_chunks = ((transpose ? m : n) + bs - 1) / bs;
+                    internal::scratch_buffer<Tmat> tmp_y(internal::is_fixed_point_type<BM, BE>::value ? bs * k : 0);
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? num_chunks * k : 0);
+                    if (internal::is_fixed_point_type<BM, BE>::value)
+                    {
+                        const std::size_t mn = (transpose ? m : n);
+                        // the transformation between the fixed and floating point representation
+                        // contains an additive factor which is multiplied with the input vectors:
+                        // we have to account for this by summing up chunks of the vectors according to the partitioning
+                        for (std::size_t c = 0; c < k; ++c)
+                        {
+                            for (std::size_t i = 0, kk = 0; i < mn; i += bs, ++kk)
+                            {
+                                rescale_p_2[c * num_chunks + kk] = fmat_0;
+                                const std::size_t ii_max = std::min(mn - i, bs);
+                                for (std::size_t ii = 0; ii < ii_max; ++ii)
+                                {
+                                    rescale_p_2[c * num_chunks + kk] += x[c * ldx + i + ii];
+                                }
+                            }
+                        }
+                    }
+                #endif
+
+                    // apply matrix to 'x' and add the result to 'y'
+                    for (std::size_t j = 0; j < m; j += bs)
+                    {
+                        for (std::size_t i = 0; i < n; i += bs)
+                        {
+                            const std::size_t offset = get_offset(j / bs, i / bs);
+                            const std::size_t mm = std::min(m - j, bs);
+                            const std::size_t nn = std::min(n - i, bs);
+                            const std::size_t src_idx = (transpose ? j : i);
+                            const std::size_t dst_idx = (transpose ? i : j);
+                            const block_kind kind = base_class::get_block_tag(j / bs, i / bs).kind;
+
+                            // zero blocks are not stored and do not contribute
+                            if (kind == block_kind::zero) continue;
+
+                        #if defined(FP_INTEGER_GEMV)
+                            if (internal::is_fixed_point_type<BM, BE>::value && kind == block_kind::dense)
+                            {
+                                // extract scaling factors for the current block
+                                const float* fptr = reinterpret_cast<const float*>(&compressed_data[offset]);
+                                const Tmat rescale_p_3 = fptr[0];
+                                const Tmat rescale_p_4 = fptr[1];
+                                const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+
+                                // integer gemm
+                                base_class::integer_gemm(transpose, mm, nn, k, &tmp_a[0], &x[src_idx], ldx, &tmp_y[0], bs);
+                                // ..finalize gemm call: rescaling
+                                const Tmat a = rescale_p_4;
+                                for (std::size_t c = 0; c < k; ++c)
+                                {
+                                    const Tmat b = rescale_p_2[c * num_chunks + src_idx / bs] * rescale_p_3;
+                                    for (std::size_t jj = 0; jj < (transpose ? nn : mm); ++jj)
+                                    {
+                                        y[c * ldy + dst_idx + jj] += alpha * (tmp_y[c * bs + jj] * a + b);
+                                    }
+                                }
+                            }
+                            else
+                        #endif
+                            {
+                                // decompress the block once for all vectors
+                                base_class::decompress_block(j / bs, i / bs, offset, &buffer_a[0], mm * nn);
+
+                                // apply the block to all vectors
+                                base_class::matrix_multi_vector_block(transpose, mm, nn, k, alpha, &buffer_a[0], &x[src_idx], ldx, &y[dst_idx], ldy);
+                            }
+                        }
+                    }
+                }, transpose, alpha, x, ldx, k, beta, y, ldy);
+            }
+
+        #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y) const                               \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y);                                                                                                         \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y) const     \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0]);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y, const execution_policy policy) const         \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y, policy);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y, const execution_policy policy) const \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0], policy);                                                                                         \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_multi_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const std::size_t ldx, const std::size_t k, const TYPE_VEC beta, TYPE_VEC* y, const std::size_t ldy) const \
+            {                                                                                                                                                               \
+                matrix_multi_vector_kernel(transpose, alpha, x, ldx, k, beta, y, ldy);                                                                                      \
+            }                                                                                                                                                               \
+
+            MACRO_MATRIX_VECTOR(double, double);
+            MACRO_MATRIX_VECTOR(double, float);
+            MACRO_MATRIX_VECTOR(float, double);
+            MACRO_MATRIX_VECTOR(float, float);
+
+        #undef MACRO_MATRIX_VECTOR
+            
+            void gemv(const bool transpose, const T alpha, const T* x, const T beta, T* y, const execution_policy policy = execution_policy::sequential) const
+            {
+                matrix_vector(transpose, alpha, x, beta, y, policy);
+            }
+            
+            void gemv(const bool transpose, const T alpha, const std::vector<T>& x, const T beta, std::vector<T>& y, const execution_policy policy = execution_policy::sequential) const
+            {
+                matrix_vector(transpose, alpha, &x[0], beta, &y[0], policy);
+            }
+        };
+
+        //! \brief Triangular matrix
+        //!
+        //! \tparam T initial data type before compression
+        //! \tparam L data layout/order (any of row major or column major)
+        //! \tparam BM number of bits in the exponent
+        //! \tparam BE number of bits in the mantissa
+        template <typename T, matrix_layout L = matrix_layout::rowmajor, matrix_type MT = matrix_type::upper_triangular, std::uint32_t BM = ieee754_fp<T>::bm, std::uint32_t BE = ieee754_fp<T>::be>
+        class triangular_matrix : public matrix_base<T, L, BM, BE>
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+            static_assert(MT == matrix_type::upper_triangular || MT == matrix_type::lower_triangular, "error: this should be a triangular matrix");
+
+            using this_class = triangular_matrix<T, L, MT, BM, BE>;
+            using base_class = matrix_base<T, L, BM, BE>;
+
+            static constexpr CBLAS_LAYOUT cblas_layout = (L == matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+        public:
+
+            // extent of the matrix: 'n' rows and 'n' columns
+            using base_class::n;
+
+            // data type for the internal floating / fixed point representation
+            using fp_type = typename base_class::fp_type;
+
+            // (default) block size
+            static constexpr std::size_t bs_default = base_class::bs_default;
+            
+        private:
+
+            // block size
+            using base_class::bs;
+
+            // compresse matrix
+            using base_class::memory;
+            using base_class::compressed_data;
+
+            using partition_t = typename base_class::partition_t;
+            using base_class::partition;
+        #if defined(FP_BLOCK_OFFSET_TABLE)
+            using base_class::block_offset;
+        #endif
+
+            using block_kind = typename base_class::block_kind;
+            using block_tag_t = typename base_class::block_tag_t;
+        #if defined(FP_CONSTANT_BLOCKS)
+            using base_class::block_tag;
+            using base_class::num_elements_stored;
+        #endif
+
+            //! \brief Block offset computation
+            //!
+            //! get the offset w.r.t. to 0 for the block with Id=(bj, bi)
+            //!
+            //! \param bj block id
+            //! \param bi block id
+            //! \return offset w.r.t. to 0
+            std::size_t get_offset(const std::size_t bj, const std::size_t bi) const
+            {
+            #if defined(FP_BLOCK_OFFSET_TABLE)
+                return block_offset[bj * ((n + bs - 1) / bs) + bi];
+            #else
+                if (MT == matrix_type::upper_triangular)
+                {
+                    const std::size_t n_ab_row = (n / bs);
+                    const std::size_t n_c_row = ((n + bs - 1) / bs) - n_ab_row;
+                    const std::size_t n_abc_row = n_ab_row + n_c_row;
+                    const std::size_t n_total = (n_abc_row * (n_abc_row + 1)) / 2;
+                    const std::size_t n_abc = n_total - ((n_abc_row - bj) * ((n_abc_row - bj + 1))) / 2;
+                    const std::size_t n_a = bj + (bi > bj ? 1 : 0);
+                    const std::size_t n_b = n_abc - bj * (1 + n_c_row) + (bi > (bj + 1) ? (bi - (bj + 1)) : 0);
+                    const std::size_t n_c = bj * n_c_row;
+                    
+                    return (n_a * partition.num_elements_a + n_b * partition.num_elements_b + n_c * partition.num_elements_c);
+                }
+                else
+                {
+                    const std::size_t n_blocks = (n + bs - 1) / bs;
+                    const std::size_t n_a = bj;
+                    // the computation of 'n_b' and 'n_c' assumes 'num_elements_c != 0'
+                    const std::size_t n_b = (bj * (bj + 1)) / 2 - bj + (bj < (n_blocks - 1) ? bi : 0);
+                    const std::size_t n_c = (bj == (n_blocks - 1) ? bi : 0);
+
+                    // fix 'num_elements_c == 0' case
+                    return (n_a * partition.num_elements_a + n_b * partition.num_elements_b + n_c * (partition.num_elements_c != 0 ? partition.num_elements_c : partition.num_elements_b));
+                }
+            #endif
+            }
+
+            //! \brief Unpack a (decompressed) diagonal block
+            //!
+            //! Diagonal blocks are stored in packed format.
+            //! This method expands them into a full 'nn x nn' block (leading dimension 'nn'):
+            //! the other triangle is either zeroed (triangular) or mirrored (symmetric).
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param packed pointer to the packed block
+            //! \param a pointer to the full block
+            //! \param nn extent of the block
+            //! \param symmetric mirror the stored triangle
+            template <typename Tmat>
+            static void unpack_diagonal_block(const Tmat* packed, Tmat* a, const std::size_t nn, const bool symmetric)
+            {
+                constexpr bool upper_rowmajor = (MT == matrix_type::upper_triangular) && (L == matrix_layout::rowmajor);
+                constexpr bool lower_colmajor = (MT == matrix_type::lower_triangular) && (L == matrix_layout::colmajor);
+
+                for (std::size_t jj = 0, kk = 0; jj < nn; ++jj)
+                {
+                    const std::size_t ii_start = (upper_rowmajor || lower_colmajor ? jj : 0);
+                    const std::size_t ii_end = (upper_rowmajor || lower_colmajor ? nn : (jj + 1));
+
+                    for (std::size_t ii = 0; ii < ii_start; ++ii)
+                    {
+                        a[jj * nn + ii] = static_cast<Tmat>(0.0);
+                    }
+                    for (std::size_t ii = ii_start; ii < ii_end; ++ii, ++kk)
+                    {
+                        a[jj * nn + ii] = packed[kk];
+                    }
+                    for (std::size_t ii = ii_end; ii < nn; ++ii)
+                    {
+                        a[jj * nn + ii] = static_cast<Tmat>(0.0);
+                    }
+                }
+
+                if (symmetric)
+                {
+                    for (std::size_t jj = 0; jj < nn; ++jj)
+                    {
+                        const std::size_t ii_start = (upper_rowmajor || lower_colmajor ? jj : 0);
+                        const std::size_t ii_end = (upper_rowmajor || lower_colmajor ? nn : (jj + 1));
+
+                        for (std::size_t ii = ii_start; ii < ii_end; ++ii)
+                        {
+                            a[ii * nn + jj] = a[jj * nn + ii];
+                        }
+                    }
+                }
+            }
+
+            //! \brief Triangular solve: contribution of an already solved block row / column
+            //!
+            //! Computes acc = acc + A(T)(bj, bi) * y[bi * bs..].
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param transpose matrix transposition
+            //! \param bj block row / column to be solved
+            //! \param bi block row / column already solved
+            //! \param y pointer to the solution vector
+            //! \param acc pointer to the accumulator of block row / column 'bj'
+            template <typename Tmat>
+            void triangular_solve_update(const bool transpose, const std::size_t bj, const std::size_t bi, const Tmat* y, Tmat* acc) const
+            {
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+
+                const std::size_t mm = std::min(n - bj * bs, bs);
+                const std::size_t nn = std::min(n - bi * bs, bs);
+                const std::size_t k = (transpose ? get_offset(bi, bj) : get_offset(bj, bi));
+
+                // zero and constant blocks are not stored
+                const block_tag_t tag = (transpose ? base_class::get_block_tag(bi, bj) : base_class::get_block_tag(bj, bi));
+                if (tag.kind == block_kind::zero)
+                {
+                    return;
+                }
+                else if (tag.kind == block_kind::constant)
+                {
+                    base_class::matrix_vector_constant(false, mm, nn, static_cast<Tmat>(tag.value), &y[bi * bs], &acc[0]);
+                    return;
+                }
+
+            #if defined(FP_INTEGER_GEMV)
+                if (internal::is_fixed_point_type<BM, BE>::value)
+                {
+                    internal::scratch_buffer<Tmat> tmp_x(bs);
+
+                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
+                    const Tmat rescale_p_3 = fptr[0];
+                    const Tmat rescale_p_4 = fptr[1];
+                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+                    
+                    // integer gemv
+                    T rescale_p_2 = static_cast<T>(0.0);
+                    for (std::size_t ii = 0; ii < nn; ++ii)
+                    {
+                        rescale_p_2 += y[bi * bs + ii];
+                    }
+                    if (transpose)
+                    {
+                        base_class::integer_gemv(true, nn, mm, &tmp_a[0], &y[bi * bs], &tmp_x[0]);
+                    }
+                    else
+                    {
+                        base_class::integer_gemv(false, mm, nn, &tmp_a[0], &y[bi * bs], &tmp_x[0]);
+                    }
+                    // ..finalize gemv call: rescaling
+                    const Tmat a = rescale_p_4;
+                    const Tmat b = rescale_p_2 * rescale_p_3;
+                    for (std::size_t ii = 0; ii < mm; ++ii)
+                    {
+                        acc[ii] += (tmp_x[ii] * a + b);
+                    }
+                }
+                else                            
+            #endif
+                {
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+
+                    // decompress the 'buffer'
+                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
+
+                    // apply general matrix vector multiplication
+                    if (transpose)
+                    {
+                        const std::size_t lda = (L == matrix_layout::rowmajor ? mm : nn);
+                        blas::gemv(cblas_layout, CblasTrans, nn, mm, fmat_1, &buffer_a[0], lda, &y[bi * bs], 1, fmat_1, &acc[0], 1);
+                    }
+                    else
+                    {
+                        const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
+                        blas::gemv(cblas_layout, CblasNoTrans, mm, nn, fmat_1, &buffer_a[0], lda, &y[bi * bs], 1, fmat_1, &acc[0], 1);
+                    }
+                }
+            }
+
+            //! \brief Triangular solve: diagonal block
+            //!
+            //! Solves A(T)(bj, bj) * y[bj * bs..] = x[bj * bs..] - acc.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param transpose matrix transposition
+            //! \param bj block row / column to be solved
+            //! \param x pointer to the right hand side
+            //! \param acc pointer to the accumulated contributions of all block rows / columns solved so far
+            //! \param y pointer to the solution vector
+            template <typename Tmat>
+            void triangular_solve_diagonal(const bool transpose, const std::size_t bj, const Tmat* x, const Tmat* acc, Tmat* y) const
+            {
+                internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+
+                const std::size_t mm = std::min(n - bj * bs, bs);
+                for (std::size_t jj = 0; jj < mm; ++jj)
+                {
+                    y[bj * bs + jj] = x[bj * bs + jj] - acc[jj];
+                }
+
+                // decompress the 'buffer'
+                const std::size_t k = get_offset(bj, bj);
+                base_class::decompress_block(bj, bj, k, &buffer_a[0], (mm * (mm + 1)) / 2);
+
+                // apply triangular solve 
+                blas::tpsv(cblas_layout, (MT == matrix_type::upper_triangular ? CblasUpper : CblasLower), (transpose ? CblasTrans : CblasNoTrans), CblasNonUnit, mm, &buffer_a[0], &y[bj * bs], 1);
+            }
+
+        public:
+
+            // do not create a standard constructor
+            triangular_matrix() = delete;
+            
+            //! \brief Constructor
+            //!
+            //! This constructor applies the matrix compression:
+            //! if 'ld_data' is specified and larger than zero, it indicates that we are working on the raw input matrix.
+            //!
+            //! \param data pointer to the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            triangular_matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+                :
+                base_class(data, ld_data, extent, bs)
+            {
+            #if defined(FP_CONSTANT_BLOCKS)
+                // all blocks are dense unless the matrix compression finds zero or constant blocks
+                block_tag.assign(((n + bs - 1) / bs) * ((n + bs - 1) / bs), {block_kind::dense, static_cast<T>(0.0)});
+            #endif
+            #if defined(FP_BLOCK_OFFSET_TABLE)
+                block_offset = base_class::template make_block_offset_table<MT>({n, n}, bs, partition);
+            #endif
+
+                // create a compressed matrix with internal storage
+                if (ld_data > 0)
+                {
+                #if defined(FP_CONSTANT_BLOCKS)
+                    // allocate memory for the compressed matrix
+                    memory.resize(partition.num_elements);
+
+                    // compress the matrix: zero and constant blocks are not stored, which changes the block offsets
+                    num_elements_stored = base_class::template compress<MT>(reinterpret_cast<const T*>(data), ld_data, memory.data(), {n, n}, bs, partition, block_tag.data());
+                    block_offset = base_class::template make_block_offset_table<MT>({n, n}, bs, partition, block_tag.data());
+
+                    // release the memory of the blocks not stored: blocks are now packed densely and the SIMD decoders
+                    // may read up to one 256-bit word beyond the end of the last block
+                    memory.resize(num_elements_stored + (32 + sizeof(fp_type) - 1) / sizeof(fp_type));
+                    memory.shrink_to_fit();
+                #else
+                    // allocate memory for the compressed matrix
+                    memory.reserve(partition.num_elements);
+                    
+                    // compress the matrix
+                    base_class::template compress<MT>(reinterpret_cast<const T*>(data), ld_data, &memory[0], {n, n}, bs, partition);
+                #endif
+
+                    // set up the internal pointer to the compressed matrix
+                    compressed_data = reinterpret_cast<const fp_type*>(&memory[0]);
+                }
+            }
+
+
+            triangular_matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+                :
+                triangular_matrix(data, ld_data, std::array<std::size_t, 1>({extent[0]}), bs)
+            {
+                ;
+            }
+
+            //! \brief Constructor
+            //!
+            //! \param data vector holding the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            template <std::size_t D>
+            triangular_matrix(const std::vector<T>& data, const std::size_t ld_data, const std::array<std::size_t, D>& extent, const std::size_t bs = bs_default)
+                :
+                triangular_matrix(&data[0], ld_data, extent, bs)
+            {
+                ;
+            }
+
+            //! \brief Constructor
+            //!
+            //! This constructor allows to bind an externally compressed matrix.
+            //! The internal storage then is not used.
+            //! For 'TT' being equal to 'T' and we cannot conclude that 'data' points to a compressed matrix.
+            //! We thus have to use an additional argument to to control the internal storage usage and data compression.
+            //! 
+            //! \param data pointer to either the compressed or uncompressed input matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            //! \param is_compressed (optional) 'data' points to a compressed matrix or not
+            template <typename TT, std::size_t D, typename X = typename std::enable_if<std::is_same<T, TT>::value>::type>
+            triangular_matrix(const TT* data, const std::array<std::size_t, D>& extent, const std::size_t bs = bs_default, const bool is_compressed = true)
+                :
+                triangular_matrix(data, (is_compressed ? 0 : extent[0]), extent, bs)
+            {
+                if (is_compressed)
+                {
+                    if (std::is_same<TT, fp_type>::value)
+                    {
+                        // 'data' points to a compressed matrix
+                        compressed_data = reinterpret_cast<const fp_type*>(data);
+                    }
+                    else
+                    {
+                        std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::triangular_matrix: external pointer type does not match fp_type" << std::endl;
+                    }
+                }
+            }
+
+            //! \brief Constructor
+            //!
+            //! This constructor allows to bind an externally compressed matrix.
+            //! The internal storage then is not used.
+            //! This constructor complements the above one for 'T' not being equal to 'TT'.
+            //! In this case 'data' is assumed to point to an externally compressed matrix.
+            //! 
+            //! \param data pointer to the compressed input matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            template <typename TT, std::size_t D, typename X = typename std::enable_if<!std::is_same<T, TT>::value>::type>
+            triangular_matrix(const TT* data, const std::array<std::size_t, D>& extent, const std::size_t bs = bs_default)
+                :
+                triangular_matrix(reinterpret_cast<const T*>(data), 0, extent, bs)
+            {
+                // 'data' points to a compressed matrix: base class constructor makes sure that 'data' is not NULL
+                compressed_data = reinterpret_cast<const fp_type*>(data);
+            }
+
+            //! \brief Move constructor 
+            triangular_matrix(triangular_matrix&& rhs) = default;
+
+            //! \brief Destructor
+            virtual ~triangular_matrix() 
+            { 
+                compressed_data = nullptr; 
+            }
+
+            //! \brief (External) matrix compression
+            //!
+            //! This method can be used without object creation.
+            //!
+            //! \param data pointer to the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
+            //! \param compressed_data pointer to the compressed matrix
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            static ptrdiff_t compress(const T* data, const std::size_t ld_data, fp_type* compressed_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            {
+                if (data == nullptr || compressed_data == nullptr)
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::compress: any of the pointers is a nullptr" << std::endl;
+                    return 0;
+                }
+                
+                const std::size_t m = extent[0];
+                const std::size_t n = extent[1];
+                if (m == 0 || n == 0 || bs == 0) return 0;
+                
+                const partition_t partition  = base_class::template make_partition<MT>(extent, bs);
+                return base_class::template compress<MT>(data, ld_data, compressed_data, extent, bs, partition);
+            }
+
+            //! \brief (External) matrix decompression
+            //!
+            //! This method can be used without object creation.
+            //!
+            //! \param compressed_data pointer to the compressed matrix
+            //! \param data pointer to the (decompressed) output matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            static ptrdiff_t decompress(const fp_type* compressed_data, T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            {
+                if (data == nullptr || compressed_data == nullptr)
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::decompress: any of the pointers is a nullptr" << std::endl;
+                    return 0;
+                }
+
+                const std::size_t m = extent[0];
+                const std::size_t n = extent[1];
+                if (m == 0 || n == 0 || bs == 0) return 0;
+                
+                const partition_t partition = base_class::template make_partition<MT>(extent, bs);
+                return base_class::template decompress<MT>(compressed_data, data, ld_data, extent, bs, partition);
+            }
+
+            static ptrdiff_t compress(const T* data, const std::size_t ld_data, fp_type* compressed_data, const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+            {
+                return compress(data, ld_data, compressed_data, {extent[0], extent[0]}, bs);
+            }
+
+            static ptrdiff_t decompress(const fp_type* compressed_data, T* data, const std::size_t ld_data, const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+            {
+                return decompress(compressed_data, data, ld_data, {extent[0], extent[0]}, bs);
+            }
+
+            //! \brief Decompress this matrix
+            //!
+            //! \param data pointer to the (decompressed) output matrix
+            //! \param ld_data (optional) leading dimension of the memory allocation that is behind the output matrix
+            ptrdiff_t decompress(T* data, const std::size_t ld_data = 0) const
+            {
+                if (data == nullptr)
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::decompress: pointers is a nullptr" << std::endl;
+                    return 0;
+                }
+
+                // if 'ld_data' is not speficied, deduce it from the matrix dimensions
+            #if defined(FP_CONSTANT_BLOCKS)
+                return base_class::template decompress<MT>(compressed_data, data, (ld_data == 0 ? n : ld_data), {n, n}, bs, partition, block_tag.data());
+            #else
+                return base_class::template decompress<MT>(compressed_data, data, (ld_data == 0 ? n : ld_data), {n, n}, bs, partition);
+            #endif
+            }
+
+            //! \brief Access a compressed block
+            //!
+            //! Blocks can be accessed in any order.
+            //! Block (bj, bi) holds rows 'bj * bs' .. 'min(n, (bj + 1) * bs) - 1' and columns 'bi * bs' .. 'min(n, (bi + 1) * bs) - 1',
+            //! and can be decompressed using fp_stream<BM, BE>::decompress.
+            //! Diagonal blocks are stored in packed format.
+            //!
+            //! \param bj block id (row)
+            //! \param bi block id (column)
+            //! \return pointer to the compressed block, or nullptr if the block does not exist or is not stored (zero or constant block)
+            const fp_type* get_block(const std::size_t bj, const std::size_t bi) const
+            {
+                const std::size_t num_blocks = (n + bs - 1) / bs;
+                if (bj >= num_blocks || bi >= num_blocks || (MT == matrix_type::upper_triangular ? bi < bj : bi > bj))
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::get_block: block (" << bj << "," << bi << ") does not exist" << std::endl;
+                    return nullptr;
+                }
+
+                if (base_class::get_block_tag(bj, bi).kind != block_kind::dense) return nullptr;
+
+                return &compressed_data[get_offset(bj, bi)];
+            }
+
+            //! \brief Determine the number of elements needed to store the compressed matrix
+            //!
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            //! return number of elements of type 'fp_type'
+            static std::size_t memory_footprint_elements(const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            {
+                const std::size_t m = extent[0];
+                const std::size_t n = extent[1];
+                if (m == 0 || n == 0 || bs == 0) return 0;
+                
+                return (base_class::template make_partition<MT>(extent, bs)).num_elements;
+            }
+
+            static std::size_t memory_footprint_elements(const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+            {
+                return memory_footprint_elements({extent[0], extent[0]}, bs);
+            }
+
+            //! \brief Determine the number of bytes needed to store the compressed matrix
+            //!
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            //! return number of bytes
+            static std::size_t memory_footprint_bytes(const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            {
+                return memory_footprint_elements(extent, bs) * sizeof(fp_type);
+            }
+
+            static std::size_t memory_footprint_bytes(const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+            {
+                return memory_footprint_bytes({extent[0], extent[0]}, bs);
+            }
+
+            using base_class::memory_footprint_elements;
+            using base_class::memory_footprint_bytes;
+
+            //! \brief Triangular (packed) matrix vector multiply
+            //!
+            //! Computes y = alpha * A(T) * x + beta * y.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vector
+            //! \param beta scaling factor for the output vector
+            //! \param y pointer to the output vector
+            template <typename Tmat = T, typename Tvec = T>
+            void matrix_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::matrix_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (n == 0) return;
+                
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
+                { 
+                    // allocate local memory
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+                    internal::scratch_buffer<Tmat> buffer_y(bs);
+                    
+                #if defined(FP_INTEGER_GEMV)
+                    // the matrix vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix
+                    internal::scratch_buffer<Tmat> tmp_y(bs);
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? n / bs + 1 : 0);
+                    if (internal::is_fixed_point_type<BM, BE>::value)
+                    {
+                        // the transformation between the fixed and floating point representation
+                        // contains an additive factor which is multiplied with the input vector:
+                        // we have to account for this by summing up chunks of the vector according to the partitioning
+                        for (std::size_t i = 0, k = 0; i < n; i += bs, ++k)
+                        {
+                            rescale_p_2[k] = fmat_0;
+                            const std::size_t ii_max = std::min(n - i, bs);
+                            for (std::size_t ii = 0; ii < ii_max; ++ii)
+                            {
+                                rescale_p_2[k] += x[i + ii];
+                            }
+                        }
+                    }
+                #endif
+                    
+                    for (std::size_t j = 0; j < n; j += bs)
+                    {
+                        const std::size_t i_start = (MT == matrix_type::upper_triangular ? j : 0);
+                        const std::size_t i_end = (MT == matrix_type::upper_triangular ? n : (j + 1));
+
+                        for (std::size_t i = i_start; i < i_end; i += bs)
+                        {
+                            const std::size_t k = get_offset(j / bs, i / bs);
+                            const std::size_t mm = std::min(n - j, bs);
+                            const std::size_t nn = std::min(n - i, bs);
+                            const std::size_t src_idx = (transpose ? j : i);
+                            const std::size_t dst_idx = (transpose ? i : j);
+
+                            // zero and constant blocks are not stored
+                            const block_tag_t tag = base_class::get_block_tag(j / bs, i / bs);
+                            if (tag.kind == block_kind::zero) continue;
+
+                            // diagonal blocks
+                            if (i == j)
+                            {
+                                // decompress the 'buffer'
+                                base_class::decompress_block(j / bs, i / bs, k, &buffer_a[0], (nn * (nn + 1)) / 2);
+                                
+                                // prepare call to tpmv
+                                for (std::size_t jj = 0; jj < nn; ++jj)
+                                {
+                                    buffer_y[jj] = x[j + jj];
+                                }
+
+                                // apply triangular matrix vector multiply
+                                blas::tpmv(cblas_layout, (MT == matrix_type::upper_triangular ? CblasUpper : CblasLower), (transpose ? CblasTrans : CblasNoTrans), CblasNonUnit, nn, &buffer_a[0], &buffer_y[0], 1);
+
+                                // scale by 'alpha'
+                                for (std::size_t jj = 0; jj < nn; ++jj)
+                                {
+                                    y[j + jj] += alpha * buffer_y[jj];
+                                }
+                            }
+                            else if (tag.kind == block_kind::constant)
+                            {
+                                base_class::matrix_vector_constant(transpose, mm, nn, alpha * static_cast<Tmat>(tag.value), &x[src_idx], &y[dst_idx]);
+                            }
+                            else
+                            {
+                            #if defined(FP_INTEGER_GEMV)
+                                if (internal::is_fixed_point_type<BM, BE>::value)
+                                {
+                                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
+                                    const Tmat rescale_p_3 = fptr[0];
+                                    const Tmat rescale_p_4 = fptr[1];
+                                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+
+                                    // integer gemv
+                                    base_class::integer_gemv(transpose, mm, nn, &tmp_a[0], &x[src_idx], &tmp_y[0]);
+                                    // ..finalize gemv call: rescaling
+                                    const Tmat a = rescale_p_4;
+                                    const Tmat b = rescale_p_2[src_idx / bs] * rescale_p_3;
+                                    for (std::size_t jj = 0; jj < (transpose ? nn : mm); ++jj)
+                                    {
+                                        y[dst_idx + jj] += alpha * (tmp_y[jj] * a + b);
+                                    }
+                                }
+                                else                            
+                            #endif
+                                // decompress the block on the fly, if the fused kernel is available
+                                if (!base_class::try_matrix_vector_fused(transpose, mm, nn, alpha, &compressed_data[k], &x[src_idx], &y[dst_idx]))
+                                {
+                                    // decompress the 'buffer'
+                                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
+
+                                    // apply blas matrix vector multiplication
+                                    const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
+                                    blas::gemv(cblas_layout, (transpose ? CblasTrans : CblasNoTrans), mm, nn, alpha, &buffer_a[0], lda, &x[src_idx], 1, fmat_1, &y[dst_idx], 1);
+                                }
+                            }
+                        }
+                    }
+                }, transpose, alpha, x, beta, y);
+            }
+
+            //! \brief Triangular (packed) matrix multi-vector multiply
+            //!
+            //! Computes Y = alpha * A(T) * X + beta * Y for 'k' vectors, or Y = alpha * A * X + beta * Y with A symmetric.
+            //! The vectors are stored one after another, i.e. X and Y are column major with leading dimensions 'ldx' and 'ldy'.
+            //! Each block is decompressed only once and then applied to all vectors using a BLAS gemm call.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition (ignored if 'symmetric' is true)
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param k number of vectors
+            //! \param beta scaling factor for the output vectors
+            //! \param y pointer to the output vectors
+            //! \param ldy leading dimension of 'y'
+            //! \param symmetric the matrix is the upper or lower part of a symmetric matrix
+            template <typename Tmat = T, typename Tvec = T>
+            void matrix_multi_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec beta, Tvec* y, const std::size_t ldy, const bool symmetric = false) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::matrix_multi_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (n == 0 || k == 0) return;
+
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::multi_vector_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, const std::size_t ldx, const std::size_t k, Tmat* y, const std::size_t ldy)
+                {
+                    // allocate local memory
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+                    internal::scratch_buffer<Tmat> buffer_d(bs * bs);
+
+                #if defined(FP_INTEGER_GEMV)
+                    // the matrix multi-vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix
+                    const std::size_t num_chunks = (n + bs - 1) / bs;
+                    internal::scratch_buffer<Tmat> tmp_y(internal::is_fixed_point_type<BM, BE>::value ? bs * k : 0);
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? num_chunks * k : 0);
+                    if (internal::is_fixed_point_type<BM, BE>::value)
+                    {
+                        // the transformation between the fixed and floating point representation
+                        // contains an additive factor which is multiplied with the input vectors:
+                        // we have to account for this by summing up chunks of the vectors according to the partitioning
+                        for (std::size_t c = 0; c < k; ++c)
+                        {
+                            for (std::size_t i = 0, kk = 0; i < n; i += bs, ++kk)
+                            {
+                                rescale_p_2[c * num_chunks + kk] = fmat_0;
+                                const std::size_t ii_max = std::min(n - i, bs);
+                                for (std::size_t ii = 0; ii < ii_max; ++ii)
+                                {
+                                    rescale_p_2[c * num_chunks + kk] += x[c * ldx + i + ii];
+                                }
+                            }
+                        }
+                    }
+                #endif
+
+                    for (std::size_t j = 0; j < n; j += bs)
+                    {
+                        const std::size_t i_start = (MT == matrix_type::upper_triangular ? j : 0);
+                        const std::size_t i_end = (MT == matrix_type::upper_triangular ? n : (j + 1));
+
+                        for (std::size_t i = i_start; i < i_end; i += bs)
+                        {
+                            const std::size_t offset = get_offset(j / bs, i / bs);
+                            const std::size_t mm = std::min(n - j, bs);
+                            const std::size_t nn = std::min(n - i, bs);
+                            const block_kind kind = base_class::get_block_tag(j / bs, i / bs).kind;
+
+                            // zero blocks are not stored and do not contribute
+                            if (kind == block_kind::zero) continue;
+
+                            // diagonal blocks
+                            if (i == j)
+                            {
+                                // decompress and unpack the 'buffer'
+                                base_class::decompress_block(j / bs, i / bs, offset, &buffer_d[0], (nn * (nn + 1)) / 2);
+                                unpack_diagonal_block(&buffer_d[0], &buffer_a[0], nn, symmetric);
+
+                                // apply the block to all vectors
+                                base_class::matrix_multi_vector_block((symmetric ? false : transpose), nn, nn, k, alpha, &buffer_a[0], &x[j], ldx, &y[j], ldy);
+
+                                continue;
+                            }
+
+                            // non-diagonal blocks
+                            const std::size_t src_idx = (transpose ? j : i);
+                            const std::size_t dst_idx = (transpose ? i : j);
+
+                        #if defined(FP_INTEGER_GEMV)
+                            if (internal::is_fixed_point_type<BM, BE>::value && kind == block_kind::dense)
+                            {
+                                const float* fptr = reinterpret_cast<const float*>(&compressed_data[offset]);
+                                const Tmat rescale_p_3 = fptr[0];
+                                const Tmat rescale_p_4 = fptr[1];
+                                const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+                                const Tmat a = rescale_p_4;
+
+                                // integer gemm: symmetric matrices need the block and its transpose
+                                for (std::size_t t = 0; t < (symmetric ? 2 : 1); ++t)
+                                {
+                                    const bool transpose_block = (symmetric ? (t == 1) : transpose);
+                                    const std::size_t src = (transpose_block ? j : i);
+                                    const std::size_t dst = (transpose_block ? i : j);
+                                    base_class::integer_gemm(transpose_block, mm, nn, k, &tmp_a[0], &x[src], ldx, &tmp_y[0], bs);
+                                    // ..finalize gemm call: rescaling
+                                    for (std::size_t c = 0; c < k; ++c)
+                                    {
+                                        const Tmat b = rescale_p_2[c * num_chunks + src / bs] * rescale_p_3;
+                                        for (std::size_t jj = 0; jj < (transpose_block ? nn : mm); ++jj)
+                                        {
+                                            y[c * ldy + dst + jj] += alpha * (tmp_y[c * bs + jj] * a + b);
+                                        }
+                                    }
+                                }
+                            }
+                            else
+                        #endif
+                            {
+                                // decompress the block once for all vectors
+                                base_class::decompress_block(j / bs, i / bs, offset, &buffer_a[0], mm * nn);
+
+                                // apply the block to all vectors
+                                if (symmetric)
+                                {
+                                    base_class::matrix_multi_vector_block(false, mm, nn, k, alpha, &buffer_a[0], &x[i], ldx, &y[j], ldy);
+                                    base_class::matrix_multi_vector_block(true, mm, nn, k, alpha, &buffer_a[0], &x[j], ldx, &y[i], ldy);
+                                }
+                                else
+                                {
+                                    base_class::matrix_multi_vector_block(transpose, mm, nn, k, alpha, &buffer_a[0], &x[src_idx], ldx, &y[dst_idx], ldy);
+                                }
+                            }
+                        }
+                    }
+                }, (symmetric ? false : transpose), alpha, x, ldx, k, beta, y, ldy);
+            }
+
+        #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y) const                               \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y);                                                                                                         \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y) const     \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0]);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_multi_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const std::size_t ldx, const std::size_t k, const TYPE_VEC beta, TYPE_VEC* y, const std::size_t ldy) const \
+            {                                                                                                                                                               \
+                matrix_multi_vector_kernel(transpose, alpha, x, ldx, k, beta, y, ldy);                                                                                      \
+            }                                                                                                                                                               \
+
+            MACRO_MATRIX_VECTOR(double, double);
+            MACRO_MATRIX_VECTOR(double, float);
+            MACRO_MATRIX_VECTOR(float, double);
+            MACRO_MATRIX_VECTOR(float, float);
+
+        #undef MACRO_MATRIX_VECTOR
+
+            template <typename Tmat = T, typename Tvec = T>
+            void tpmv(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
+            {
+                matrix_vector(transpose, alpha, x, beta, y);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void tpmv(const bool transpose, const Tmat alpha, const std::vector<Tvec>& x, const Tvec beta, std::vector<Tvec>& y) const
+            {
+                matrix_vector(transpose, alpha, &x[0], beta, &y[0]);
+            }
+
+            //! \brief Triangular (packed) symmetric matrix vector multiply
+            //!
+            //! Computes y = alpha * A(T) * x + beta * y.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vector
+            //! \param beta scaling factor for the output vector
+            //! \param y pointer to the output vector
+            template <typename Tmat = T, typename Tvec = T>
+            void symmetric_matrix_vector(const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::symmetric_matrix_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (n == 0) return;
+
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+                
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
+                {
+                    // allocate local memory
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+
+                #if defined(FP_INTEGER_GEMV)
+                    // the matrix vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix
+                    internal::scratch_buffer<Tmat> tmp_y(2 * bs);
+                    internal::scratch_buffer<T> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? n / bs + 1 : 0);
+                    if (internal::is_fixed_point_type<BM, BE>::value)
+                    {
+                        // the transformation between the fixed and floating point representation
+                        // contains an additive factor which is multiplied with the input vector:
+                        // we have to account for this by summing up chunks of the vector according to the partitioning
+                        for (std::size_t i = 0, k = 0; i < n; i += bs, ++k)
+                        {
+                            rescale_p_2[k] = fmat_0;
+                            const std::size_t ii_max = std::min(n - i, bs);
+                            for (std::size_t ii = 0; ii < ii_max; ++ii)
+                            {
+                                rescale_p_2[k] += x[i + ii];
+                            }
+                        }
+                    }
+                #endif
+
+                    // apply symmetric matrix
+                    for (std::size_t j = 0; j < n; j += bs)
+                    {
+                        const std::size_t i_start = (MT == matrix_type::upper_triangular ? j : 0);
+                        const std::size_t i_end = (MT == matrix_type::upper_triangular ? n : (j + 1));
+
+                        for (std::size_t i = i_start; i < i_end; i += bs)
+                        {
+                            const std::size_t k = get_offset(j / bs, i / bs);
+                            const std::size_t mm = std::min(n - j, bs);
+                            const std::size_t nn = std::min(n - i, bs);
+
+                            // zero and constant blocks are not stored
+                            const block_tag_t tag = base_class::get_block_tag(j / bs, i / bs);
+                            if (tag.kind == block_kind::zero) continue;
+
+                            // diagonal blocks
+                            if (i == j)
+                            {
+                                // decompress the 'buffer'
+                                base_class::decompress_block(j / bs, i / bs, k, &buffer_a[0], (nn * (nn + 1)) / 2);
+
+                                // apply symmetric matrix vector multiply
+                                blas::spmv(cblas_layout, (MT == matrix_type::upper_triangular ? CblasUpper : CblasLower), nn, alpha, &buffer_a[0], &x[i], 1, fmat_1, &y[i], 1);
+                            }
+                            // non-diagonal blocks
+                            else if (tag.kind == block_kind::constant)
+                            {
+                                base_class::matrix_vector_constant(false, mm, nn, alpha * static_cast<Tmat>(tag.value), &x[i], &y[j]);
+                                base_class::matrix_vector_constant(true, mm, nn, alpha * static_cast<Tmat>(tag.value), &x[j], &y[i]);
+                            }
+                            else
+                            {
+                            #if defined(FP_INTEGER_GEMV)
+                                if (internal::is_fixed_point_type<BM, BE>::value)
+                                {
+                                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
+                                    const Tmat rescale_p_3 = fptr[0];
+                                    const Tmat rescale_p_4 = fptr[1];
+                                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+
+                                    // integer gem2v call
+                                    base_class::integer_gem2v(mm, nn, &tmp_a[0], &x[i], &tmp_y[0], &x[j], &tmp_y[bs]);
+                                    // ..finalize gem2v call: rescaling
+                                    const Tmat a = rescale_p_4;
+                                    const Tmat b = rescale_p_2[i / bs] * rescale_p_3;
+                                    for (std::size_t jj = 0; jj < mm; ++jj)
+                                    {
+                                        y[j + jj] += alpha * (tmp_y[jj] * a + b);
+                                    }
+                                    const T c = rescale_p_2[j / bs] * rescale_p_3;
+                                    for (std::size_t ii = 0; ii < nn; ++ii)
+                                    {
+                                        y[i + ii] += alpha * (tmp_y[bs + ii] * a + c);
+                                    }
+                                }
+                                else                            
+                            #endif
+                                // decompress the block on the fly and apply the block and its transpose, if the fused kernel is available
+                                if (!base_class::try_matrix_vector_symmetric_fused(mm, nn, alpha, &compressed_data[k], &x[i], &y[j], &x[j], &y[i]))
+                                {
+                                    // decompress the 'buffer'
+                                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
+                                    
+                                    // apply the block and its transpose
+                                    base_class::matrix_vector_symmetric_block(mm, nn, alpha, &buffer_a[0], &x[i], &y[j], &x[j], &y[i]);
+                                }
+                            }
+                        }
+                    }
+                }, false, alpha, x, beta, y);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void symmetric_matrix_vector(const Tmat alpha, const std::vector<Tvec>& x, const Tvec beta, std::vector<Tvec>& y) const
+            {
+                symmetric_matrix_vector(alpha, &x[0], beta, &y[0]);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void spmv(const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
+            {
+                symmetric_matrix_vector(alpha, x, beta, y);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void spmv(const Tmat alpha, const std::vector<Tvec>& x, const Tvec beta, std::vector<Tvec>& y) const
+            {
+                symmetric_matrix_vector(alpha, &x[0], beta, &y[0]);
+            }
+
+            //! \brief Triangular (packed) symmetric matrix multi-vector multiply
+            //!
+            //! Computes Y = alpha * A * X + beta * Y for 'k' vectors.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param k number of vectors
+            //! \param beta scaling factor for the output vectors
+            //! \param y pointer to the output vectors
+            //! \param ldy leading dimension of 'y'
+            template <typename Tmat = T, typename Tvec = T>
+            void symmetric_matrix_multi_vector(const Tmat alpha, const Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec beta, Tvec* y, const std::size_t ldy) const
+            {
+                matrix_multi_vector_kernel(false, alpha, x, ldx, k, beta, y, ldy, true);
+            }
+
+            //! \brief Triangular solve 
+            //!
+            //! Solves for y = alpha * A(T) * x.
+            //!
+            //! With the parallel execution policy, the block rows (no transposition) or block columns (transposition)
+            //! are distributed cyclically across the threads of an OpenMP team.
+            //! Whenever a diagonal block has been solved, each thread applies its contribution to all of its own
+            //! unsolved block rows / columns, starting with the one to be solved next (pipelining).
+            //! Contributions are accumulated in the same order as in the sequential case, so the results are identical.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the output vector
+            //! \param y pointer to the input vector
+            //! \param policy (optional) sequential or parallel execution
+            template <typename Tmat = T, typename Tvec = T>
+            void triangular_solve(const bool transpose, const Tmat alpha, Tvec* x, const Tvec* y, const execution_policy policy = execution_policy::sequential) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::solve: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (n == 0) return;
+
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+                static constexpr Tvec fvec_0 = static_cast<Tvec>(0.0);
+                
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
+                {
+                    // forward substitution for (transposed) lower triangular matrices, backward substitution otherwise
+                    const bool forward = (transpose ? (MT == matrix_type::upper_triangular) : (MT == matrix_type::lower_triangular));
+                    const std::size_t n_blocks = (n + bs - 1) / bs;
+                    const bool use_threads = (policy == execution_policy::parallel && n_blocks > 1);
+
+                    // block row / column that is solved in step 'b'
+                    auto block = [forward, n_blocks] (const std::size_t b) { return (forward ? b : (n_blocks - 1 - b)); };
+
+                    if (use_threads)
+                    {
+                        // accumulators for all block rows / columns
+                        internal::scratch_buffer<Tmat> buffer_x(n_blocks * bs);
+                        for (std::size_t i = 0; i < (n_blocks * bs); ++i)
+                        {
+                            buffer_x[i] = fmat_0;
+                        }
+
+                        #pragma omp parallel
+                        {
+                            const std::size_t thread_id = omp_get_thread_num();
+                            const std::size_t num_threads = omp_get_num_threads();
+
+                            // step 'b' is owned by thread 'b % num_threads'
+                            if (thread_id == 0)
+                            {
+                                triangular_solve_diagonal(transpose, block(0), x, &buffer_x[block(0) * bs], y);
+                            }
+
+                            #pragma omp barrier
+
+                            for (std::size_t b = 0; b < (n_blocks - 1); ++b)
+                            {
+                                const std::size_t bi = block(b);
+                                const std::size_t b_first = b + 1 + (thread_id + num_threads - (b + 1) % num_threads) % num_threads;
+                                for (std::size_t bb = b_first; bb < n_blocks; bb += num_threads)
+                                {
+                                    const std::size_t bj = block(bb);
+                                    triangular_solve_update(transpose, bj, bi, y, &buffer_x[bj * bs]);
+
+                                    // all contributions to the next block row / column are available: solve it
+                                    if (bb == (b + 1))
+                                    {
+                                        triangular_solve_diagonal(transpose, bj, x, &buffer_x[bj * bs], y);
+                                    }
+                                }
+
+                                #pragma omp barrier
+                            }
+                        }
+                    }
+                    else
+                    {
+                        // allocate local memory
+                        internal::scratch_buffer<Tmat> buffer_x(bs);
+
+                        for (std::size_t b = 0; b < n_blocks; ++b)
+                        {
+                            const std::size_t bj = block(b);
+                            for (std::size_t jj = 0; jj < bs; ++jj)
+                            {
+                                buffer_x[jj] = fmat_0;
+                            }
+
+                            // contributions of all block rows / columns solved so far
+                            for (std::size_t bb = 0; bb < b; ++bb)
+                            {
+                                triangular_solve_update(transpose, bj, block(bb), y, &buffer_x[0]);
+                            }
+
+                            triangular_solve_diagonal(transpose, bj, x, &buffer_x[0], y);
+                        }
+                    }
+
+                    // scale with 1 / alpha
+                    const Tmat inv_alpha = fmat_1 / alpha;
+                    for (std::size_t j = 0; j < n; ++j)
+                    {
+                        y[j] *= inv_alpha;
+                    }
+                }, transpose, alpha, y, fvec_0, x);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void triangular_solve(const bool transpose, const Tmat alpha, std::vector<Tvec>& x, const std::vector<Tvec>& y, const execution_policy policy = execution_policy::sequential) const
+            {
+                triangular_solve(transpose, alpha, &x[0], &y[0], policy);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void tpsv(const bool transpose, const Tmat alpha, Tvec* x, const Tvec* y) const
+            {
+                triangular_solve(transpose, alpha, x, y);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void tpsv(const bool transpose, const Tmat alpha, std::vector<Tvec>& x, const std::vector<Tvec>& y) const
+            {
+                triangular_solve(transpose, alpha, &x[0], &y[0]);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void tpsv(const bool transpose, const Tmat alpha, std::vector<Tvec>& xy) const
+            {
+                triangular_solve(transpose, alpha, xy, xy);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void tpsv(const bool transpose, const Tmat alpha, Tvec* xy) const
+            {
+                triangular_solve(transpose, alpha, xy, xy);
+            }
+
+            //! \brief Triangular solve with multiple right hand sides
+            //!
+            //! Solves for y = alpha * A(T) * x for 'k' vectors.
+            //! Each block is decompressed once and applied to all vectors: off-diagonal blocks
+            //! via a gemm update, diagonal blocks via a trsm call on the unpacked block.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the output vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param k number of vectors
+            //! \param y pointer to the input vectors
+            //! \param ldy leading dimension of 'y'
+            template <typename Tmat = T, typename Tvec = T>
+            void triangular_solve_multi_vector(const bool transpose, const Tmat alpha, Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec* y, const std::size_t ldy) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::triangular_solve_multi_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (n == 0 || k == 0) return;
+
+                if (alpha == static_cast<Tmat>(0.0))
+                {
+                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::triangular_solve_multi_vector: alpha must not be zero" << std::endl;
+                    return;
+                }
+
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+                static constexpr Tvec fvec_0 = static_cast<Tvec>(0.0);
+
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::multi_vector_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, const std::size_t ldx, const std::size_t k, Tmat* y, const std::size_t ldy)
+                {
+                    // allocate local memory
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+                    internal::scratch_buffer<Tmat> buffer_d(bs * bs);
+
+                #if defined(FP_INTEGER_GEMV)
+                    internal::scratch_buffer<Tmat> tmp_y(internal::is_fixed_point_type<BM, BE>::value ? bs * k : 0);
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? k : 0);
+                #endif
+
+                    // the vectors are stored column major: a row major block is the transpose of a column major block
+                    const bool upper = (MT == matrix_type::upper_triangular);
+                    const bool upper_colmajor = (L == matrix_layout::rowmajor ? !upper : upper);
+                    const bool transpose_colmajor = (L == matrix_layout::rowmajor ? !transpose : transpose);
+
+                    // forward substitution for (transposed) lower triangular matrices, backward substitution otherwise
+                    const bool forward = (transpose ? upper : !upper);
+                    const std::size_t n_blocks = (n + bs - 1) / bs;
+                    for (std::size_t b = 0; b < n_blocks; ++b)
+                    {
+                        const std::size_t bj = (forward ? b : (n_blocks - 1 - b));
+                        const std::size_t mm = std::min(n - bj * bs, bs);
+
+                        // load the right hand sides
+                        for (std::size_t c = 0; c < k; ++c)
+                        {
+                            for (std::size_t jj = 0; jj < mm; ++jj)
+                            {
+                                y[c * ldy + bj * bs + jj] = x[c * ldx + bj * bs + jj];
+                            }
+                        }
+
+                        // subtract the contribution of all blocks solved so far
+                        const std::size_t bi_start = (forward ? 0 : (bj + 1));
+                        const std::size_t bi_end = (forward ? bj : n_blocks);
+                        for (std::size_t bi = bi_start; bi < bi_end; ++bi)
+                        {
+                            const std::size_t nn = std::min(n - bi * bs, bs);
+                            const std::size_t offset = (transpose ? get_offset(bi, bj) : get_offset(bj, bi));
+                            const std::size_t bj_block = (transpose ? bi : bj);
+                            const std::size_t bi_block = (transpose ? bj : bi);
+                            const block_kind kind = base_class::get_block_tag(bj_block, bi_block).kind;
+
+                            // zero blocks are not stored and do not contribute
+                            if (kind == block_kind::zero) continue;
+
+                        #if defined(FP_INTEGER_GEMV)
+                            if (internal::is_fixed_point_type<BM, BE>::value && kind == block_kind::dense)
+                            {
+                                const float* fptr = reinterpret_cast<const float*>(&compressed_data[offset]);
+                                const Tmat rescale_p_3 = fptr[0];
+                                const Tmat rescale_p_4 = fptr[1];
+                                const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+
+                                for (std::size_t c = 0; c < k; ++c)
+                                {
+                                    rescale_p_2[c] = fmat_0;
+                                    for (std::size_t ii = 0; ii < nn; ++ii)
+                                    {
+                                        rescale_p_2[c] += y[c * ldy + bi * bs + ii];
+                                    }
+                                }
+
+                                // integer gemm
+                                if (transpose)
+                                {
+                                    base_class::integer_gemm(true, nn, mm, k, &tmp_a[0], &y[bi * bs], ldy, &tmp_y[0], bs);
+                                }
+                                else
+                                {
+                                    base_class::integer_gemm(false, mm, nn, k, &tmp_a[0], &y[bi * bs], ldy, &tmp_y[0], bs);
+                                }
+                                // ..finalize gemm call: rescaling
+                                for (std::size_t c = 0; c < k; ++c)
+                                {
+                                    const Tmat b = rescale_p_2[c] * rescale_p_3;
+                                    for (std::size_t jj = 0; jj < mm; ++jj)
+                                    {
+                                        y[c * ldy + bj * bs + jj] -= (tmp_y[c * bs + jj] * rescale_p_4 + b);
+                                    }
+                                }
+                            }
+                            else
+                        #endif
+                            {
+                                // decompress the block once for all vectors
+                                base_class::decompress_block(bj_block, bi_block, offset, &buffer_a[0], mm * nn);
+
+                                // gemm update
+                                if (transpose)
+                                {
+                                    base_class::matrix_multi_vector_block(true, nn, mm, k, -fmat_1, &buffer_a[0], &y[bi * bs], ldy, &y[bj * bs], ldy);
+                                }
+                                else
+                                {
+                                    base_class::matrix_multi_vector_block(false, mm, nn, k, -fmat_1, &buffer_a[0], &y[bi * bs], ldy, &y[bj * bs], ldy);
+                                }
+                            }
+                        }
+
+                        // decompress and unpack the diagonal block
+                        const std::size_t offset = get_offset(bj, bj);
+                        base_class::decompress_block(bj, bj, offset, &buffer_d[0], (mm * (mm + 1)) / 2);
+                        unpack_diagonal_block(&buffer_d[0], &buffer_a[0], mm, false);
+
+                        // apply triangular solve to all vectors
+                        blas::trsm(CblasColMajor, CblasLeft, (upper_colmajor ? CblasUpper : CblasLower), (transpose_colmajor ? CblasTrans : CblasNoTrans), CblasNonUnit, mm, k, fmat_1, &buffer_a[0], mm, &y[bj * bs], ldy);
+                    }
+
+                    // scale with 1 / alpha
+                    const Tmat inv_alpha = fmat_1 / alpha;
+                    for (std::size_t c = 0; c < k; ++c)
+                    {
+                        for (std::size_t j = 0; j < n; ++j)
+                        {
+                            y[c * ldy + j] *= inv_alpha;
+                        }
+                    }
+                }, transpose, alpha, y, ldy, k, fvec_0, x, ldx);
+            }
+
+            template <typename Tmat = T, typename Tvec = T>
+            void trsm(const bool transpose, const Tmat alpha, Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec* y, const std::size_t ldy) const
+            {
+                triangular_solve_multi_vector(transpose, alpha, x, ldx, k, y, ldy);
+            }
+        };
+
+        //! \brief Compressed matrix with the compression scheme selected at runtime
+        //!
+        //! All supported (BM, BE) combinations are instantiated at compile time.
+        //! The constructor creates the matrix for the requested combination, and all BLAS operations
+        //! are forwarded to it through the 'matrix_interface': there is a single virtual call per operation.
+        //!
+        //! \tparam T initial data type before compression
+        //! \tparam L data layout/order (any of row major or column major)
+        //! \tparam MT matrix type (any of general, upper triangular or lower triangular)
+        template <typename T, matrix_layout L = matrix_layout::rowmajor, matrix_type MT = matrix_type::general>
+        class any_matrix : public matrix_interface
+        {
+            static_assert(MT == matrix_type::general || MT == matrix_type::upper_triangular || MT == matrix_type::lower_triangular, "error: only general, upper or lower triangular matrices are allowed");
+
+            // compression scheme
+            template <std::uint32_t BM, std::uint32_t BE>
+            struct format
+            {
+                static constexpr std::uint32_t bm = BM;
+                static constexpr std::uint32_t be = BE;
+            };
+
+            // matrix type for a given compression scheme
+            template <std::uint32_t BM, std::uint32_t BE, matrix_type X = MT>
+            struct matrix_t
+            {
+                using type = triangular_matrix<T, L, MT, BM, BE>;
+            };
+
+            template <std::uint32_t BM, std::uint32_t BE>
+            struct matrix_t<BM, BE, matrix_type::general>
+            {
+                using type = matrix<T, L, BM, BE>;
+            };
+
+            // list of compression schemes: the matrix is created for the first one that matches
+            template <typename ...F>
+            struct format_list
+            {
+                static bool contains(const std::uint32_t bm, const std::uint32_t be)
+                {
+                    return false;
+                }
+
+                static matrix_interface* create(const std::uint32_t bm, const std::uint32_t be, const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs)
+                {
+                    return nullptr;
+                }
+            };
+
+            template <typename F, typename ...R>
+            struct format_list<F, R...>
+            {
+                static bool contains(const std::uint32_t bm, const std::uint32_t be)
+                {
+                    return (bm == F::bm && be == F::be) || format_list<R...>::contains(bm, be);
+                }
+
+                static matrix_interface* create(const std::uint32_t bm, const std::uint32_t be, const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs)
+                {
+                    if (bm == F::bm && be == F::be)
+                    {
+                        return new typename matrix_t<F::bm, F::be>::type(data, ld_data, extent, bs);
+                    }
+
+                    return format_list<R...>::create(bm, be, data, ld_data, extent, bs);
+                }
+            };
+
+            // supported compression schemes: IEEE double and single precision, bfloat16, IEEE754 half precision, 8-bit floating point (E4M3, E5M2),
+            // 8-bit block floating point (groups of 16 and 32), 16, 8 and 4 bit fixed point
+            // note: the integer gemv does not support the bit-packed formats
+            using supported_formats = format_list<format<52, 11>, format<23, 8>, format<7, 8>, format<10, 5>, format<3, 4>, format<2, 5>,
+                format<7, block_exponent(16)>, format<7, block_exponent(32)>, format<16, 0>, format<8, 0>, format<4, 0>>;
+
+            // the compressed matrix
+            std::unique_ptr<matrix_interface> compressed_matrix;
+
+        public:
+
+            // extent of the matrix: 'm' rows and 'n' columns
+            const std::size_t m;
+            const std::size_t n;
+
+            // compression scheme: number of bits in the mantissa and in the exponent
+            const std::uint32_t bm;
+            const std::uint32_t be;
+
+            // (default) block size
+            static constexpr std::size_t bs_default = 32;
+
+            //! \brief Test for a compression scheme being available
+            //!
+            //! \param bm number of bits in the mantissa
+            //! \param be number of bits in the exponent
+            //! \return true if a matrix can be created for this compression scheme
+            static bool is_supported(const std::uint32_t bm, const std::uint32_t be)
+            {
+                return supported_formats::contains(bm, be);
+            }
+
+            // do not create a standard constructor
+            any_matrix() = delete;
+
+            //! \brief Constructor
+            //!
+            //! This constructor applies the matrix compression.
+            //!
+            //! \param bm number of bits in the mantissa
+            //! \param be number of bits in the exponent
+            //! \param data pointer to the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            any_matrix(const std::uint32_t bm, const std::uint32_t be, const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+                :
+                compressed_matrix(supported_formats::create(bm, be, data, ld_data, extent, bs)),
+                m(extent[0]),
+                n(extent[1]),
+                bm(bm),
+                be(be)
+            {
+                if (!is_supported(bm, be))
+                {
+                    std::cerr << "error in any_matrix<..>::any_matrix: compression scheme (BM=" << bm << ", BE=" << be << ") is not supported" << std::endl;
+                    throw std::exception();
+                }
+            }
+
+            any_matrix(const std::uint32_t bm, const std::uint32_t be, const T* data, const std::size_t ld_data, const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+                :
+                any_matrix(bm, be, data, ld_data, std::array<std::size_t, 2>({extent[0], extent[0]}), bs)
+            { ; }
+
+            template <std::size_t D>
+            any_matrix(const std::uint32_t bm, const std::uint32_t be, const std::vector<T>& data, const std::size_t ld_data, const std::array<std::size_t, D>& extent, const std::size_t bs = bs_default)
+                :
+                any_matrix(bm, be, &data[0], ld_data, extent, bs)
+            { ; }
+
+            //! \brief Move constructor 
+            any_matrix(any_matrix&& rhs) = default;
+
+            //! \brief Destructor
+            virtual ~any_matrix() { ; }
+
+            //! \brief Access to the compressed matrix
+            //!
+            //! This method gives access to the full functionality of the compressed matrix, e.g. the triangular solve.
+            //!
+            //! \tparam BM number of bits in the mantissa
+            //! \tparam BE number of bits in the exponent
+            //! \return pointer to the compressed matrix, or nullptr if its compression scheme differs from (BM, BE)
+            template <std::uint32_t BM, std::uint32_t BE>
+            const typename matrix_t<BM, BE>::type* get() const
+            {
+                return (BM == bm && BE == be ? static_cast<const typename matrix_t<BM, BE>::type*>(compressed_matrix.get()) : nullptr);
+            }
+
+            virtual std::size_t memory_footprint_bytes() const
+            {
+                return compressed_matrix->memory_footprint_bytes();
+            }
+
+        #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y) const                               \
+            {                                                                                                                                                               \
+                compressed_matrix->matrix_vector(transpose, alpha, x, beta, y);                                                                                                          \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y) const     \
+            {                                                                                                                                                               \
+                compressed_matrix->matrix_vector(transpose, alpha, &x[0], beta, &y[0]);                                                                                                  \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_multi_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const std::size_t ldx, const std::size_t k, const TYPE_VEC beta, TYPE_VEC* y, const std::size_t ldy) const \
+            {                                                                                                                                                               \
+                compressed_matrix->matrix_multi_vector(transpose, alpha, x, ldx, k, beta, y, ldy);                                                                                       \
+            }                                                                                                                                                               \
+
+            MACRO_MATRIX_VECTOR(double, double);
+            MACRO_MATRIX_VECTOR(double, float);
+            MACRO_MATRIX_VECTOR(float, double);
+            MACRO_MATRIX_VECTOR(float, float);
+
+        #undef MACRO_MATRIX_VECTOR
+        };
+
+        //! \brief Error bound for the adaptive compression
+        //!
+        //! A compressed block meets the bound if |a - a_compressed| <= max('absolute', 'relative' * |a|) holds for all its elements.
+        struct error_bound
+        {
+            double relative;
+            double absolute;
+        };
+
+        //! \brief Compressed matrix with the compression scheme selected per block
+        //!
+        //! Each block is stored using the compression scheme with the smallest memory footprint that meets the error bound:
+        //! 8-bit fixed point, 12-bit floating point (lane-interleaved), 16-bit fixed point, bfloat16, IEEE754 single and double precision.
+        //! The block index holds the offset and the compression scheme of each block, and the BLAS kernels dispatch per block.
+        //!
+        //! \tparam T initial data type before compression
+        //! \tparam L data layout/order (any of row major or column major)
+        template <typename T, matrix_layout L = matrix_layout::rowmajor>
+        class adaptive_matrix : public matrix_base<T, L>
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+
+            using this_class = adaptive_matrix<T, L>;
+            using base_class = matrix_base<T, L>;
+
+            static constexpr CBLAS_LAYOUT cblas_layout = (L == matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+            // compression scheme
+            template <std::uint32_t BM, std::uint32_t BE>
+            struct format
+            {
+                static constexpr std::uint32_t bm = BM;
+                static constexpr std::uint32_t be = BE;
+            };
+
+            // list of compression schemes: 'kernel' is called with the compression scheme at position 'id'
+            template <typename ...F>
+            struct format_list
+            {
+                static constexpr std::uint32_t size = 0;
+
+                template <typename K>
+                static void apply(const std::uint32_t id, const K& kernel)
+                {
+                    std::cerr << "error in adaptive_matrix<..>::format_list::apply: unknown compression scheme" << std::endl;
+                }
+            };
+
+            template <typename F, typename ...R>
+            struct format_list<F, R...>
+            {
+                static constexpr std::uint32_t size = 1 + sizeof...(R);
+
+                template <typename K>
+                static void apply(const std::uint32_t id, const K& kernel)
+                {
+                    if (id == 0)
+                    {
+                        kernel(F());
+                    }
+                    else
+                    {
+                        format_list<R...>::apply(id - 1, kernel);
+                    }
+                }
+            };
+
+            // candidate compression schemes with increasing memory footprint: the last one is taken if no other one meets the error bound
+            using candidate_formats = format_list<format<8, 0>, format<7, lane_interleaved(4)>, format<16, 0>, format<7, 8>, format<23, 8>, format<52, 11>>;
+
+            // block index: offset w.r.t. 'compressed_data' (in elements of type 'T') and compression scheme
+            struct block_t
+            {
+                std::size_t offset;
+                std::uint32_t format;
+            };
+
+        public:
+
+            // extent of the matrix: 'm' rows and 'n' columns
+            using base_class::m;
+            using base_class::n;
+
+            // (default) block size
+            static constexpr std::size_t bs_default = base_class::bs_default;
+
+            // error bound used for the compression
+            const error_bound bound;
+
+        private:
+
+            // block size
+            using base_class::bs;
+
+            // compressed matrix: blocks are aligned to the size of 'T'
+            using base_class::memory;
+            using base_class::compressed_data;
+
+            // block (bj, bi) is at position 'bj * ((n + bs - 1) / bs) + bi'
+            std::vector<block_t> block_index;
+
+            // blocks are packed densely: the SIMD decoders may read up to one 256-bit word beyond the end of the last block
+            static constexpr std::size_t padding = (32 + sizeof(T) - 1) / sizeof(T);
+
+            //! \brief Matrix compression
+            //!
+            //! For each block, the candidate compression schemes are tested one after another.
+            //!
+            //! \param data pointer to the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
+            void compress(const T* data, const std::size_t ld_data)
+            {
+                if (m == 0 || n == 0 || bs == 0) return;
+
+                const std::size_t num_block_cols = (n + bs - 1) / bs;
+                block_index.resize(((m + bs - 1) / bs) * num_block_cols);
+
+                // blocks are copied into the buffer before the compression
+                internal::scratch_buffer<T> buffer_data(bs * bs);
+                internal::scratch_buffer<T> buffer_test_data(bs * bs);
+                // note: the lambda below captures pointers rather than the variable length arrays
+                T* buffer = &buffer_data[0];
+                T* buffer_test = &buffer_test_data[0];
+                std::size_t offset = 0;
+
+                for (std::size_t j = 0; j < m; j += bs)
+                {
+                    for (std::size_t i = 0; i < n; i += bs)
+                    {
+                        // extent of the current block
+                        const std::size_t mm = std::min(m - j, bs);
+                        const std::size_t nn = std::min(n - i, bs);
+                        const std::size_t num_elements = mm * nn;
+
+                        // copy block into the 'buffer'
+                        const std::size_t ldn = (L == matrix_layout::rowmajor ? nn : mm);
+                        for (std::size_t jj = 0; jj < mm; ++jj)
+                        {
+                            for (std::size_t ii = 0; ii < nn; ++ii)
+                            {
+                                const T value = data[idx<L>(j + jj, i + ii, ld_data)];
+                                buffer[idx<L>(jj, ii, ldn)] = value;
+                            }
+                        }
+
+                        // compress the 'buffer' into the first compression scheme that meets the error bound
+                        for (std::uint32_t id = 0; id < candidate_formats::size; ++id)
+                        {
+                            bool accept = ((id + 1) == candidate_formats::size);
+                            std::size_t block_elements = 0;
+
+                            candidate_formats::apply(id, [&](const auto f)
+                            {
+                                using stream = fp_stream<decltype(f)::bm, decltype(f)::be>;
+                                using fp_type = typename stream::type;
+
+                                block_elements = (stream::memory_footprint_bytes(num_elements) + sizeof(T) - 1) / sizeof(T);
+                                memory.resize(offset + block_elements + padding);
+                                fp_type* ptr = reinterpret_cast<fp_type*>(&memory[offset]);
+                                stream::compress(buffer, ptr, num_elements);
+
+                                if (!accept)
+                                {
+                                    stream::decompress(ptr, buffer_test, num_elements);
+
+                                    accept = true;
+                                    for (std::size_t k = 0; k < num_elements; ++k)
+                                    {
+                                        const double error = std::abs(static_cast<double>(buffer_test[k]) - static_cast<double>(buffer[k]));
+                                        const double tolerance = std::max(bound.absolute, bound.relative * std::abs(static_cast<double>(buffer[k])));
+                                        // note: NaN does not meet any error bound
+                                        accept &= (error <= tolerance);
+                                    }
+                                }
+                            });
+
+                            if (accept)
+                            {
+                                block_index[(j / bs) * num_block_cols + (i / bs)] = {offset, id};
+                                offset += block_elements;
+                                break;
+                            }
+                        }
+                    }
+                }
+
+                memory.resize(offset + padding);
+            }
+
+        public:
+
+            // do not create a standard constructor
+            adaptive_matrix() = delete;
+
+            //! \brief Constructor
+            //!
+            //! This constructor applies the matrix compression.
+            //!
+            //! \param data pointer to the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
+            //! \param extent matrix dimensions
+            //! \param bound error bound
+            //! \param bs block size
+            adaptive_matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const error_bound& bound, const std::size_t bs = bs_default)
+                :
+                base_class(data, ld_data, extent, bs),
+                bound(bound)
+            {
+                if (bound.relative < 0.0 || bound.absolute < 0.0)
+                {
+                    std::cerr << "error in adaptive_matrix<..>::adaptive_matrix: negative error bound" << std::endl;
+                    throw std::exception();
+                }
+
+                compress(data, ld_data);
+
+                // set up the internal pointer to the compressed matrix
+                compressed_data = memory.data();
+            }
+
+            //! \brief Constructor
+            //!
+            //! \param data vector holding the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
+            //! \param extent matrix dimensions
+            //! \param bound error bound
+            //! \param bs block size
+            adaptive_matrix(const std::vector<T>& data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const error_bound& bound, const std::size_t bs = bs_default)
+                :
+                adaptive_matrix(&data[0], ld_data, extent, bound, bs)
+            {
+                ;
+            }
+
+            //! \brief Move constructor 
+            adaptive_matrix(adaptive_matrix&& rhs) = default;
+
+            //! \brief Destructor
+            virtual ~adaptive_matrix()
+            { 
+                compressed_data = nullptr;
+            }
+
+            //! \brief Decompress this matrix
+            //!
+            //! \param data pointer to the (decompressed) output matrix
+            //! \param ld_data (optional) leading dimension of the memory allocation that is behind the output matrix
+            ptrdiff_t decompress(T* data, const std::size_t ld_data = 0) const
+            {
+                if (data == nullptr)
+                {
+                    std::cerr << "error in adaptive_matrix<..>::decompress: pointers is a nullptr" << std::endl;
+                    return 0;
+                }
+
+                if (m == 0 || n == 0) return 0;
+
+                // if 'ld_data' is not speficied, deduce it from the matrix dimensions
+                const std::size_t ld = (ld_data == 0 ? (L == matrix_layout::rowmajor ? n : m) : ld_data);
+                const std::size_t num_block_cols = (n + bs - 1) / bs;
+                internal::scratch_buffer<T> buffer(bs * bs);
+
+                for (std::size_t j = 0; j < m; j += bs)
+                {
+                    for (std::size_t i = 0; i < n; i += bs)
+                    {
+                        const block_t& block = block_index[(j / bs) * num_block_cols + (i / bs)];
+                        const std::size_t mm = std::min(m - j, bs);
+                        const std::size_t nn = std::min(n - i, bs);
+
+                        candidate_formats::apply(block.format, [&](const auto f)
+                        {
+                            using stream = fp_stream<decltype(f)::bm, decltype(f)::be>;
+                            stream::decompress(reinterpret_cast<const typename stream::type*>(&compressed_data[block.offset]), &buffer[0], mm * nn);
+                        });
+
+                        const std::size_t ldn = (L == matrix_layout::rowmajor ? nn : mm);
+                        for (std::size_t jj = 0; jj < mm; ++jj)
+                        {
+                            for (std::size_t ii = 0; ii < nn; ++ii)
+                            {
+                                data[idx<L>(j + jj, i + ii, ld)] = buffer[idx<L>(jj, ii, ldn)];
+                            }
+                        }
+                    }
+                }
+
+                return memory.size();
+            }
+
+            //! \brief Compression scheme of a block
+            //!
+            //! \param bj block id (row)
+            //! \param bi block id (column)
+            //! \return number of bits in the mantissa and in the exponent
+            std::array<std::uint32_t, 2> get_block_format(const std::size_t bj, const std::size_t bi) const
+            {
+                std::array<std::uint32_t, 2> result({0, 0});
+
+                if (bj >= ((m + bs - 1) / bs) || bi >= ((n + bs - 1) / bs))
+                {
+                    std::cerr << "error in adaptive_matrix<..>::get_block_format: block (" << bj << "," << bi << ") does not exist" << std::endl;
+                    return result;
+                }
+
+                candidate_formats::apply(block_index[bj * ((n + bs - 1) / bs) + bi].format, [&](const auto f)
+                {
+                    result = {decltype(f)::bm, decltype(f)::be};
+                });
+
+                return result;
+            }
+
+            //! return number of elements of type 'T' used for the compressed blocks
+            std::size_t memory_footprint_elements() const
+            {
+                return memory.size();
+            }
+
+            //! return number of bytes used for the compressed blocks and the block index
+            virtual std::size_t memory_footprint_bytes() const
+            {
+                return memory.size() * sizeof(T) + block_index.size() * sizeof(block_t);
+            }
+
+            //! \brief General matrix vector multiply
+            //!
+            //! Computes y = alpha * A(T) * x + beta * y.
+            //! The execution policy is the same as for the general matrix.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vector
+            //! \param beta scaling factor for the output vector
+            //! \param y pointer to the output vector
+            //! \param policy (optional) sequential or parallel execution
+            template <typename Tmat = T, typename Tvec = T>
+            void matrix_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y, const execution_policy policy = execution_policy::sequential) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in adaptive_matrix<..>::matrix_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (m == 0 || n == 0) return;
+
+                // some constants
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
+                {
+                    const std::size_t num_block_rows = (m + bs - 1) / bs;
+                    const std::size_t num_block_cols = (n + bs - 1) / bs;
+
+                    // parallel execution: each thread processes a range of block rows (no transposition) or block columns (transposition)
+                    const bool use_threads = (policy == execution_policy::parallel && (transpose ? num_block_cols : num_block_rows) > 1);
+                    const bool by_block_cols = (use_threads && transpose);
+                    const std::size_t num_outer = (by_block_cols ? num_block_cols : num_block_rows);
+                    const std::size_t num_inner = (by_block_cols ? num_block_rows : num_block_cols);
+
+                    // apply blocks within the range [outer_begin, outer_end) to 'x' and add the result to 'y'
+                    auto apply_blocks = [&](const std::size_t outer_begin, const std::size_t outer_end)
+                    {
+                        // allocate local memory
+                        internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+
+                        for (std::size_t b_outer = outer_begin; b_outer < outer_end; ++b_outer)
+                        {
+                            for (std::size_t b_inner = 0; b_inner < num_inner; ++b_inner)
+                            {
+                                const std::size_t j = (by_block_cols ? b_inner : b_outer) * bs;
+                                const std::size_t i = (by_block_cols ? b_outer : b_inner) * bs;
+                                const block_t& block = block_index[(j / bs) * num_block_cols + (i / bs)];
+                                const std::size_t mm = std::min(m - j, bs);
+                                const std::size_t nn = std::min(n - i, bs);
+                                const std::size_t src_idx = (transpose ? j : i);
+                                const std::size_t dst_idx = (transpose ? i : j);
+
+                                // dispatch on the compression scheme of the block
+                                candidate_formats::apply(block.format, [&](const auto f)
+                                {
+                                    using block_matrix = matrix_base<T, L, decltype(f)::bm, decltype(f)::be>;
+                                    using fp_type = typename block_matrix::fp_type;
+                                    const fp_type* a = reinterpret_cast<const fp_type*>(&compressed_data[block.offset]);
+
+                                    // decompress the block on the fly, if the fused kernel is available
+                                    if (!block_matrix::try_matrix_vector_fused(transpose, mm, nn, alpha, a, &x[src_idx], &y[dst_idx]))
+                                    {
+                                        // decompress the block
+                                        fp_stream<decltype(f)::bm, decltype(f)::be>::decompress(a, &buffer_a[0], mm * nn);
+
+                                        // apply general blas matrix vector multiplication
+                                        const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
+                                        blas::gemv(cblas_layout, (transpose ? CblasTrans : CblasNoTrans), mm, nn, alpha, &buffer_a[0], lda, &x[src_idx], 1, fmat_1, &y[dst_idx], 1);
+                                    }
+                                });
+                            }
+                        }
+                    };
+
+                    if (use_threads)
+                    {
+                        #pragma omp parallel
+                        {
+                            // contiguous ranges of block rows / columns
+                            const std::size_t thread_id = omp_get_thread_num();
+                            const std::size_t num_threads = omp_get_num_threads();
+                            apply_blocks((thread_id * num_outer) / num_threads, ((thread_id + 1) * num_outer) / num_threads);
+                        }
+                    }
+                    else
+                    {
+                        apply_blocks(0, num_outer);
+                    }
+                }, transpose, alpha, x, beta, y);
+            }
+
+            //! \brief General matrix multi-vector multiply
+            //!
+            //! Computes Y = alpha * A(T) * X + beta * Y for 'k' vectors (see the general matrix).
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param k number of vectors
+            //! \param beta scaling factor for the output vectors
+            //! \param y pointer to the output vectors
+            //! \param ldy leading dimension of 'y'
+            template <typename Tmat = T, typename Tvec = T>
+            void matrix_multi_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec beta, Tvec* y, const std::size_t ldy) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in adaptive_matrix<..>::matrix_multi_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (m == 0 || n == 0 || k == 0) return;
+
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::multi_vector_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, const std::size_t ldx, const std::size_t k, Tmat* y, const std::size_t ldy)
+                {
+                    // allocate local memory
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+                    const std::size_t num_block_cols = (n + bs - 1) / bs;
+
+                    // apply matrix to 'x' and add the result to 'y'
+                    for (std::size_t j = 0; j < m; j += bs)
+                    {
+                        for (std::size_t i = 0; i < n; i += bs)
+                        {
+                            const block_t& block = block_index[(j / bs) * num_block_cols + (i / bs)];
+                            const std::size_t mm = std::min(m - j, bs);
+                            const std::size_t nn = std::min(n - i, bs);
+                            const std::size_t src_idx = (transpose ? j : i);
+                            const std::size_t dst_idx = (transpose ? i : j);
+
+                            // decompress the block once for all vectors
+                            candidate_formats::apply(block.format, [&](const auto f)
+                            {
+                                using stream = fp_stream<decltype(f)::bm, decltype(f)::be>;
+                                stream::decompress(reinterpret_cast<const typename stream::type*>(&compressed_data[block.offset]), &buffer_a[0], mm * nn);
+                            });
+
+                            // apply the block to all vectors
+                            base_class::matrix_multi_vector_block(transpose, mm, nn, k, alpha, &buffer_a[0], &x[src_idx], ldx, &y[dst_idx], ldy);
+                        }
+                    }
+                }, transpose, alpha, x, ldx, k, beta, y, ldy);
+            }
+
+        #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y) const                               \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y);                                                                                                         \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y) const     \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0]);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y, const execution_policy policy) const         \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y, policy);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_multi_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const std::size_t ldx, const std::size_t k, const TYPE_VEC beta, TYPE_VEC* y, const std::size_t ldy) const \
+            {                                                                                                                                                               \
+                matrix_multi_vector_kernel(transpose, alpha, x, ldx, k, beta, y, ldy);                                                                                      \
+            }                                                                                                                                                               \
+
+            MACRO_MATRIX_VECTOR(double, double);
+            MACRO_MATRIX_VECTOR(double, float);
+            MACRO_MATRIX_VECTOR(float, double);
+            MACRO_MATRIX_VECTOR(float, float);
+
+        #undef MACRO_MATRIX_VECTOR
+        };
+
+        //! \brief Block sparse matrix
+        //!
+        //! Only nonzero blocks are stored, each of which is compressed using fp_stream<BM, BE> (the same as for the general matrix).
+        //! Blocks are indexed block row wise (block compressed sparse row): the blocks of block row 'bj' are 'block_row_ptr[bj]' .. 'block_row_ptr[bj + 1] - 1'
+        //! with block column ids 'block_col_idx[..]' in increasing order.
+        //! Memory footprint and the cost of the BLAS operations are proportional to the number of nonzero blocks.
+        //!
+        //! \tparam T initial data type before compression
+        //! \tparam L data layout/order (any of row major or column major)
+        //! \tparam BM number of bits in the exponent
+        //! \tparam BE number of bits in the mantissa
+        template <typename T, matrix_layout L = matrix_layout::rowmajor, std::uint32_t BM = ieee754_fp<T>::bm, std::uint32_t BE = ieee754_fp<T>::be>
+        class block_sparse_matrix : public matrix_base<T, L, BM, BE>
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+
+            using this_class = block_sparse_matrix<T, L, BM, BE>;
+            using base_class = matrix_base<T, L, BM, BE>;
+
+            static constexpr CBLAS_LAYOUT cblas_layout = (L == matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+        public:
+
+            // extent of the matrix: 'm' rows and 'n' columns
+            using base_class::m;
+            using base_class::n;
+
+            // data type for the internal floating / fixed point representation
+            using fp_type = typename base_class::fp_type;
+
+            // (default) block size
+            static constexpr std::size_t bs_default = base_class::bs_default;
+
+        private:
+
+            // block size
+            using base_class::bs;
+
+            // compressed matrix: nonzero blocks only
+            using base_class::memory;
+            using base_class::compressed_data;
+
+            // block index: block row pointers, block column ids, and offsets of the blocks w.r.t. 'compressed_data'
+            std::vector<std::size_t> block_row_ptr;
+            std::vector<std::size_t> block_col_idx;
+            std::vector<std::size_t> block_offset;
+
+            // transposed block index: the blocks of block column 'bi' are 'block_id[block_col_ptr[bi]]' .. 'block_id[block_col_ptr[bi + 1] - 1]'
+            // with block row ids 'block_row_idx[..]' in increasing order
+            std::vector<std::size_t> block_col_ptr;
+            std::vector<std::size_t> block_row_idx;
+            std::vector<std::size_t> block_id;
+
+            // blocks are aligned to the size of 'T' (fixed point blocks start with the scaling factors)
+            static constexpr std::size_t block_alignment = (sizeof(T) + sizeof(fp_type) - 1) / sizeof(fp_type);
+            // the SIMD decoders may read up to one 256-bit word beyond the end of the last block
+            static constexpr std::size_t padding = (32 + sizeof(fp_type) - 1) / sizeof(fp_type);
+
+            //! \brief Compress a block and append it to the internal storage
+            //!
+            //! \param data pointer to the block
+            //! \param ld_data leading dimension of the memory allocation that is behind the block
+            //! \param mm number of rows of the block
+            //! \param nn number of columns of the block
+            //! \param buffer pointer to a buffer holding at least 'mm * nn' elements
+            void append_block(const T* data, const std::size_t ld_data, const std::size_t mm, const std::size_t nn, T* buffer)
+            {
+                // copy block into the 'buffer'
+                const std::size_t ldn = (L == matrix_layout::rowmajor ? nn : mm);
+                for (std::size_t jj = 0; jj < mm; ++jj)
+                {
+                    for (std::size_t ii = 0; ii < nn; ++ii)
+                    {
+                        buffer[idx<L>(jj, ii, ldn)] = data[idx<L>(jj, ii, ld_data)];
+                    }
+                }
+
+                // the new block goes behind the last one
+                const std::size_t offset = (block_offset.empty() ? 0 : ((memory.size() - padding + block_alignment - 1) / block_alignment) * block_alignment);
+                memory.resize(offset + fp_stream<BM, BE>::memory_footprint_elements(mm * nn) + padding);
+                fp_stream<BM, BE>::compress(buffer, &memory[offset], mm * nn);
+                block_offset.push_back(offset);
+            }
+
+            //! \brief Create the transposed block index
+            void make_transposed_block_index()
+            {
+                const std::size_t num_block_rows = (m + bs - 1) / bs;
+                const std::size_t num_block_cols = (n + bs - 1) / bs;
+
+                // count the blocks per block column
+                block_col_ptr.assign(num_block_cols + 1, 0);
+                for (const std::size_t bi : block_col_idx)
+                {
+                    ++block_col_ptr[bi + 1];
+                }
+                for (std::size_t bi = 0; bi < num_block_cols; ++bi)
+                {
+                    block_col_ptr[bi + 1] += block_col_ptr[bi];
+                }
+
+                // walking through the block rows in increasing order yields increasing block row ids within each block column
+                std::vector<std::size_t> position(block_col_ptr.begin(), block_col_ptr.end() - 1);
+                block_row_idx.resize(block_col_idx.size());
+                block_id.resize(block_col_idx.size());
+                for (std::size_t bj = 0; bj < num_block_rows; ++bj)
+                {
+                    for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1]; ++b)
+                    {
+                        const std::size_t k = position[block_col_idx[b]]++;
+                        block_row_idx[k] = bj;
+                        block_id[k] = b;
+                    }
+                }
+            }
+
+        public:
+
+            // do not create a standard constructor
+            block_sparse_matrix() = delete;
+
+            //! \brief Constructor
+            //!
+            //! This constructor applies the matrix compression to a dense input matrix: blocks with all elements being zero are not stored.
+            //!
+            //! \param data pointer to the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
             //! \param extent matrix dimensions
             //! \param bs block size
-            template <typename TT, typename X = typename std::enable_if<!std::is_same<T, TT>::value>::type>
-            matrix(const TT* data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            block_sparse_matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
                 :
-                // since 'data' points to a compressed matrix set 'ld_data' to zero to avoid using the internal storage
-                matrix(reinterpret_cast<const T*>(data), 0, extent, bs)
+                base_class(data, ld_data, extent, bs)
+            {
+                if (m == 0 || n == 0 || bs == 0) return;
+
+                const std::size_t num_block_rows = (m + bs - 1) / bs;
+                block_row_ptr.assign(num_block_rows + 1, 0);
+
+                // allocate local memory
+                internal::scratch_buffer<T> buffer(bs * bs);
+
+                for (std::size_t j = 0; j < m; j += bs)
+                {
+                    for (std::size_t i = 0; i < n; i += bs)
+                    {
+                        // extent of the current block
+                        const std::size_t mm = std::min(m - j, bs);
+                        const std::size_t nn = std::min(n - i, bs);
+
+                        bool is_zero = true;
+                        for (std::size_t jj = 0; jj < mm && is_zero; ++jj)
+                        {
+                            for (std::size_t ii = 0; ii < nn; ++ii)
+                            {
+                                is_zero &= (data[idx<L>(j + jj, i + ii, ld_data)] == static_cast<T>(0.0));
+                            }
+                        }
+
+                        if (is_zero) continue;
+
+                        append_block(&data[idx<L>(j, i, ld_data)], ld_data, mm, nn, &buffer[0]);
+                        block_col_idx.push_back(i / bs);
+                    }
+
+                    block_row_ptr[j / bs + 1] = block_col_idx.size();
+                }
+
+                memory.shrink_to_fit();
+                make_transposed_block_index();
+
+                // set up the internal pointer to the compressed matrix
+                compressed_data = memory.data();
+            }
+
+            //! \brief Constructor
+            //!
+            //! \param data vector holding the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            block_sparse_matrix(const std::vector<T>& data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+                :
+                block_sparse_matrix(&data[0], ld_data, extent, bs)
+            {
+                ;
+            }
+
+            //! \brief Constructor
+            //!
+            //! This constructor applies the matrix compression to the nonzero blocks given in block compressed sparse row format.
+            //! Block 'k' is stored at 'block_data[k * bs * bs]' using layout 'L' with leading dimension 'bs'.
+            //! For blocks at the border of the matrix, only the upper left part (within the matrix) is used.
+            //!
+            //! \param block_data pointer to the nonzero blocks
+            //! \param row_ptr block row pointers ('(m + bs - 1) / bs + 1' entries)
+            //! \param col_idx block column ids (increasing within each block row)
+            //! \param extent matrix dimensions
+            //! \param bs block size
+            block_sparse_matrix(const T* block_data, const std::vector<std::size_t>& row_ptr, const std::vector<std::size_t>& col_idx, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+                :
+                base_class(block_data, bs, extent, bs),
+                block_row_ptr(row_ptr),
+                block_col_idx(col_idx)
+            {
+                if (m == 0 || n == 0 || bs == 0) return;
+
+                const std::size_t num_block_rows = (m + bs - 1) / bs;
+                const std::size_t num_block_cols = (n + bs - 1) / bs;
+
+                // check the block index
+                bool valid = (block_row_ptr.size() == (num_block_rows + 1) && block_row_ptr[0] == 0 && block_row_ptr[num_block_rows] == block_col_idx.size());
+                for (std::size_t bj = 0; bj < num_block_rows && valid; ++bj)
+                {
+                    valid &= (block_row_ptr[bj] <= block_row_ptr[bj + 1]);
+                    for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1] && valid; ++b)
+                    {
+                        valid &= (block_col_idx[b] < num_block_cols && (b == block_row_ptr[bj] || block_col_idx[b - 1] < block_col_idx[b]));
+                    }
+                }
+
+                if (!valid)
+                {
+                    std::cerr << "error in block_sparse_matrix<..," << BM << "," << BE << ">::block_sparse_matrix: invalid block index" << std::endl;
+                    throw std::exception();
+                }
+
+                // allocate memory for the compressed matrix
+                std::size_t num_elements = padding;
+                for (std::size_t bj = 0; bj < num_block_rows; ++bj)
+                {
+                    for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1]; ++b)
+                    {
+                        num_elements += fp_stream<BM, BE>::memory_footprint_elements(std::min(m - bj * bs, bs) * std::min(n - block_col_idx[b] * bs, bs)) + block_alignment - 1;
+                    }
+                }
+                memory.reserve(num_elements);
+                block_offset.reserve(block_col_idx.size());
+
+                // allocate local memory
+                internal::scratch_buffer<T> buffer(bs * bs);
+
+                for (std::size_t bj = 0; bj < num_block_rows; ++bj)
+                {
+                    for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1]; ++b)
+                    {
+                        const std::size_t mm = std::min(m - bj * bs, bs);
+                        const std::size_t nn = std::min(n - block_col_idx[b] * bs, bs);
+                        append_block(&block_data[b * bs * bs], bs, mm, nn, &buffer[0]);
+                    }
+                }
+
+                make_transposed_block_index();
+
+                // set up the internal pointer to the compressed matrix
+                compressed_data = memory.data();
+            }
+
+            //! \brief Move constructor
+            block_sparse_matrix(block_sparse_matrix&& rhs) = default;
+
+            //! \brief Destructor
+            virtual ~block_sparse_matrix()
+            {
+                compressed_data = nullptr;
+            }
+
+            //! \brief Decompress this matrix
+            //!
+            //! Blocks that are not stored are filled with zeros.
+            //!
+            //! \param data pointer to the (decompressed) output matrix
+            //! \param ld_data (optional) leading dimension of the memory allocation that is behind the output matrix
+            ptrdiff_t decompress(T* data, const std::size_t ld_data = 0) const
+            {
+                if (data == nullptr)
+                {
+                    std::cerr << "error in block_sparse_matrix<..," << BM << "," << BE << ">::decompress: pointers is a nullptr" << std::endl;
+                    return 0;
+                }
+
+                if (m == 0 || n == 0 || bs == 0) return 0;
+
+                // if 'ld_data' is not speficied, deduce it from the matrix dimensions
+                const std::size_t ld = (ld_data == 0 ? (L == matrix_layout::rowmajor ? n : m) : ld_data);
+                for (std::size_t j = 0; j < m; ++j)
+                {
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        data[idx<L>(j, i, ld)] = static_cast<T>(0.0);
+                    }
+                }
+
+                internal::scratch_buffer<T> buffer(bs * bs);
+
+                for (std::size_t bj = 0; bj < block_row_ptr.size() - 1; ++bj)
+                {
+                    for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1]; ++b)
+                    {
+                        const std::size_t j = bj * bs;
+                        const std::size_t i = block_col_idx[b] * bs;
+                        const std::size_t mm = std::min(m - j, bs);
+                        const std::size_t nn = std::min(n - i, bs);
+
+                        fp_stream<BM, BE>::decompress(&compressed_data[block_offset[b]], &buffer[0], mm * nn);
+
+                        const std::size_t ldn = (L == matrix_layout::rowmajor ? nn : mm);
+                        for (std::size_t jj = 0; jj < mm; ++jj)
+                        {
+                            for (std::size_t ii = 0; ii < nn; ++ii)
+                            {
+                                data[idx<L>(j + jj, i + ii, ld)] = buffer[idx<L>(jj, ii, ldn)];
+                            }
+                        }
+                    }
+                }
+
+                return memory.size();
+            }
+
+            //! \brief Access a compressed block
+            //!
+            //! See the general matrix.
+            //!
+            //! \param bj block id (row)
+            //! \param bi block id (column)
+            //! \return pointer to the compressed block, or nullptr if the block does not exist or is not stored (zero block)
+            const fp_type* get_block(const std::size_t bj, const std::size_t bi) const
+            {
+                if (bj >= ((m + bs - 1) / bs) || bi >= ((n + bs - 1) / bs))
+                {
+                    std::cerr << "error in block_sparse_matrix<..," << BM << "," << BE << ">::get_block: block (" << bj << "," << bi << ") does not exist" << std::endl;
+                    return nullptr;
+                }
+
+                const auto begin = block_col_idx.begin() + block_row_ptr[bj];
+                const auto end = block_col_idx.begin() + block_row_ptr[bj + 1];
+                const auto it = std::lower_bound(begin, end, bi);
+                if (it == end || *it != bi) return nullptr;
+
+                return &compressed_data[block_offset[it - block_col_idx.begin()]];
+            }
+
+            //! return the number of nonzero blocks
+            std::size_t num_blocks() const
+            {
+                return block_col_idx.size();
+            }
+
+            //! return number of elements of type 'fp_type' used for the compressed blocks
+            std::size_t memory_footprint_elements() const
+            {
+                return memory.size();
+            }
+
+            //! return number of bytes used for the compressed blocks and the block index
+            virtual std::size_t memory_footprint_bytes() const
+            {
+                return memory.size() * sizeof(fp_type) + (block_row_ptr.size() + block_col_idx.size() + block_offset.size()
+                    + block_col_ptr.size() + block_row_idx.size() + block_id.size()) * sizeof(std::size_t);
+            }
+
+            //! \brief General matrix vector multiply
+            //!
+            //! Computes y = alpha * A(T) * x + beta * y.
+            //!
+            //! With the parallel execution policy, the blocks are distributed across the threads of an OpenMP team
+            //! block row (no transposition) or block column (transposition) wise, so that each thread writes to a separate chunk of 'y'.
+            //! Each thread gets about the same number of blocks.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vector
+            //! \param beta scaling factor for the output vector
+            //! \param y pointer to the output vector
+            //! \param policy (optional) sequential or parallel execution
+            template <typename Tmat = T, typename Tvec = T>
+            void matrix_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y, const execution_policy policy = execution_policy::sequential) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in block_sparse_matrix<..," << BM << "," << BE << ">::matrix_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (m == 0 || n == 0) return;
+
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
+                {
+                #if defined(FP_INTEGER_GEMV)
+                    // the matrix vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix (see the general matrix)
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? (transpose ? m : n) / bs + 1 : 0);
+                    if (internal::is_fixed_point_type<BM, BE>::value)
+                    {
+                        const std::size_t mn = (transpose ? m : n);
+                        for (std::size_t i = 0, k = 0; i < mn; i += bs, ++k)
+                        {
+                            rescale_p_2[k] = fmat_0;
+                            const std::size_t ii_max = std::min(mn - i, bs);
+                            for (std::size_t ii = 0; ii < ii_max; ++ii)
+                            {
+                                rescale_p_2[k] += x[i + ii];
+                            }
+                        }
+                    }
+                #endif
+
+                    const std::size_t num_block_rows = (m + bs - 1) / bs;
+                    const std::size_t num_block_cols = (n + bs - 1) / bs;
+
+                    // parallel execution: each thread processes a range of block rows (no transposition) or block columns (transposition)
+                    // sequential execution: blocks are processed in the order they are stored
+                    const bool use_threads = (policy == execution_policy::parallel && (transpose ? num_block_cols : num_block_rows) > 1);
+                    const bool by_block_cols = (use_threads && transpose);
+                    const std::size_t num_outer = (by_block_cols ? num_block_cols : num_block_rows);
+                    const std::size_t* outer_ptr = (by_block_cols ? &block_col_ptr[0] : &block_row_ptr[0]);
+
+                    // apply blocks within the range [outer_begin, outer_end) to 'x' and add the result to 'y'
+                    auto apply_blocks = [&](const std::size_t outer_begin, const std::size_t outer_end)
+                    {
+                        // allocate local memory
+                        internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+                    #if defined(FP_INTEGER_GEMV)
+                        internal::scratch_buffer<Tmat> tmp_y(bs);
+                    #endif
+
+                        for (std::size_t b_outer = outer_begin; b_outer < outer_end; ++b_outer)
+                        {
+                            for (std::size_t b_inner = outer_ptr[b_outer]; b_inner < outer_ptr[b_outer + 1]; ++b_inner)
+                            {
+                                const std::size_t id = (by_block_cols ? block_id[b_inner] : b_inner);
+                                const std::size_t j = (by_block_cols ? block_row_idx[b_inner] : b_outer) * bs;
+                                const std::size_t i = (by_block_cols ? b_outer : block_col_idx[b_inner]) * bs;
+                                const std::size_t k = block_offset[id];
+                                const std::size_t mm = std::min(m - j, bs);
+                                const std::size_t nn = std::min(n - i, bs);
+                                const std::size_t src_idx = (transpose ? j : i);
+                                const std::size_t dst_idx = (transpose ? i : j);
+
+                            #if defined(FP_INTEGER_GEMV)
+                                if (internal::is_fixed_point_type<BM, BE>::value)
+                                {
+                                    // extract scaling factors for the current block
+                                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
+                                    const Tmat rescale_p_3 = fptr[0];
+                                    const Tmat rescale_p_4 = fptr[1];
+                                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+
+                                    // integer gemv
+                                    base_class::integer_gemv(transpose, mm, nn, &tmp_a[0], &x[src_idx], &tmp_y[0]);
+                                    // ..finalize gemv call: rescaling
+                                    const Tmat a = rescale_p_4;
+                                    const Tmat b = rescale_p_2[src_idx / bs] * rescale_p_3;
+                                    for (std::size_t jj = 0; jj < (transpose ? nn : mm); ++jj)
+                                    {
+                                        y[dst_idx + jj] += alpha * (tmp_y[jj] * a + b);
+                                    }
+                                }
+                                else
+                            #endif
+                                // decompress the block on the fly, if the fused kernel is available
+                                if (!base_class::try_matrix_vector_fused(transpose, mm, nn, alpha, &compressed_data[k], &x[src_idx], &y[dst_idx]))
+                                {
+                                    // decompress the block
+                                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
+
+                                    // apply general blas matrix vector multiplication
+                                    const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
+                                    blas::gemv(cblas_layout, (transpose ? CblasTrans : CblasNoTrans), mm, nn, alpha, &buffer_a[0], lda, &x[src_idx], 1, fmat_1, &y[dst_idx], 1);
+                                }
+                            }
+                        }
+                    };
+
+                    if (use_threads)
+                    {
+                        #pragma omp parallel
+                        {
+                            // contiguous ranges of block rows / columns with about the same number of blocks
+                            const std::size_t thread_id = omp_get_thread_num();
+                            const std::size_t num_threads = omp_get_num_threads();
+                            const std::size_t num_blocks = outer_ptr[num_outer];
+                            const std::size_t outer_begin = std::lower_bound(outer_ptr, outer_ptr + num_outer, (thread_id * num_blocks) / num_threads) - outer_ptr;
+                            const std::size_t outer_end = (thread_id + 1 == num_threads ? num_outer : std::lower_bound(outer_ptr, outer_ptr + num_outer, ((thread_id + 1) * num_blocks) / num_threads) - outer_ptr);
+                            apply_blocks(outer_begin, outer_end);
+                        }
+                    }
+                    else
+                    {
+                        apply_blocks(0, num_outer);
+                    }
+                }, transpose, alpha, x, beta, y);
+            }
+
+            //! \brief General matrix multi-vector multiply
+            //!
+            //! Computes Y = alpha * A(T) * X + beta * Y for 'k' vectors (see the general matrix).
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param k number of vectors
+            //! \param beta scaling factor for the output vectors
+            //! \param y pointer to the output vectors
+            //! \param ldy leading dimension of 'y'
+            template <typename Tmat = T, typename Tvec = T>
+            void matrix_multi_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec beta, Tvec* y, const std::size_t ldy) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in block_sparse_matrix<..," << BM << "," << BE << ">::matrix_multi_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (m == 0 || n == 0 || k == 0) return;
+
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::multi_vector_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, const std::size_t ldx, const std::size_t k, Tmat* y, const std::size_t ldy)
+                {
+                    // allocate local memory
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+
+                #if defined(FP_INTEGER_GEMV)
+                    // the matrix multi-vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix (see the general matrix)
+                    const std::size_t num_chunks = ((transpose ? m : n) + bs - 1) / bs;
+                    internal::scratch_buffer<Tmat> tmp_y(internal::is_fixed_point_type<BM, BE>::value ? bs * k : 0);
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? num_chunks * k : 0);
+                    if (internal::is_fixed_point_type<BM, BE>::value)
+                    {
+                        const std::size_t mn = (transpose ? m : n);
+                        for (std::size_t c = 0; c < k; ++c)
+                        {
+                            for (std::size_t i = 0, kk = 0; i < mn; i += bs, ++kk)
+                            {
+                                rescale_p_2[c * num_chunks + kk] = fmat_0;
+                                const std::size_t ii_max = std::min(mn - i, bs);
+                                for (std::size_t ii = 0; ii < ii_max; ++ii)
+                                {
+                                    rescale_p_2[c * num_chunks + kk] += x[c * ldx + i + ii];
+                                }
+                            }
+                        }
+                    }
+                #endif
+
+                    // apply matrix to 'x' and add the result to 'y'
+                    for (std::size_t bj = 0; bj < block_row_ptr.size() - 1; ++bj)
+                    {
+                        for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1]; ++b)
+                        {
+                            const std::size_t j = bj * bs;
+                            const std::size_t i = block_col_idx[b] * bs;
+                            const std::size_t offset = block_offset[b];
+                            const std::size_t mm = std::min(m - j, bs);
+                            const std::size_t nn = std::min(n - i, bs);
+                            const std::size_t src_idx = (transpose ? j : i);
+                            const std::size_t dst_idx = (transpose ? i : j);
+
+                        #if defined(FP_INTEGER_GEMV)
+                            if (internal::is_fixed_point_type<BM, BE>::value)
+                            {
+                                // extract scaling factors for the current block
+                                const float* fptr = reinterpret_cast<const float*>(&compressed_data[offset]);
+                                const Tmat rescale_p_3 = fptr[0];
+                                const Tmat rescale_p_4 = fptr[1];
+                                const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+
+                                // integer gemm
+                                base_class::integer_gemm(transpose, mm, nn, k, &tmp_a[0], &x[src_idx], ldx, &tmp_y[0], bs);
+                                // ..finalize gemm call: rescaling
+                                const Tmat a = rescale_p_4;
+                                for (std::size_t c = 0; c < k; ++c)
+                                {
+                                    const Tmat b = rescale_p_2[c * num_chunks + src_idx / bs] * rescale_p_3;
+                                    for (std::size_t jj = 0; jj < (transpose ? nn : mm); ++jj)
+                                    {
+                                        y[c * ldy + dst_idx + jj] += alpha * (tmp_y[c * bs + jj] * a + b);
+                                    }
+                                }
+                            }
+                            else
+                        #endif
+                            {
+                                // decompress the block once for all vectors
+                                fp_stream<BM, BE>::decompress(&compressed_data[offset], &buffer_a[0], mm * nn);
+
+                                // apply the block to all vectors
+                                base_class::matrix_multi_vector_block(transpose, mm, nn, k, alpha, &buffer_a[0], &x[src_idx], ldx, &y[dst_idx], ldy);
+                            }
+                        }
+                    }
+                }, transpose, alpha, x, ldx, k, beta, y, ldy);
+            }
+
+        #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y) const                               \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y);                                                                                                         \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y) const     \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0]);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y, const execution_policy policy) const         \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y, policy);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y, const execution_policy policy) const \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0], policy);                                                                                         \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_multi_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const std::size_t ldx, const std::size_t k, const TYPE_VEC beta, TYPE_VEC* y, const std::size_t ldy) const \
+            {                                                                                                                                                               \
+                matrix_multi_vector_kernel(transpose, alpha, x, ldx, k, beta, y, ldy);                                                                                      \
+            }                                                                                                                                                               \
+
+            MACRO_MATRIX_VECTOR(double, double);
+            MACRO_MATRIX_VECTOR(double, float);
+            MACRO_MATRIX_VECTOR(float, double);
+            MACRO_MATRIX_VECTOR(float, float);
+
+        #undef MACRO_MATRIX_VECTOR
+        };
+
+        //! \brief Symmetric matrix
+        //!
+        //! Only the upper triangle of the matrix is compressed, using the same block partitioning as the upper triangular matrix
+        //! (diagonal blocks are stored in packed format). The input matrix is checked for being symmetric,
+        //! so that the compressed matrix represents the input matrix and not just one of its triangles.
+        //!
+        //! Off-diagonal blocks contribute to two chunks of the output vector: each of them is applied to both chunks of the input vector
+        //! in one pass over the (decompressed) block.
+        //!
+        //! \tparam T initial data type before compression
+        //! \tparam L data layout/order (any of row major or column major)
+        //! \tparam BM number of bits in the exponent
+        //! \tparam BE number of bits in the mantissa
+        template <typename T, matrix_layout L = matrix_layout::rowmajor, std::uint32_t BM = ieee754_fp<T>::bm, std::uint32_t BE = ieee754_fp<T>::be>
+        class symmetric_matrix : public matrix_base<T, L, BM, BE>
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+
+            using this_class = symmetric_matrix<T, L, BM, BE>;
+            using base_class = matrix_base<T, L, BM, BE>;
+
+            static constexpr CBLAS_LAYOUT cblas_layout = (L == matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+            // the upper triangle is stored
+            static constexpr matrix_type MT = matrix_type::upper_triangular;
+
+        public:
+
+            // extent of the matrix: 'n' rows and 'n' columns
+            using base_class::n;
+
+            // data type for the internal floating / fixed point representation
+            using fp_type = typename base_class::fp_type;
+
+            // (default) block size
+            static constexpr std::size_t bs_default = base_class::bs_default;
+
+        private:
+
+            // block size
+            using base_class::bs;
+
+            // compressed matrix
+            using base_class::memory;
+            using base_class::compressed_data;
+
+            using partition_t = typename base_class::partition_t;
+            using base_class::partition;
+
+            // offsets of all blocks w.r.t. 'compressed_data': the matrix always uses a table
+        #if defined(FP_BLOCK_OFFSET_TABLE)
+            using base_class::block_offset;
+        #else
+            std::vector<std::size_t> block_offset;
+        #endif
+
+            using block_kind = typename base_class::block_kind;
+            using block_tag_t = typename base_class::block_tag_t;
+        #if defined(FP_CONSTANT_BLOCKS)
+            using base_class::block_tag;
+            using base_class::num_elements_stored;
+        #endif
+
+            //! \brief Block offset computation
+            //!
+            //! \param bj block id (row)
+            //! \param bi block id (column), with 'bi >= bj'
+            //! \return offset w.r.t. to 0
+            std::size_t get_offset(const std::size_t bj, const std::size_t bi) const
             {
-                // base class constructor makes sure that 'data' is not NULL
-                compressed_data = reinterpret_cast<const fp_type*>(data);
+                return block_offset[bj * ((n + bs - 1) / bs) + bi];
             }
 
-            //! \brief Move constructor 
-            matrix(matrix&& rhs) = default;
+            //! \brief Unpack a (decompressed) diagonal block
+            //!
+            //! Expands the packed upper triangle into a full 'nn x nn' block (leading dimension 'nn') with the lower triangle mirrored.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param packed pointer to the packed block
+            //! \param a pointer to the full block
+            //! \param nn extent of the block
+            template <typename Tmat>
+            static void unpack_diagonal_block(const Tmat* packed, Tmat* a, const std::size_t nn)
+            {
+                // row major upper triangle and column major lower triangle have the same packed format
+                for (std::size_t jj = 0, kk = 0; jj < nn; ++jj)
+                {
+                    const std::size_t ii_start = (L == matrix_layout::rowmajor ? jj : 0);
+                    const std::size_t ii_end = (L == matrix_layout::rowmajor ? nn : (jj + 1));
 
-            //! \brief Destructor
-            virtual ~matrix()
-            { 
-                compressed_data = nullptr;
+                    for (std::size_t ii = ii_start; ii < ii_end; ++ii, ++kk)
+                    {
+                        a[jj * nn + ii] = packed[kk];
+                        a[ii * nn + jj] = packed[kk];
+                    }
+                }
             }
-   
-            //! \brief (External) matrix compression
+
+        public:
+
+            // do not create a standard constructor
+            symmetric_matrix() = delete;
+
+            //! \brief Test for a matrix being symmetric
             //!
-            //! This method can be used without object creation.
+            //! \param data pointer to the matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the matrix
+            //! \param n extent of the matrix
+            //! \param tolerance (optional) largest relative difference between the elements (j, i) and (i, j)
+            //! \return true if the matrix is symmetric
+            static bool is_symmetric(const T* data, const std::size_t ld_data, const std::size_t n, const T tolerance = static_cast<T>(0.0))
+            {
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    for (std::size_t i = j + 1; i < n; ++i)
+                    {
+                        const T a_ji = data[idx<L>(j, i, ld_data)];
+                        const T a_ij = data[idx<L>(i, j, ld_data)];
+                        if (!(std::abs(a_ji - a_ij) <= tolerance * std::max(std::abs(a_ji), std::abs(a_ij))))
+                        {
+                            return false;
+                        }
+                    }
+                }
+
+                return true;
+            }
+
+            //! \brief Constructor
             //!
             //! \param data pointer to the input matrix
             //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
-            //! \param compressed_data pointer to the compressed matrix
             //! \param extent matrix dimensions
             //! \param bs (optional) block size
-            static ptrdiff_t compress(const T* data, const std::size_t ld_data, fp_type* compressed_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            //! \param tolerance (optional) largest relative difference between the elements (j, i) and (i, j) of the input matrix
+            symmetric_matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default, const T tolerance = static_cast<T>(0.0))
+                :
+                base_class(data, ld_data, extent, bs)
             {
-                if (data == nullptr || compressed_data == nullptr)
+                if (n == 0 || bs == 0) return;
+
+                if (ld_data < n)
                 {
-                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::compress: any of the pointers is a nullptr" << std::endl;
-                    return 0;
+                    std::cerr << "error in symmetric_matrix<..," << BM << "," << BE << ">::symmetric_matrix: leading dimension too small" << std::endl;
+                    throw std::exception();
                 }
-    
-                const std::size_t m = extent[0];
-                const std::size_t n = extent[1];
-                if (m == 0 || n == 0 || bs == 0) return 0;
-                
-                // create partitioning and use the base class compression method
-                const partition_t partition = base_class::template make_partition<matrix_type::general>(extent, bs);
-                return base_class::template compress<matrix_type::general>(data, ld_data, compressed_data, extent, bs, partition);
+
+                // only the upper triangle is stored
+                if (!is_symmetric(data, ld_data, n, tolerance))
+                {
+                    std::cerr << "error in symmetric_matrix<..," << BM << "," << BE << ">::symmetric_matrix: the input matrix is not symmetric" << std::endl;
+                    throw std::exception();
+                }
+
+            #if defined(FP_CONSTANT_BLOCKS)
+                // all blocks are dense unless the matrix compression finds zero or constant blocks
+                block_tag.assign(((n + bs - 1) / bs) * ((n + bs - 1) / bs), {block_kind::dense, static_cast<T>(0.0)});
+
+                // allocate memory for the compressed matrix
+                memory.resize(partition.num_elements);
+
+                // compress the matrix: zero and constant blocks are not stored, which changes the block offsets
+                num_elements_stored = base_class::template compress<MT>(data, ld_data, memory.data(), {n, n}, bs, partition, block_tag.data());
+                block_offset = base_class::template make_block_offset_table<MT>({n, n}, bs, partition, block_tag.data());
+
+                // release the memory of the blocks not stored: the SIMD decoders may read up to one 256-bit word beyond the end of the last block
+                memory.resize(num_elements_stored + (32 + sizeof(fp_type) - 1) / sizeof(fp_type));
+                memory.shrink_to_fit();
+            #else
+                // allocate memory for the compressed matrix: the SIMD decoders may read up to one 256-bit word beyond the end of the last block
+                memory.resize(partition.num_elements + (32 + sizeof(fp_type) - 1) / sizeof(fp_type));
+
+                // compress the matrix
+                base_class::template compress<MT>(data, ld_data, memory.data(), {n, n}, bs, partition);
+                block_offset = base_class::template make_block_offset_table<MT>({n, n}, bs, partition);
+            #endif
+
+                // set up the internal pointer to the compressed matrix
+                compressed_data = memory.data();
             }
 
-            //! \brief (External) matrix decompression
-            //!
-            //! This method can be used without object creation.
+            symmetric_matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default, const T tolerance = static_cast<T>(0.0))
+                :
+                symmetric_matrix(data, ld_data, std::array<std::size_t, 1>({extent[0]}), bs, tolerance)
+            {
+                if (extent[0] != extent[1])
+                {
+                    std::cerr << "error in symmetric_matrix<..," << BM << "," << BE << ">::symmetric_matrix: the input matrix is not square" << std::endl;
+                    throw std::exception();
+                }
+            }
+
+            //! \brief Constructor
             //!
-            //! \param compressed_data pointer to the compressed matrix
-            //! \param data pointer to the (decompressed) output matrix
-            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
+            //! \param data vector holding the input matrix
+            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
             //! \param extent matrix dimensions
             //! \param bs (optional) block size
-            static ptrdiff_t decompress(const fp_type* compressed_data, T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            //! \param tolerance (optional) largest relative difference between the elements (j, i) and (i, j) of the input matrix
+            template <std::size_t D>
+            symmetric_matrix(const std::vector<T>& data, const std::size_t ld_data, const std::array<std::size_t, D>& extent, const std::size_t bs = bs_default, const T tolerance = static_cast<T>(0.0))
+                :
+                symmetric_matrix(&data[0], ld_data, extent, bs, tolerance)
             {
-                if (data == nullptr || compressed_data == nullptr)
-                {
-                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::decompress: any of the pointers is a nullptr" << std::endl;
-                    return 0;
-                }
+                ;
+            }
 
-                const std::size_t m = extent[0];
-                const std::size_t n = extent[1];
-                if (m == 0 || n == 0 || bs == 0) return 0;
-                
-                // create partitioning and use the base class decompression method
-                const partition_t partition = base_class::template make_partition<matrix_type::general>(extent, bs);
-                return base_class::template decompress<matrix_type::general>(compressed_data, data, ld_data, extent, bs, partition);
+            //! \brief Move constructor
+            symmetric_matrix(symmetric_matrix&& rhs) = default;
+
+            //! \brief Destructor
+            virtual ~symmetric_matrix()
+            {
+                compressed_data = nullptr;
             }
 
             //! \brief Decompress this matrix
             //!
+            //! Both triangles are written.
+            //!
             //! \param data pointer to the (decompressed) output matrix
             //! \param ld_data (optional) leading dimension of the memory allocation that is behind the output matrix
             ptrdiff_t decompress(T* data, const std::size_t ld_data = 0) const
             {
                 if (data == nullptr)
                 {
-                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::decompress: pointers is a nullptr" << std::endl;
+                    std::cerr << "error in symmetric_matrix<..," << BM << "," << BE << ">::decompress: pointers is a nullptr" << std::endl;
                     return 0;
                 }
 
-                // if 'ld_data' is not speficied, deduce it from the matrix dimensions
-                return base_class::template decompress<matrix_type::general>(compressed_data, data, (ld_data == 0 ? (L == matrix_layout::rowmajor ? n : m) : ld_data), {m, n}, bs, partition);
-            }
+                if (n == 0 || bs == 0) return 0;
+
+                // if 'ld_data' is not speficied, deduce it from the matrix dimensions
+                const std::size_t ld = (ld_data == 0 ? n : ld_data);
+            #if defined(FP_CONSTANT_BLOCKS)
+                const ptrdiff_t num_elements = base_class::template decompress<MT>(compressed_data, data, ld, {n, n}, bs, partition, block_tag.data());
+            #else
+                const ptrdiff_t num_elements = base_class::template decompress<MT>(compressed_data, data, ld, {n, n}, bs, partition);
+            #endif
+
+                // mirror the upper triangle
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    for (std::size_t i = j + 1; i < n; ++i)
+                    {
+                        data[idx<L>(i, j, ld)] = data[idx<L>(j, i, ld)];
+                    }
+                }
+
+                return num_elements;
+            }
+
+            //! \brief Access a compressed block
+            //!
+            //! Block (bj, bi) with 'bi >= bj' holds rows 'bj * bs' .. 'min(n, (bj + 1) * bs) - 1' and columns 'bi * bs' .. 'min(n, (bi + 1) * bs) - 1',
+            //! and can be decompressed using fp_stream<BM, BE>::decompress.
+            //! Diagonal blocks are stored in packed format.
+            //!
+            //! \param bj block id (row)
+            //! \param bi block id (column)
+            //! \return pointer to the compressed block, or nullptr if the block is not stored (lower triangle, zero or constant block)
+            const fp_type* get_block(const std::size_t bj, const std::size_t bi) const
+            {
+                const std::size_t num_blocks = (n + bs - 1) / bs;
+                if (bj >= num_blocks || bi >= num_blocks || bi < bj)
+                {
+                    std::cerr << "error in symmetric_matrix<..," << BM << "," << BE << ">::get_block: block (" << bj << "," << bi << ") is not stored" << std::endl;
+                    return nullptr;
+                }
+
+                if (base_class::get_block_tag(bj, bi).kind != block_kind::dense) return nullptr;
+
+                return &compressed_data[get_offset(bj, bi)];
+            }
+
+            //! \brief Determine the number of elements needed to store the compressed matrix
+            //!
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            //! return number of elements of type 'fp_type'
+            static std::size_t memory_footprint_elements(const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+            {
+                const std::size_t n = extent[0];
+                if (n == 0 || bs == 0) return 0;
+
+                return (base_class::template make_partition<MT>({n, n}, bs)).num_elements;
+            }
+
+            //! \brief Determine the number of bytes needed to store the compressed matrix
+            //!
+            //! \param extent matrix dimensions
+            //! \param bs (optional) block size
+            //! return number of bytes
+            static std::size_t memory_footprint_bytes(const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+            {
+                return memory_footprint_elements(extent, bs) * sizeof(fp_type);
+            }
+
+            using base_class::memory_footprint_elements;
+            using base_class::memory_footprint_bytes;
+
+            //! \brief Symmetric matrix vector multiply
+            //!
+            //! Computes y = alpha * A * x + beta * y.
+            //!
+            //! With the parallel execution policy, the block rows are distributed across the threads of an OpenMP team,
+            //! each thread getting about the same number of blocks. Each block row writes to its own chunk of 'y', whereas
+            //! the transposed off-diagonal blocks write to the chunks of the block rows below: these contributions go to
+            //! a thread private buffer first, and all buffers are accumulated on 'y' afterwards.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition (no effect)
+            //! \param alpha scaling factor for the matrix
+            //! \param x pointer to the input vector
+            //! \param beta scaling factor for the output vector
+            //! \param y pointer to the output vector
+            //! \param policy (optional) sequential or parallel execution
+            template <typename Tmat = T, typename Tvec = T>
+            void matrix_vector_kernel(const bool, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y, const execution_policy policy = execution_policy::sequential) const
+            {
+                static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
+                static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
+
+                if (x == nullptr || y == nullptr)
+                {
+                    std::cerr << "error in symmetric_matrix<..," << BM << "," << BE << ">::matrix_vector: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (n == 0) return;
+
+                // some constants
+                static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+
+                // the kernel uses 'Tmat' for internal data representation
+                base_class::blas2_frame([&](const bool, const Tmat alpha, const Tmat* x, Tmat* y)
+                {
+                #if defined(FP_INTEGER_GEMV)
+                    // the matrix vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix (see the general matrix)
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? n / bs + 1 : 0);
+                    if (internal::is_fixed_point_type<BM, BE>::value)
+                    {
+                        for (std::size_t i = 0, k = 0; i < n; i += bs, ++k)
+                        {
+                            rescale_p_2[k] = fmat_0;
+                            const std::size_t ii_max = std::min(n - i, bs);
+                            for (std::size_t ii = 0; ii < ii_max; ++ii)
+                            {
+                                rescale_p_2[k] += x[i + ii];
+                            }
+                        }
+                    }
+                #endif
+
+                    const std::size_t num_blocks = (n + bs - 1) / bs;
+                    const bool use_threads = (policy == execution_policy::parallel && num_blocks > 1);
+
+                    // apply block rows within the range [b_begin, b_end) to 'x' and add the result to 'y':
+                    // the transposed off-diagonal blocks add to 'y_t', with element 'i' of 'y' being at 'y_t[i - i_t]'
+                    auto apply_blocks = [&](const std::size_t b_begin, const std::size_t b_end, Tmat* y_t, const std::size_t i_t)
+                    {
+                        // allocate local memory
+                        internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+                    #if defined(FP_INTEGER_GEMV)
+                        internal::scratch_buffer<Tmat> tmp_y(2 * bs);
+                    #endif
+
+                        for (std::size_t bj = b_begin; bj < b_end; ++bj)
+                        {
+                            for (std::size_t bi = bj; bi < num_blocks; ++bi)
+                            {
+                                const std::size_t j = bj * bs;
+                                const std::size_t i = bi * bs;
+                                const std::size_t k = get_offset(bj, bi);
+                                const std::size_t mm = std::min(n - j, bs);
+                                const std::size_t nn = std::min(n - i, bs);
+
+                                // zero and constant blocks are not stored
+                                const block_tag_t tag = base_class::get_block_tag(bj, bi);
+                                if (tag.kind == block_kind::zero) continue;
+
+                                // diagonal blocks
+                                if (i == j)
+                                {
+                                    // decompress the 'buffer'
+                                    base_class::decompress_block(bj, bi, k, &buffer_a[0], (nn * (nn + 1)) / 2);
+
+                                    // apply symmetric matrix vector multiply
+                                    blas::spmv(cblas_layout, CblasUpper, nn, alpha, &buffer_a[0], &x[i], 1, fmat_1, &y[i], 1);
+                                }
+                                // non-diagonal blocks
+                                else if (tag.kind == block_kind::constant)
+                                {
+                                    base_class::matrix_vector_constant(false, mm, nn, alpha * static_cast<Tmat>(tag.value), &x[i], &y[j]);
+                                    base_class::matrix_vector_constant(true, mm, nn, alpha * static_cast<Tmat>(tag.value), &x[j], &y_t[i - i_t]);
+                                }
+                                else
+                                {
+                                #if defined(FP_INTEGER_GEMV)
+                                    if (internal::is_fixed_point_type<BM, BE>::value)
+                                    {
+                                        // extract scaling factors for the current block
+                                        const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
+                                        const Tmat rescale_p_3 = fptr[0];
+                                        const Tmat rescale_p_4 = fptr[1];
+                                        const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+
+                                        // integer gem2v
+                                        base_class::integer_gem2v(mm, nn, &tmp_a[0], &x[i], &tmp_y[0], &x[j], &tmp_y[bs]);
+                                        // ..finalize gem2v call: rescaling
+                                        const Tmat a = rescale_p_4;
+                                        const Tmat b = rescale_p_2[bi] * rescale_p_3;
+                                        for (std::size_t jj = 0; jj < mm; ++jj)
+                                        {
+                                            y[j + jj] += alpha * (tmp_y[jj] * a + b);
+                                        }
+                                        const Tmat c = rescale_p_2[bj] * rescale_p_3;
+                                        for (std::size_t ii = 0; ii < nn; ++ii)
+                                        {
+                                            y_t[i - i_t + ii] += alpha * (tmp_y[bs + ii] * a + c);
+                                        }
+                                    }
+                                    else
+                                #endif
+                                    // decompress the block on the fly and apply the block and its transpose, if the fused kernel is available
+                                    if (!base_class::try_matrix_vector_symmetric_fused(mm, nn, alpha, &compressed_data[k], &x[i], &y[j], &x[j], &y_t[i - i_t]))
+                                    {
+                                        // decompress the block
+                                        fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
+
+                                        // apply the block and its transpose
+                                        base_class::matrix_vector_symmetric_block(mm, nn, alpha, &buffer_a[0], &x[i], &y[j], &x[j], &y_t[i - i_t]);
+                                    }
+                                }
+                            }
+                        }
+                    };
+
+                    if (use_threads)
+                    {
+                        // number of blocks in the block rows 0 .. 'bj - 1'
+                        internal::scratch_buffer<std::size_t> row_ptr(num_blocks + 1);
+                        row_ptr[0] = 0;
+                        for (std::size_t bj = 0; bj < num_blocks; ++bj)
+                        {
+                            row_ptr[bj + 1] = row_ptr[bj] + (num_blocks - bj);
+                        }
+
+                        // thread private buffers
+                        const std::size_t max_threads = omp_get_max_threads();
+                        internal::scratch_buffer<Tmat*> y_private(max_threads);
+                        internal::scratch_buffer<std::size_t> i_private(max_threads);
 
-            //! \brief Determine the number of elements needed to store the compressed matrix
-            //!
-            //! \param extent matrix dimensions
-            //! \param bs (optional) block size
-            //! return number of elements of type 'fp_type'
-            static std::size_t memory_footprint_elements(const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
-            {
-                const std::size_t m = extent[0];
-                const std::size_t n = extent[1];
-                if (m == 0 || n == 0 || bs == 0) return 0;
-                
-                return (base_class::template make_partition<matrix_type::general>(extent, bs)).num_elements;
-            }
+                        #pragma omp parallel
+                        {
+                            // contiguous ranges of block rows with about the same number of blocks
+                            const std::size_t thread_id = omp_get_thread_num();
+                            const std::size_t num_threads = omp_get_num_threads();
+                            const std::size_t b_begin = std::lower_bound(&row_ptr[0], &row_ptr[num_blocks], (thread_id * row_ptr[num_blocks]) / num_threads) - &row_ptr[0];
+                            const std::size_t b_end = (thread_id + 1 == num_threads ? num_blocks : std::lower_bound(&row_ptr[0], &row_ptr[num_blocks], ((thread_id + 1) * row_ptr[num_blocks]) / num_threads) - &row_ptr[0]);
+
+                            // the transposed blocks of the thread add to 'y' from row 'b_begin * bs' on
+                            const std::size_t i_t = std::min(b_begin * bs, n);
+                            internal::scratch_buffer<Tmat> y_t(n - i_t);
+                            for (std::size_t i = 0; i < (n - i_t); ++i)
+                            {
+                                y_t[i] = fmat_0;
+                            }
+                            y_private[thread_id] = &y_t[0];
+                            i_private[thread_id] = i_t;
 
-            //! \brief Determine the number of bytes needed to store the compressed matrix
-            //!
-            //! \param extent matrix dimensions
-            //! \param bs (optional) block size
-            //! return number of bytes
-            static std::size_t memory_footprint_bytes(const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
-            {
-                return memory_footprint_elements(extent, bs) * sizeof(fp_type);
-            }
+                            apply_blocks(b_begin, b_end, &y_t[0], i_t);
 
-            using base_class::memory_footprint_elements;
-            using base_class::memory_footprint_bytes;
+                            // accumulate the thread private buffers on 'y'
+                            #pragma omp barrier
+                            #pragma omp for schedule(static)
+                            for (std::size_t i = 0; i < n; ++i)
+                            {
+                                for (std::size_t t = 0; t < num_threads; ++t)
+                                {
+                                    if (i >= i_private[t])
+                                    {
+                                        y[i] += y_private[t][i - i_private[t]];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    else
+                    {
+                        apply_blocks(0, num_blocks, y, 0);
+                    }
+                }, false, alpha, x, beta, y);
+            }
 
-            //! \brief General matrix vector multiply
+            //! \brief Symmetric matrix multi-vector multiply
             //!
-            //! Computes y = alpha * A(T) * x + beta * y.
+            //! Computes Y = alpha * A * X + beta * Y for 'k' vectors.
+            //! The vectors are stored one after another, i.e. X and Y are column major with leading dimensions 'ldx' and 'ldy'.
+            //! Each block is decompressed only once and then applied to all vectors using BLAS gemm calls.
             //!
             //! \tparam Tmat data type to be used for the (intermediate) matrix representation
             //! \tparam Tvec data type of the input and output vectors
-            //! \param transpose matrix transposition
+            //! \param transpose matrix transposition (no effect)
             //! \param alpha scaling factor for the matrix
-            //! \param x pointer to the input vector
-            //! \param beta scaling factor for the output vector
-            //! \param y pointer to the output vector
+            //! \param x pointer to the input vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param k number of vectors
+            //! \param beta scaling factor for the output vectors
+            //! \param y pointer to the output vectors
+            //! \param ldy leading dimension of 'y'
             template <typename Tmat = T, typename Tvec = T>
-            void matrix_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
+            void matrix_multi_vector_kernel(const bool, const Tmat alpha, const Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec beta, Tvec* y, const std::size_t ldy) const
             {
                 static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
                 static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
 
                 if (x == nullptr || y == nullptr)
                 {
-                    std::cerr << "error in matrix<..," << BM << "," << BE << ">::matrix_vector: any of the pointers is a nullptr" << std::endl;
+                    std::cerr << "error in symmetric_matrix<..," << BM << "," << BE << ">::matrix_multi_vector: any of the pointers is a nullptr" << std::endl;
                     return;
                 }
 
-                if (m == 0 || n == 0) return;
+                if (n == 0 || k == 0) return;
 
                 // some constants
                 static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
-                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
-                
+
                 // the kernel uses 'Tmat' for internal data representation
-                base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
-                { 
+                base_class::multi_vector_frame([&](const bool, const Tmat alpha, const Tmat* x, const std::size_t ldx, const std::size_t k, Tmat* y, const std::size_t ldy)
+                {
                     // allocate local memory
-                    alignas(alignment) Tmat buffer_a[bs * bs];
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+                    internal::scratch_buffer<Tmat> buffer_d(bs * bs);
 
                 #if defined(FP_INTEGER_GEMV)
-                    // the matrix vector multiplication happens directly on the
-                    // integer (fixed point) representation of the matrix
-                    alignas(alignment) Tmat tmp_y[bs];
-                    std::vector<Tmat> rescale_p_2(0);
+                    // the matrix multi-vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix (see the general matrix)
+                    const std::size_t num_chunks = (n + bs - 1) / bs;
+                    internal::scratch_buffer<Tmat> tmp_y(internal::is_fixed_point_type<BM, BE>::value ? bs * k : 0);
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? num_chunks * k : 0);
                     if (internal::is_fixed_point_type<BM, BE>::value)
                     {
-                        const std::size_t mn = (transpose ? m : n);
-                        // the transformation between the fixed and floating point representation
-                        // contains an additive factor which is multiplied with the input vector:
-                        // we have to account for this by summing up chunks of the vector according to the partitioning
-                        rescale_p_2.reserve(mn / bs + 1);
-                        for (std::size_t i = 0, k = 0; i < mn; i += bs, ++k)
+                        for (std::size_t c = 0; c < k; ++c)
                         {
-                            rescale_p_2[k] = fmat_0;
-                            const std::size_t ii_max = std::min(mn - i, bs);
-                            for (std::size_t ii = 0; ii < ii_max; ++ii)
+                            for (std::size_t i = 0, kk = 0; i < n; i += bs, ++kk)
                             {
-                                rescale_p_2[k] += x[i + ii];
+                                rescale_p_2[c * num_chunks + kk] = fmat_0;
+                                const std::size_t ii_max = std::min(n - i, bs);
+                                for (std::size_t ii = 0; ii < ii_max; ++ii)
+                                {
+                                    rescale_p_2[c * num_chunks + kk] += x[c * ldx + i + ii];
+                                }
                             }
                         }
                     }
                 #endif
 
-                    // apply matrix to 'x' and add the result to 'y'
-                    for (std::size_t j = 0, k = 0; j < m; j += bs)
+                    for (std::size_t j = 0; j < n; j += bs)
                     {
-                        const std::size_t k_inc = ((m - j) < bs ? partition.num_elements_c : partition.num_elements_a);
-
-                        for (std::size_t i = 0; i < n; i += bs)
+                        for (std::size_t i = j; i < n; i += bs)
                         {
-                            const std::size_t mm = std::min(m - j, bs);
+                            const std::size_t offset = get_offset(j / bs, i / bs);
+                            const std::size_t mm = std::min(n - j, bs);
                             const std::size_t nn = std::min(n - i, bs);
+                            const block_kind kind = base_class::get_block_tag(j / bs, i / bs).kind;
+
+                            // zero blocks are not stored and do not contribute
+                            if (kind == block_kind::zero) continue;
+
+                            // diagonal blocks
+                            if (i == j)
+                            {
+                                // decompress and unpack the 'buffer'
+                                base_class::decompress_block(j / bs, i / bs, offset, &buffer_d[0], (nn * (nn + 1)) / 2);
+                                unpack_diagonal_block(&buffer_d[0], &buffer_a[0], nn);
+
+                                // apply the block to all vectors
+                                base_class::matrix_multi_vector_block(false, nn, nn, k, alpha, &buffer_a[0], &x[j], ldx, &y[j], ldy);
+
+                                continue;
+                            }
 
+                            // non-diagonal blocks
                         #if defined(FP_INTEGER_GEMV)
-                            if (internal::is_fixed_point_type<BM, BE>::value)
+                            if (internal::is_fixed_point_type<BM, BE>::value && kind == block_kind::dense)
                             {
-                                // extract scaling factors for the current block
-                                const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
+                                const float* fptr = reinterpret_cast<const float*>(&compressed_data[offset]);
                                 const Tmat rescale_p_3 = fptr[0];
                                 const Tmat rescale_p_4 = fptr[1];
                                 const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
-
-                                // move on to the next block
-                                k += ((n - i) < bs ? partition.num_elements_b : k_inc);
-                                
-                                // integer gemv
-                                const std::size_t src_idx = (transpose ? j : i);
-                                const std::size_t dst_idx = (transpose ? i : j);
-                                blas::gemv(L, transpose, mm, nn, &tmp_a[0], &x[src_idx], &tmp_y[0]);
-                                // ..finalize gemv call: rescaling
                                 const Tmat a = rescale_p_4;
-                                const Tmat b = rescale_p_2[src_idx / bs] * rescale_p_3;
-                                for (std::size_t jj = 0; jj < (transpose ? nn : mm); ++jj)
+
+                                // integer gemm: the block and its transpose
+                                for (std::size_t t = 0; t < 2; ++t)
                                 {
-                                    y[dst_idx + jj] += alpha * (tmp_y[jj] * a + b);
+                                    const bool transpose_block = (t == 1);
+                                    const std::size_t src = (transpose_block ? j : i);
+                                    const std::size_t dst = (transpose_block ? i : j);
+                                    base_class::integer_gemm(transpose_block, mm, nn, k, &tmp_a[0], &x[src], ldx, &tmp_y[0], bs);
+                                    // ..finalize gemm call: rescaling
+                                    for (std::size_t c = 0; c < k; ++c)
+                                    {
+                                        const Tmat b = rescale_p_2[c * num_chunks + src / bs] * rescale_p_3;
+                                        for (std::size_t jj = 0; jj < (transpose_block ? nn : mm); ++jj)
+                                        {
+                                            y[c * ldy + dst + jj] += alpha * (tmp_y[c * bs + jj] * a + b);
+                                        }
+                                    }
                                 }
                             }
-                            else                            
+                            else
                         #endif
                             {
-                                // decompress the block
-                                fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
+                                // decompress the block once for all vectors
+                                base_class::decompress_block(j / bs, i / bs, offset, &buffer_a[0], mm * nn);
 
-                                // move on to the next block
-                                k += ((n - i) < bs ? partition.num_elements_b : k_inc);
-
-                                // apply general blas matrix vector multiplication
-                                const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
-                                const std::size_t src_idx = (transpose ? j : i);
-                                const std::size_t dst_idx = (transpose ? i : j);
-                                blas::gemv(cblas_layout, (transpose ? CblasTrans : CblasNoTrans), mm, nn, alpha, &buffer_a[0], lda, &x[src_idx], 1, fmat_1, &y[dst_idx], 1);
+                                // apply the block and its transpose to all vectors
+                                base_class::matrix_multi_vector_block(false, mm, nn, k, alpha, &buffer_a[0], &x[i], ldx, &y[j], ldy);
+                                base_class::matrix_multi_vector_block(true, mm, nn, k, alpha, &buffer_a[0], &x[j], ldx, &y[i], ldy);
                             }
                         }
                     }
-                }, transpose, alpha, x, beta, y);
+                }, false, alpha, x, ldx, k, beta, y, ldy);
             }
 
         #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
@@ -979,6 +5481,21 @@ namespace FP_NAMESPACE
             {                                                                                                                                                               \
                 matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0]);                                                                                                 \
             }                                                                                                                                                               \
+                                                                                                                                                                            \
+            void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y, const execution_policy policy) const         \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y, policy);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y, const execution_policy policy) const \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0], policy);                                                                                         \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_multi_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const std::size_t ldx, const std::size_t k, const TYPE_VEC beta, TYPE_VEC* y, const std::size_t ldy) const \
+            {                                                                                                                                                               \
+                matrix_multi_vector_kernel(transpose, alpha, x, ldx, k, beta, y, ldy);                                                                                      \
+            }                                                                                                                                                               \
 
             MACRO_MATRIX_VECTOR(double, double);
             MACRO_MATRIX_VECTOR(double, float);
@@ -986,322 +5503,410 @@ namespace FP_NAMESPACE
             MACRO_MATRIX_VECTOR(float, float);
 
         #undef MACRO_MATRIX_VECTOR
-            
-            void gemv(const bool transpose, const T alpha, const T* x, const T beta, T* y) const
+
+            template <typename Tmat = T, typename Tvec = T>
+            void spmv(const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y, const execution_policy policy = execution_policy::sequential) const
             {
-                matrix_vector(transpose, alpha, x, beta, y);
+                matrix_vector_kernel(false, alpha, x, beta, y, policy);
             }
-            
-            void gemv(const bool transpose, const T alpha, const std::vector<T>& x, const T beta, std::vector<T>& y) const
+
+            template <typename Tmat = T, typename Tvec = T>
+            void spmv(const Tmat alpha, const std::vector<Tvec>& x, const Tvec beta, std::vector<Tvec>& y, const execution_policy policy = execution_policy::sequential) const
             {
-                matrix_vector(transpose, alpha, &x[0], beta, &y[0]);
+                matrix_vector_kernel(false, alpha, &x[0], beta, &y[0], policy);
             }
         };
 
-        //! \brief Triangular matrix
+        //! \brief Banded matrix
+        //!
+        //! Only blocks that intersect with the band (elements (j, i) with j - 'kl' <= i <= j + 'ku') are stored,
+        //! each of which is compressed using fp_stream<BM, BE> (the same as for the general matrix).
+        //! Elements outside the band, but within a stored block, are zero.
+        //! The blocks of block row 'bj' are the consecutive block columns 'block_col_begin[bj]' .. 'block_col_begin[bj] + block_row_ptr[bj + 1] - block_row_ptr[bj] - 1',
+        //! and the blocks of block column 'bi' are the consecutive block rows 'block_row_begin[bi]' .. 'block_row_end[bi] - 1'.
+        //! Memory footprint and the cost of the BLAS operations are proportional to 'max(m, n) * (kl + ku + bs)'.
         //!
         //! \tparam T initial data type before compression
         //! \tparam L data layout/order (any of row major or column major)
         //! \tparam BM number of bits in the exponent
         //! \tparam BE number of bits in the mantissa
-        template <typename T, matrix_layout L = matrix_layout::rowmajor, matrix_type MT = matrix_type::upper_triangular, std::uint32_t BM = ieee754_fp<T>::bm, std::uint32_t BE = ieee754_fp<T>::be>
-        class triangular_matrix : public matrix_base<T, L, BM, BE>
+        template <typename T, matrix_layout L = matrix_layout::rowmajor, std::uint32_t BM = ieee754_fp<T>::bm, std::uint32_t BE = ieee754_fp<T>::be>
+        class banded_matrix : public matrix_base<T, L, BM, BE>
         {
             static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
-            static_assert(MT == matrix_type::upper_triangular || MT == matrix_type::lower_triangular, "error: this should be a triangular matrix");
 
-            using this_class = triangular_matrix<T, L, MT, BM, BE>;
+            using this_class = banded_matrix<T, L, BM, BE>;
             using base_class = matrix_base<T, L, BM, BE>;
 
             static constexpr CBLAS_LAYOUT cblas_layout = (L == matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
 
         public:
 
-            // extent of the matrix: 'n' rows and 'n' columns
+            // extent of the matrix: 'm' rows and 'n' columns
+            using base_class::m;
             using base_class::n;
 
+            // number of sub- and super-diagonals
+            const std::size_t kl;
+            const std::size_t ku;
+
             // data type for the internal floating / fixed point representation
             using fp_type = typename base_class::fp_type;
 
             // (default) block size
-            static constexpr std::size_t bs_default = base_class::bs_default;
-            
+            using base_class::bs_default;
+
         private:
 
             // block size
             using base_class::bs;
 
-            // compresse matrix
+            // compressed matrix: blocks intersecting with the band only
             using base_class::memory;
             using base_class::compressed_data;
 
-            using partition_t = typename base_class::partition_t;
-            using base_class::partition;
+            // block index: block row pointers, first block column of each block row, and offsets of the blocks w.r.t. 'compressed_data'
+            std::vector<std::size_t> block_row_ptr;
+            std::vector<std::size_t> block_col_begin;
+            std::vector<std::size_t> block_offset;
 
-            //! \brief Block offset computation
+            // transposed block index: range of block rows of each block column
+            std::vector<std::size_t> block_row_begin;
+            std::vector<std::size_t> block_row_end;
+
+            // blocks are aligned to the size of 'T' (fixed point blocks start with the scaling factors)
+            static constexpr std::size_t block_alignment = (sizeof(T) + sizeof(fp_type) - 1) / sizeof(fp_type);
+            // the SIMD decoders may read up to one 256-bit word beyond the end of the last block
+            static constexpr std::size_t padding = (32 + sizeof(fp_type) - 1) / sizeof(fp_type);
+
+            //! \brief Range of blocks intersecting with the band
             //!
-            //! get the offset w.r.t. to 0 for the block with Id=(bj, bi)
+            //! Row 'j' holds the band elements 'j - lower' .. 'j + upper' (columns).
+            //! The same applies to columns if 'lower' and 'upper' are swapped.
             //!
-            //! \param bj block id
-            //! \param bi block id
-            //! \return offset w.r.t. to 0
-            std::size_t get_offset(const std::size_t bj, const std::size_t bi) const
+            //! \param j_first first row of the block row
+            //! \param j_last last row of the block row
+            //! \param lower number of sub-diagonals
+            //! \param upper number of super-diagonals
+            //! \param n number of columns
+            //! \param bs block size
+            //! \return first and last + 1 block column
+            static std::array<std::size_t, 2> band_range(const std::size_t j_first, const std::size_t j_last, const std::size_t lower, const std::size_t upper, const std::size_t n, const std::size_t bs)
             {
-                if (MT == matrix_type::upper_triangular)
+                if (j_first > lower && (j_first - lower) >= n) return {{0, 0}};
+
+                const std::size_t i_first = (j_first > lower ? (j_first - lower) : 0);
+                const std::size_t i_last = std::min(n - 1, j_last + std::min(upper, n - 1));
+
+                return {{i_first / bs, i_last / bs + 1}};
+            }
+
+            //! \brief Block id
+            //!
+            //! \param bj block id (row)
+            //! \param bi block id (column)
+            //! \return position of the block within 'block_offset'
+            std::size_t get_block_id(const std::size_t bj, const std::size_t bi) const
+            {
+                return block_row_ptr[bj] + (bi - block_col_begin[bj]);
+            }
+
+            //! \brief Apply a single block
+            //!
+            //! Computes y = alpha * A(T)(block) * x + y.
+            //!
+            //! \tparam Tmat data type to be used for the (intermediate) matrix representation
+            //! \param transpose matrix transposition
+            //! \param id block id
+            //! \param mm number of rows of the block
+            //! \param nn number of columns of the block
+            //! \param alpha scaling factor for the block
+            //! \param x pointer to the input vector
+            //! \param sum_x sum over all elements of 'x' (used with the integer gemv on fixed point blocks only)
+            //! \param y pointer to the output vector
+            template <typename Tmat>
+            void apply_block(const bool transpose, const std::size_t id, const std::size_t mm, const std::size_t nn, const Tmat alpha, const Tmat* x, const Tmat sum_x, Tmat* y) const
+            {
+                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
+
+                const std::size_t k = block_offset[id];
+
+            #if defined(FP_INTEGER_GEMV)
+                if (internal::is_fixed_point_type<BM, BE>::value)
                 {
-                    const std::size_t n_ab_row = (n / bs);
-                    const std::size_t n_c_row = ((n + bs - 1) / bs) - n_ab_row;
-                    const std::size_t n_abc_row = n_ab_row + n_c_row;
-                    const std::size_t n_total = (n_abc_row * (n_abc_row + 1)) / 2;
-                    const std::size_t n_abc = n_total - ((n_abc_row - bj) * ((n_abc_row - bj + 1))) / 2;
-                    const std::size_t n_a = bj + (bi > bj ? 1 : 0);
-                    const std::size_t n_b = n_abc - bj * (1 + n_c_row) + (bi > (bj + 1) ? (bi - (bj + 1)) : 0);
-                    const std::size_t n_c = bj * n_c_row;
-                    
-                    return (n_a * partition.num_elements_a + n_b * partition.num_elements_b + n_c * partition.num_elements_c);
+                    internal::scratch_buffer<Tmat> tmp_y(bs);
+
+                    // extract scaling factors for the current block
+                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
+                    const Tmat rescale_p_3 = fptr[0];
+                    const Tmat rescale_p_4 = fptr[1];
+                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+
+                    // integer gemv
+                    base_class::integer_gemv(transpose, mm, nn, &tmp_a[0], &x[0], &tmp_y[0]);
+                    // ..finalize gemv call: rescaling
+                    const Tmat a = rescale_p_4;
+                    const Tmat b = sum_x * rescale_p_3;
+                    for (std::size_t jj = 0; jj < (transpose ? nn : mm); ++jj)
+                    {
+                        y[jj] += alpha * (tmp_y[jj] * a + b);
+                    }
                 }
                 else
+            #endif
+                // decompress the block on the fly, if the fused kernel is available
+                if (!base_class::try_matrix_vector_fused(transpose, mm, nn, alpha, &compressed_data[k], &x[0], &y[0]))
                 {
-                    const std::size_t n_blocks = (n + bs - 1) / bs;
-                    const std::size_t n_a = bj;
-                    // the computation of 'n_b' and 'n_c' assumes 'num_elements_c != 0'
-                    const std::size_t n_b = (bj * (bj + 1)) / 2 - bj + (bj < (n_blocks - 1) ? bi : 0);
-                    const std::size_t n_c = (bj == (n_blocks - 1) ? bi : 0);
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
 
-                    // fix 'num_elements_c == 0' case
-                    return (n_a * partition.num_elements_a + n_b * partition.num_elements_b + n_c * (partition.num_elements_c != 0 ? partition.num_elements_c : partition.num_elements_b));
+                    // decompress the block
+                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
+
+                    // apply general blas matrix vector multiplication
+                    const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
+                    blas::gemv(cblas_layout, (transpose ? CblasTrans : CblasNoTrans), mm, nn, alpha, &buffer_a[0], lda, &x[0], 1, fmat_1, &y[0], 1);
                 }
             }
 
         public:
 
             // do not create a standard constructor
-            triangular_matrix() = delete;
-            
+            banded_matrix() = delete;
+
             //! \brief Constructor
             //!
-            //! This constructor applies the matrix compression:
-            //! if 'ld_data' is specified and larger than zero, it indicates that we are working on the raw input matrix.
+            //! This constructor applies the matrix compression to a matrix given in BLAS band storage (see gbmv):
+            //! for column major layout, element (j, i) is at position 'data[(ku + j - i) + i * ld_data]',
+            //! and for row major layout, element (j, i) is at position 'data[(kl + i - j) + j * ld_data]'.
             //!
-            //! \param data pointer to the input matrix
-            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
+            //! \param data pointer to the input matrix (band storage)
+            //! \param ld_data leading dimension of the band storage (at least 'kl + ku + 1')
             //! \param extent matrix dimensions
+            //! \param kl number of sub-diagonals
+            //! \param ku number of super-diagonals
             //! \param bs block size
-            triangular_matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+            banded_matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t kl, const std::size_t ku, const std::size_t bs = bs_default)
                 :
-                base_class(data, ld_data, extent, bs)
+                base_class(data, ld_data, extent, bs),
+                kl(kl),
+                ku(ku)
             {
-                // create a compressed matrix with internal storage
-                if (ld_data > 0)
+                if (ld_data < (kl + ku + 1))
                 {
-                    // allocate memory for the compressed matrix
-                    memory.reserve(partition.num_elements);
-                    
-                    // compress the matrix
-                    base_class::template compress<MT>(reinterpret_cast<const T*>(data), ld_data, &memory[0], {n, n}, bs, partition);
-
-                    // set up the internal pointer to the compressed matrix
-                    compressed_data = reinterpret_cast<const fp_type*>(&memory[0]);
+                    std::cerr << "error in banded_matrix<..," << BM << "," << BE << ">::banded_matrix: leading dimension must be at least kl + ku + 1" << std::endl;
+                    throw std::exception();
                 }
-            }
-
 
-            triangular_matrix(const T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
-                :
-                triangular_matrix(data, ld_data, std::array<std::size_t, 1>({extent[0]}), bs)
-            {
-                ;
-            }
+                if (m == 0 || n == 0 || bs == 0) return;
 
-            //! \brief Constructor
-            //!
-            //! \param data vector holding the input matrix
-            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
-            //! \param extent matrix dimensions
-            //! \param bs block size
-            template <std::size_t D>
-            triangular_matrix(const std::vector<T>& data, const std::size_t ld_data, const std::array<std::size_t, D>& extent, const std::size_t bs = bs_default)
-                :
-                triangular_matrix(&data[0], ld_data, extent, bs)
-            {
-                ;
-            }
+                const std::size_t num_block_rows = (m + bs - 1) / bs;
+                const std::size_t num_block_cols = (n + bs - 1) / bs;
 
-            //! \brief Constructor
-            //!
-            //! This constructor allows to bind an externally compressed matrix.
-            //! The internal storage then is not used.
-            //! For 'TT' being equal to 'T' and we cannot conclude that 'data' points to a compressed matrix.
-            //! We thus have to use an additional argument to to control the internal storage usage and data compression.
-            //! 
-            //! \param data pointer to either the compressed or uncompressed input matrix
-            //! \param extent matrix dimensions
-            //! \param bs block size
-            //! \param is_compressed (optional) 'data' points to a compressed matrix or not
-            template <typename TT, std::size_t D, typename X = typename std::enable_if<std::is_same<T, TT>::value>::type>
-            triangular_matrix(const TT* data, const std::array<std::size_t, D>& extent, const std::size_t bs = bs_default, const bool is_compressed = true)
-                :
-                triangular_matrix(data, (is_compressed ? 0 : extent[0]), extent, bs)
-            {
-                if (is_compressed)
+                // create the block index
+                block_row_ptr.assign(num_block_rows + 1, 0);
+                block_col_begin.assign(num_block_rows, 0);
+                std::size_t num_elements = padding;
+                for (std::size_t bj = 0; bj < num_block_rows; ++bj)
                 {
-                    if (std::is_same<TT, fp_type>::value)
+                    const std::size_t j = bj * bs;
+                    const std::size_t mm = std::min(m - j, bs);
+                    const std::array<std::size_t, 2> range = band_range(j, j + mm - 1, kl, ku, n, bs);
+                    block_col_begin[bj] = range[0];
+                    block_row_ptr[bj + 1] = block_row_ptr[bj] + (range[1] - range[0]);
+
+                    for (std::size_t bi = range[0]; bi < range[1]; ++bi)
                     {
-                        // 'data' points to a compressed matrix
-                        compressed_data = reinterpret_cast<const fp_type*>(data);
+                        num_elements += fp_stream<BM, BE>::memory_footprint_elements(mm * std::min(n - bi * bs, bs)) + block_alignment - 1;
                     }
-                    else
+                }
+
+                block_row_begin.assign(num_block_cols, 0);
+                block_row_end.assign(num_block_cols, 0);
+                for (std::size_t bi = 0; bi < num_block_cols; ++bi)
+                {
+                    const std::size_t i = bi * bs;
+                    const std::array<std::size_t, 2> range = band_range(i, i + std::min(n - i, bs) - 1, ku, kl, m, bs);
+                    block_row_begin[bi] = range[0];
+                    block_row_end[bi] = range[1];
+                }
+
+                // allocate memory for the compressed matrix
+                memory.reserve(num_elements);
+                block_offset.reserve(block_row_ptr[num_block_rows]);
+
+                // allocate local memory
+                internal::scratch_buffer<T> buffer(bs * bs);
+
+                for (std::size_t bj = 0; bj < num_block_rows; ++bj)
+                {
+                    for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1]; ++b)
                     {
-                        std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::triangular_matrix: external pointer type does not match fp_type" << std::endl;
+                        // extent of the current block
+                        const std::size_t j = bj * bs;
+                        const std::size_t i = (block_col_begin[bj] + (b - block_row_ptr[bj])) * bs;
+                        const std::size_t mm = std::min(m - j, bs);
+                        const std::size_t nn = std::min(n - i, bs);
+
+                        // copy block into the 'buffer': elements outside the band are zero
+                        const std::size_t ldn = (L == matrix_layout::rowmajor ? nn : mm);
+                        for (std::size_t jj = 0; jj < mm; ++jj)
+                        {
+                            for (std::size_t ii = 0; ii < nn; ++ii)
+                            {
+                                const std::size_t row = j + jj;
+                                const std::size_t col = i + ii;
+                                const bool in_band = ((col + kl) >= row && col <= (row + ku));
+
+                                if (!in_band)
+                                {
+                                    buffer[idx<L>(jj, ii, ldn)] = static_cast<T>(0.0);
+                                }
+                                else if (L == matrix_layout::colmajor)
+                                {
+                                    buffer[idx<L>(jj, ii, ldn)] = data[(ku + row - col) + col * ld_data];
+                                }
+                                else
+                                {
+                                    buffer[idx<L>(jj, ii, ldn)] = data[(kl + col - row) + row * ld_data];
+                                }
+                            }
+                        }
+
+                        // the new block goes behind the last one
+                        const std::size_t offset = (block_offset.empty() ? 0 : ((memory.size() - padding + block_alignment - 1) / block_alignment) * block_alignment);
+                        memory.resize(offset + fp_stream<BM, BE>::memory_footprint_elements(mm * nn) + padding);
+                        fp_stream<BM, BE>::compress(&buffer[0], &memory[offset], mm * nn);
+                        block_offset.push_back(offset);
                     }
                 }
+
+                // set up the internal pointer to the compressed matrix
+                compressed_data = memory.data();
             }
 
             //! \brief Constructor
             //!
-            //! This constructor allows to bind an externally compressed matrix.
-            //! The internal storage then is not used.
-            //! This constructor complements the above one for 'T' not being equal to 'TT'.
-            //! In this case 'data' is assumed to point to an externally compressed matrix.
-            //! 
-            //! \param data pointer to the compressed input matrix
+            //! \param data vector holding the input matrix (band storage)
+            //! \param ld_data leading dimension of the band storage (at least 'kl + ku + 1')
             //! \param extent matrix dimensions
+            //! \param kl number of sub-diagonals
+            //! \param ku number of super-diagonals
             //! \param bs block size
-            template <typename TT, std::size_t D, typename X = typename std::enable_if<!std::is_same<T, TT>::value>::type>
-            triangular_matrix(const TT* data, const std::array<std::size_t, D>& extent, const std::size_t bs = bs_default)
+            banded_matrix(const std::vector<T>& data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t kl, const std::size_t ku, const std::size_t bs = bs_default)
                 :
-                triangular_matrix(reinterpret_cast<const T*>(data), 0, extent, bs)
+                banded_matrix(&data[0], ld_data, extent, kl, ku, bs)
             {
-                // 'data' points to a compressed matrix: base class constructor makes sure that 'data' is not NULL
-                compressed_data = reinterpret_cast<const fp_type*>(data);
+                ;
             }
 
-            //! \brief Move constructor 
-            triangular_matrix(triangular_matrix&& rhs) = default;
+            //! \brief Move constructor
+            banded_matrix(banded_matrix&& rhs) = default;
 
             //! \brief Destructor
-            virtual ~triangular_matrix() 
-            { 
-                compressed_data = nullptr; 
+            virtual ~banded_matrix()
+            {
+                compressed_data = nullptr;
             }
 
-            //! \brief (External) matrix compression
+            //! \brief Decompress this matrix
             //!
-            //! This method can be used without object creation.
+            //! The output is a dense matrix: elements outside the band are filled with zeros.
             //!
-            //! \param data pointer to the input matrix
-            //! \param ld_data leading dimension of the memory allocation that is behind the input matrix
-            //! \param compressed_data pointer to the compressed matrix
-            //! \param extent matrix dimensions
-            //! \param bs (optional) block size
-            static ptrdiff_t compress(const T* data, const std::size_t ld_data, fp_type* compressed_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            //! \param data pointer to the (decompressed) output matrix
+            //! \param ld_data (optional) leading dimension of the memory allocation that is behind the output matrix
+            ptrdiff_t decompress(T* data, const std::size_t ld_data = 0) const
             {
-                if (data == nullptr || compressed_data == nullptr)
+                if (data == nullptr)
                 {
-                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::compress: any of the pointers is a nullptr" << std::endl;
+                    std::cerr << "error in banded_matrix<..," << BM << "," << BE << ">::decompress: pointers is a nullptr" << std::endl;
                     return 0;
                 }
-                
-                const std::size_t m = extent[0];
-                const std::size_t n = extent[1];
+
                 if (m == 0 || n == 0 || bs == 0) return 0;
-                
-                const partition_t partition  = base_class::template make_partition<MT>(extent, bs);
-                return base_class::template compress<MT>(data, ld_data, compressed_data, extent, bs, partition);
-            }
 
-            //! \brief (External) matrix decompression
-            //!
-            //! This method can be used without object creation.
-            //!
-            //! \param compressed_data pointer to the compressed matrix
-            //! \param data pointer to the (decompressed) output matrix
-            //! \param ld_data leading dimension of the memory allocation that is behind the output matrix
-            //! \param extent matrix dimensions
-            //! \param bs (optional) block size
-            static ptrdiff_t decompress(const fp_type* compressed_data, T* data, const std::size_t ld_data, const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
-            {
-                if (data == nullptr || compressed_data == nullptr)
+                // if 'ld_data' is not speficied, deduce it from the matrix dimensions
+                const std::size_t ld = (ld_data == 0 ? (L == matrix_layout::rowmajor ? n : m) : ld_data);
+                for (std::size_t j = 0; j < m; ++j)
                 {
-                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::decompress: any of the pointers is a nullptr" << std::endl;
-                    return 0;
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        data[idx<L>(j, i, ld)] = static_cast<T>(0.0);
+                    }
                 }
 
-                const std::size_t m = extent[0];
-                const std::size_t n = extent[1];
-                if (m == 0 || n == 0 || bs == 0) return 0;
-                
-                const partition_t partition = base_class::template make_partition<MT>(extent, bs);
-                return base_class::template decompress<MT>(compressed_data, data, ld_data, extent, bs, partition);
-            }
+                internal::scratch_buffer<T> buffer(bs * bs);
 
-            static ptrdiff_t compress(const T* data, const std::size_t ld_data, fp_type* compressed_data, const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
-            {
-                return compress(data, ld_data, compressed_data, {extent[0], extent[0]}, bs);
-            }
+                for (std::size_t bj = 0; bj < block_col_begin.size(); ++bj)
+                {
+                    for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1]; ++b)
+                    {
+                        const std::size_t j = bj * bs;
+                        const std::size_t i = (block_col_begin[bj] + (b - block_row_ptr[bj])) * bs;
+                        const std::size_t mm = std::min(m - j, bs);
+                        const std::size_t nn = std::min(n - i, bs);
 
-            static ptrdiff_t decompress(const fp_type* compressed_data, T* data, const std::size_t ld_data, const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
-            {
-                return decompress(compressed_data, data, ld_data, {extent[0], extent[0]}, bs);
+                        fp_stream<BM, BE>::decompress(&compressed_data[block_offset[b]], &buffer[0], mm * nn);
+
+                        const std::size_t ldn = (L == matrix_layout::rowmajor ? nn : mm);
+                        for (std::size_t jj = 0; jj < mm; ++jj)
+                        {
+                            for (std::size_t ii = 0; ii < nn; ++ii)
+                            {
+                                data[idx<L>(j + jj, i + ii, ld)] = buffer[idx<L>(jj, ii, ldn)];
+                            }
+                        }
+                    }
+                }
+
+                return memory.size();
             }
 
-            //! \brief Decompress this matrix
+            //! \brief Access a compressed block
             //!
-            //! \param data pointer to the (decompressed) output matrix
-            //! \param ld_data (optional) leading dimension of the memory allocation that is behind the output matrix
-            ptrdiff_t decompress(T* data, const std::size_t ld_data = 0) const
+            //! See the general matrix.
+            //!
+            //! \param bj block id (row)
+            //! \param bi block id (column)
+            //! \return pointer to the compressed block, or nullptr if the block does not exist or does not intersect with the band
+            const fp_type* get_block(const std::size_t bj, const std::size_t bi) const
             {
-                if (data == nullptr)
+                if (bj >= ((m + bs - 1) / bs) || bi >= ((n + bs - 1) / bs))
                 {
-                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::decompress: pointers is a nullptr" << std::endl;
-                    return 0;
+                    std::cerr << "error in banded_matrix<..," << BM << "," << BE << ">::get_block: block (" << bj << "," << bi << ") does not exist" << std::endl;
+                    return nullptr;
                 }
 
-                // if 'ld_data' is not speficied, deduce it from the matrix dimensions
-                return base_class::template decompress<MT>(compressed_data, data, (ld_data == 0 ? n : ld_data), {n, n}, bs, partition);
-            }
+                if (bi < block_col_begin[bj] || get_block_id(bj, bi) >= block_row_ptr[bj + 1]) return nullptr;
 
-            //! \brief Determine the number of elements needed to store the compressed matrix
-            //!
-            //! \param extent matrix dimensions
-            //! \param bs (optional) block size
-            //! return number of elements of type 'fp_type'
-            static std::size_t memory_footprint_elements(const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
-            {
-                const std::size_t m = extent[0];
-                const std::size_t n = extent[1];
-                if (m == 0 || n == 0 || bs == 0) return 0;
-                
-                return (base_class::template make_partition<MT>(extent, bs)).num_elements;
+                return &compressed_data[block_offset[get_block_id(bj, bi)]];
             }
 
-            static std::size_t memory_footprint_elements(const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+            //! return the number of blocks intersecting with the band
+            std::size_t num_blocks() const
             {
-                return memory_footprint_elements({extent[0], extent[0]}, bs);
+                return block_offset.size();
             }
 
-            //! \brief Determine the number of bytes needed to store the compressed matrix
-            //!
-            //! \param extent matrix dimensions
-            //! \param bs (optional) block size
-            //! return number of bytes
-            static std::size_t memory_footprint_bytes(const std::array<std::size_t, 2>& extent, const std::size_t bs = bs_default)
+            //! return number of elements of type 'fp_type' used for the compressed blocks
+            std::size_t memory_footprint_elements() const
             {
-                return memory_footprint_elements(extent, bs) * sizeof(fp_type);
+                return memory.size();
             }
 
-            static std::size_t memory_footprint_bytes(const std::array<std::size_t, 1>& extent, const std::size_t bs = bs_default)
+            //! return number of bytes used for the compressed blocks and the block index
+            virtual std::size_t memory_footprint_bytes() const
             {
-                return memory_footprint_bytes({extent[0], extent[0]}, bs);
+                return memory.size() * sizeof(fp_type) + (block_row_ptr.size() + block_col_begin.size() + block_offset.size()
+                    + block_row_begin.size() + block_row_end.size()) * sizeof(std::size_t);
             }
 
-            using base_class::memory_footprint_elements;
-            using base_class::memory_footprint_bytes;
-
-            //! \brief Triangular (packed) matrix vector multiply
+            //! \brief General (banded) matrix vector multiply
             //!
             //! Computes y = alpha * A(T) * x + beta * y.
             //!
+            //! With the parallel execution policy, the block rows (no transposition) or block columns (transposition)
+            //! are distributed across the threads of an OpenMP team in contiguous ranges, so that each thread writes to a separate chunk of 'y'.
+            //!
             //! \tparam Tmat data type to be used for the (intermediate) matrix representation
             //! \tparam Tvec data type of the input and output vectors
             //! \param transpose matrix transposition
@@ -1309,46 +5914,38 @@ namespace FP_NAMESPACE
             //! \param x pointer to the input vector
             //! \param beta scaling factor for the output vector
             //! \param y pointer to the output vector
+            //! \param policy (optional) sequential or parallel execution
             template <typename Tmat = T, typename Tvec = T>
-            void matrix_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
+            void matrix_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y, const execution_policy policy = execution_policy::sequential) const
             {
                 static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
                 static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
 
                 if (x == nullptr || y == nullptr)
                 {
-                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::matrix_vector: any of the pointers is a nullptr" << std::endl;
+                    std::cerr << "error in banded_matrix<..," << BM << "," << BE << ">::matrix_vector: any of the pointers is a nullptr" << std::endl;
                     return;
                 }
 
-                if (n == 0) return;
-                
+                if (m == 0 || n == 0) return;
+
                 // some constants
                 static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
-                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
 
                 // the kernel uses 'Tmat' for internal data representation
                 base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
-                { 
-                    // allocate local memory
-                    alignas(alignment) Tmat buffer_a[bs * bs];
-                    alignas(alignment) Tmat buffer_y[bs];
-                    
+                {
                 #if defined(FP_INTEGER_GEMV)
                     // the matrix vector multiplication happens directly on the
-                    // integer (fixed point) representation of the matrix
-                    alignas(alignment) Tmat tmp_y[bs];
-                    std::vector<Tmat> rescale_p_2(0);
+                    // integer (fixed point) representation of the matrix (see the general matrix)
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? (transpose ? m : n) / bs + 1 : 0);
                     if (internal::is_fixed_point_type<BM, BE>::value)
                     {
-                        // the transformation between the fixed and floating point representation
-                        // contains an additive factor which is multiplied with the input vector:
-                        // we have to account for this by summing up chunks of the vector according to the partitioning
-                        rescale_p_2.reserve(n / bs + 1);
-                        for (std::size_t i = 0, k = 0; i < n; i += bs, ++k)
+                        const std::size_t mn = (transpose ? m : n);
+                        for (std::size_t i = 0, k = 0; i < mn; i += bs, ++k)
                         {
                             rescale_p_2[k] = fmat_0;
-                            const std::size_t ii_max = std::min(n - i, bs);
+                            const std::size_t ii_max = std::min(mn - i, bs);
                             for (std::size_t ii = 0; ii < ii_max; ++ii)
                             {
                                 rescale_p_2[k] += x[i + ii];
@@ -1356,271 +5953,178 @@ namespace FP_NAMESPACE
                         }
                     }
                 #endif
-                    
-                    for (std::size_t j = 0, k = 0; j < n; j += bs)
-                    {
-                        const std::size_t i_start = (MT == matrix_type::upper_triangular ? j : 0);
-                        const std::size_t i_end = (MT == matrix_type::upper_triangular ? n : (j + 1));
-
-                        for (std::size_t i = i_start; i < i_end; i += bs)
-                        {
-                            const std::size_t mm = std::min(n - j, bs);
-                            const std::size_t nn = std::min(n - i, bs);
 
-                            // skip diagonal blocks
-                            if (i == j)
-                            {
-                                // decompress the 'buffer'
-                                fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], (nn * (nn + 1)) / 2);    
-                                
-                                // prepare call to tpmv
-                                for (std::size_t jj = 0; jj < nn; ++jj)
-                                {
-                                    buffer_y[jj] = x[j + jj];
-                                }
+                    const std::size_t num_block_rows = (m + bs - 1) / bs;
+                    const std::size_t num_block_cols = (n + bs - 1) / bs;
 
-                                // apply triangular matrix vector multiply
-                                blas::tpmv(cblas_layout, (MT == matrix_type::upper_triangular ? CblasUpper : CblasLower), (transpose ? CblasTrans : CblasNoTrans), CblasNonUnit, nn, &buffer_a[0], &buffer_y[0], 1);
+                    // parallel execution: each thread processes a range of block rows (no transposition) or block columns (transposition)
+                    // sequential execution: blocks are processed in the order they are stored
+                    const bool use_threads = (policy == execution_policy::parallel && (transpose ? num_block_cols : num_block_rows) > 1);
+                    const bool by_block_cols = (use_threads && transpose);
+                    const std::size_t num_outer = (by_block_cols ? num_block_cols : num_block_rows);
 
-                                // scale by 'alpha'
-                                for (std::size_t jj = 0; jj < nn; ++jj)
-                                {
-                                    y[j + jj] += alpha * buffer_y[jj];
-                                }
+                    // apply blocks within the range [outer_begin, outer_end) to 'x' and add the result to 'y'
+                    auto apply_blocks = [&](const std::size_t outer_begin, const std::size_t outer_end)
+                    {
+                        for (std::size_t b_outer = outer_begin; b_outer < outer_end; ++b_outer)
+                        {
+                            const std::size_t inner_begin = (by_block_cols ? block_row_begin[b_outer] : block_col_begin[b_outer]);
+                            const std::size_t inner_end = (by_block_cols ? block_row_end[b_outer] : block_col_begin[b_outer] + (block_row_ptr[b_outer + 1] - block_row_ptr[b_outer]));
 
-                                // move to the next block
-                                k += partition.num_elements_a;
-                            }
-                            else
+                            for (std::size_t b_inner = inner_begin; b_inner < inner_end; ++b_inner)
                             {
-                            #if defined(FP_INTEGER_GEMV)
-                                if (internal::is_fixed_point_type<BM, BE>::value)
-                                {
-                                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
-                                    const Tmat rescale_p_3 = fptr[0];
-                                    const Tmat rescale_p_4 = fptr[1];
-                                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
+                                const std::size_t bj = (by_block_cols ? b_inner : b_outer);
+                                const std::size_t bi = (by_block_cols ? b_outer : b_inner);
+                                const std::size_t j = bj * bs;
+                                const std::size_t i = bi * bs;
+                                const std::size_t mm = std::min(m - j, bs);
+                                const std::size_t nn = std::min(n - i, bs);
+                                const std::size_t src_idx = (transpose ? j : i);
+                                const std::size_t dst_idx = (transpose ? i : j);
 
-                                    // move to the next block
-                                    const std::size_t ij = (MT == matrix_type::upper_triangular ? i : j);
-                                    k += ((n - ij) < bs ? partition.num_elements_c : partition.num_elements_b);
-                                    
-                                    // integer gemv
-                                    const std::size_t src_idx = (transpose ? j : i);
-                                    const std::size_t dst_idx = (transpose ? i : j);
-                                    blas::gemv(L, transpose, mm, nn, &tmp_a[0], &x[src_idx], &tmp_y[0]);
-                                    // ..finalize gemv call: rescaling
-                                    const Tmat a = rescale_p_4;
-                                    const Tmat b = rescale_p_2[src_idx / bs] * rescale_p_3;
-                                    for (std::size_t jj = 0; jj < (transpose ? nn : mm); ++jj)
-                                    {
-                                        y[dst_idx + jj] += alpha * (tmp_y[jj] * a + b);
-                                    }
-                                }
-                                else                            
+                            #if defined(FP_INTEGER_GEMV)
+                                const Tmat sum_x = (internal::is_fixed_point_type<BM, BE>::value ? rescale_p_2[src_idx / bs] : fmat_0);
+                            #else
+                                const Tmat sum_x = fmat_0;
                             #endif
-                                {
-                                    // decompress the 'buffer'
-                                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
-
-                                    // move to the next block
-                                    const std::size_t ij = (MT == matrix_type::upper_triangular ? i : j);
-                                    k += ((n - ij) < bs ? partition.num_elements_c : partition.num_elements_b);
 
-                                    // apply blas matrix vector multiplication
-                                    const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
-                                    const std::size_t src_idx = (transpose ? j : i);
-                                    const std::size_t dst_idx = (transpose ? i : j);
-                                    blas::gemv(cblas_layout, (transpose ? CblasTrans : CblasNoTrans), mm, nn, alpha, &buffer_a[0], lda, &x[src_idx], 1, fmat_1, &y[dst_idx], 1);
-                                }
+                                apply_block(transpose, get_block_id(bj, bi), mm, nn, alpha, &x[src_idx], sum_x, &y[dst_idx]);
                             }
                         }
+                    };
+
+                    if (use_threads)
+                    {
+                        #pragma omp parallel
+                        {
+                            // contiguous ranges of block rows / columns: all of them hold about the same number of blocks
+                            const std::size_t thread_id = omp_get_thread_num();
+                            const std::size_t num_threads = omp_get_num_threads();
+                            apply_blocks((thread_id * num_outer) / num_threads, ((thread_id + 1) * num_outer) / num_threads);
+                        }
+                    }
+                    else
+                    {
+                        apply_blocks(0, num_outer);
                     }
                 }, transpose, alpha, x, beta, y);
             }
 
-        #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
-            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y) const                               \
-            {                                                                                                                                                               \
-                matrix_vector_kernel(transpose, alpha, x, beta, y);                                                                                                         \
-            }                                                                                                                                                               \
-                                                                                                                                                                            \
-            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y) const     \
-            {                                                                                                                                                               \
-                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0]);                                                                                                 \
-            }                                                                                                                                                               \
-
-            MACRO_MATRIX_VECTOR(double, double);
-            MACRO_MATRIX_VECTOR(double, float);
-            MACRO_MATRIX_VECTOR(float, double);
-            MACRO_MATRIX_VECTOR(float, float);
-
-        #undef MACRO_MATRIX_VECTOR
-
-            template <typename Tmat = T, typename Tvec = T>
-            void tpmv(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
-            {
-                matrix_vector(transpose, alpha, x, beta, y);
-            }
-
-            template <typename Tmat = T, typename Tvec = T>
-            void tpmv(const bool transpose, const Tmat alpha, const std::vector<Tvec>& x, const Tvec beta, std::vector<Tvec>& y) const
-            {
-                matrix_vector(transpose, alpha, &x[0], beta, &y[0]);
-            }
-
-            //! \brief Triangular (packed) symmetric matrix vector multiply
+            //! \brief General (banded) matrix multi-vector multiply
             //!
-            //! Computes y = alpha * A(T) * x + beta * y.
+            //! Computes Y = alpha * A(T) * X + beta * Y for 'k' vectors (see the general matrix).
             //!
             //! \tparam Tmat data type to be used for the (intermediate) matrix representation
             //! \tparam Tvec data type of the input and output vectors
+            //! \param transpose matrix transposition
             //! \param alpha scaling factor for the matrix
-            //! \param x pointer to the input vector
-            //! \param beta scaling factor for the output vector
-            //! \param y pointer to the output vector
+            //! \param x pointer to the input vectors
+            //! \param ldx leading dimension of 'x'
+            //! \param k number of vectors
+            //! \param beta scaling factor for the output vectors
+            //! \param y pointer to the output vectors
+            //! \param ldy leading dimension of 'y'
             template <typename Tmat = T, typename Tvec = T>
-            void symmetric_matrix_vector(const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
+            void matrix_multi_vector_kernel(const bool transpose, const Tmat alpha, const Tvec* x, const std::size_t ldx, const std::size_t k, const Tvec beta, Tvec* y, const std::size_t ldy) const
             {
                 static_assert(std::is_same<Tmat, double>::value || std::is_same<Tmat, float>::value, "error: only 'double' or 'float' are allowed");
                 static_assert(std::is_same<Tvec, double>::value || std::is_same<Tvec, float>::value, "error: only 'double' or 'float' are allowed");
 
                 if (x == nullptr || y == nullptr)
                 {
-                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::symmetric_matrix_vector: any of the pointers is a nullptr" << std::endl;
+                    std::cerr << "error in banded_matrix<..," << BM << "," << BE << ">::matrix_multi_vector: any of the pointers is a nullptr" << std::endl;
                     return;
                 }
 
-                if (n == 0) return;
+                if (m == 0 || n == 0 || k == 0) return;
 
                 // some constants
                 static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
-                static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
-                
+
                 // the kernel uses 'Tmat' for internal data representation
-                base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
+                base_class::multi_vector_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, const std::size_t ldx, const std::size_t k, Tmat* y, const std::size_t ldy)
                 {
                     // allocate local memory
-                    alignas(alignment) Tmat buffer_a[bs * bs];
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
 
                 #if defined(FP_INTEGER_GEMV)
-                    // the matrix vector multiplication happens directly on the
-                    // integer (fixed point) representation of the matrix
-                    alignas(alignment) Tmat tmp_y[2 * bs];
-                    std::vector<T> rescale_p_2(0);
+                    // the matrix multi-vector multiplication happens directly on the
+                    // integer (fixed point) representation of the matrix (see the general matrix)
+                    const std::size_t num_chunks = ((transpose ? m : n) + bs - 1) / bs;
+                    internal::scratch_buffer<Tmat> tmp_y(internal::is_fixed_point_type<BM, BE>::value ? bs * k : 0);
+                    internal::scratch_buffer<Tmat> rescale_p_2(internal::is_fixed_point_type<BM, BE>::value ? num_chunks * k : 0);
                     if (internal::is_fixed_point_type<BM, BE>::value)
                     {
-                        // the transformation between the fixed and floating point representation
-                        // contains an additive factor which is multiplied with the input vector:
-                        // we have to account for this by summing up chunks of the vector according to the partitioning
-                        rescale_p_2.reserve(n / bs + 1);
-                        for (std::size_t i = 0, k = 0; i < n; i += bs, ++k)
+                        const std::size_t mn = (transpose ? m : n);
+                        for (std::size_t c = 0; c < k; ++c)
                         {
-                            rescale_p_2[k] = fmat_0;
-                            const std::size_t ii_max = std::min(n - i, bs);
-                            for (std::size_t ii = 0; ii < ii_max; ++ii)
+                            for (std::size_t i = 0, kk = 0; i < mn; i += bs, ++kk)
                             {
-                                rescale_p_2[k] += x[i + ii];
+                                rescale_p_2[c * num_chunks + kk] = fmat_0;
+                                const std::size_t ii_max = std::min(mn - i, bs);
+                                for (std::size_t ii = 0; ii < ii_max; ++ii)
+                                {
+                                    rescale_p_2[c * num_chunks + kk] += x[c * ldx + i + ii];
+                                }
                             }
                         }
                     }
                 #endif
 
-                    // apply symmetric matrix
-                    for (std::size_t j = 0, k = 0; j < n; j += bs)
+                    // apply matrix to 'x' and add the result to 'y'
+                    for (std::size_t bj = 0; bj < block_col_begin.size(); ++bj)
                     {
-                        const std::size_t i_start = (MT == matrix_type::upper_triangular ? j : 0);
-                        const std::size_t i_end = (MT == matrix_type::upper_triangular ? n : (j + 1));
-
-                        for (std::size_t i = i_start; i < i_end; i += bs)
+                        for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1]; ++b)
                         {
-                            const std::size_t mm = std::min(n - j, bs);
+                            const std::size_t j = bj * bs;
+                            const std::size_t i = (block_col_begin[bj] + (b - block_row_ptr[bj])) * bs;
+                            const std::size_t offset = block_offset[b];
+                            const std::size_t mm = std::min(m - j, bs);
                             const std::size_t nn = std::min(n - i, bs);
+                            const std::size_t src_idx = (transpose ? j : i);
+                            const std::size_t dst_idx = (transpose ? i : j);
 
-                            // diagonal blocks
-                            if (i == j)
+                        #if defined(FP_INTEGER_GEMV)
+                            if (internal::is_fixed_point_type<BM, BE>::value)
                             {
-                                // decompress the 'buffer'
-                                fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], (nn * (nn + 1)) / 2);
+                                // extract scaling factors for the current block
+                                const float* fptr = reinterpret_cast<const float*>(&compressed_data[offset]);
+                                const Tmat rescale_p_3 = fptr[0];
+                                const Tmat rescale_p_4 = fptr[1];
+                                const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
 
-                                // move on to the next block
-                                k += partition.num_elements_a;
-                                
-                                // apply symmetric matrix vector multiply
-                                blas::spmv(cblas_layout, (MT == matrix_type::upper_triangular ? CblasUpper : CblasLower), nn, alpha, &buffer_a[0], &x[i], 1, fmat_1, &y[i], 1);
-                            }
-                            // non-diagonal blocks
-                            else
-                            {
-                            #if defined(FP_INTEGER_GEMV)
-                                if (internal::is_fixed_point_type<BM, BE>::value)
+                                // integer gemm
+                                base_class::integer_gemm(transpose, mm, nn, k, &tmp_a[0], &x[src_idx], ldx, &tmp_y[0], bs);
+                                // ..finalize gemm call: rescaling
+                                const Tmat a = rescale_p_4;
+                                for (std::size_t c = 0; c < k; ++c)
                                 {
-                                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
-                                    const Tmat rescale_p_3 = fptr[0];
-                                    const Tmat rescale_p_4 = fptr[1];
-                                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
-
-                                    // move to the next block
-                                    const std::size_t ij = (MT == matrix_type::upper_triangular ? i : j);
-                                    k += ((n - ij) < bs ? partition.num_elements_c : partition.num_elements_b);
-                                    
-                                    // integer gem2v call
-                                    blas::gem2v(L, mm, nn, &tmp_a[0], &x[i], &tmp_y[0], &x[j], &tmp_y[bs]);
-                                    // ..finalize gem2v call: rescaling
-                                    const Tmat a = rescale_p_4;
-                                    const Tmat b = rescale_p_2[i / bs] * rescale_p_3;
-                                    for (std::size_t jj = 0; jj < mm; ++jj)
-                                    {
-                                        y[j + jj] += alpha * (tmp_y[jj] * a + b);
-                                    }
-                                    const T c = rescale_p_2[j / bs] * rescale_p_3;
-                                    for (std::size_t ii = 0; ii < nn; ++ii)
+                                    const Tmat b = rescale_p_2[c * num_chunks + src_idx / bs] * rescale_p_3;
+                                    for (std::size_t jj = 0; jj < (transpose ? nn : mm); ++jj)
                                     {
-                                        y[i + ii] += alpha * (tmp_y[bs + ii] * a + c);
+                                        y[c * ldy + dst_idx + jj] += alpha * (tmp_y[c * bs + jj] * a + b);
                                     }
                                 }
-                                else                            
-                            #endif
-                                {
-                                    // decompress the 'buffer'
-                                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
+                            }
+                            else
+                        #endif
+                            {
+                                // decompress the block once for all vectors
+                                fp_stream<BM, BE>::decompress(&compressed_data[offset], &buffer_a[0], mm * nn);
 
-                                    // move on to the next block
-                                    const std::size_t ij = (MT == matrix_type::upper_triangular ? i : j);
-                                    k += ((n - ij) < bs ? partition.num_elements_c : partition.num_elements_b);
-                                    
-                                    // apply general matrix vector multiplication
-                                    const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
-                                    blas::gemv(cblas_layout, CblasNoTrans, mm, nn, alpha, &buffer_a[0], lda, &x[i], 1, fmat_1, &y[j], 1);
-                                    blas::gemv(cblas_layout, CblasTrans, mm, nn, alpha, &buffer_a[0], lda, &x[j], 1, fmat_1, &y[i], 1);
-                                }
+                                // apply the block to all vectors
+                                base_class::matrix_multi_vector_block(transpose, mm, nn, k, alpha, &buffer_a[0], &x[src_idx], ldx, &y[dst_idx], ldy);
                             }
                         }
                     }
-                }, false, alpha, x, beta, y);
-            }
-
-            template <typename Tmat = T, typename Tvec = T>
-            void symmetric_matrix_vector(const Tmat alpha, const std::vector<Tvec>& x, const Tvec beta, std::vector<Tvec>& y) const
-            {
-                symmetric_matrix_vector(alpha, &x[0], beta, &y[0]);
-            }
-
-            template <typename Tmat = T, typename Tvec = T>
-            void spmv(const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
-            {
-                symmetric_matrix_vector(alpha, x, beta, y);
-            }
-
-            template <typename Tmat = T, typename Tvec = T>
-            void spmv(const Tmat alpha, const std::vector<Tvec>& x, const Tvec beta, std::vector<Tvec>& y) const
-            {
-                symmetric_matrix_vector(alpha, &x[0], beta, &y[0]);
+                }, transpose, alpha, x, ldx, k, beta, y, ldy);
             }
 
-            //! \brief Triangular solve 
+            //! \brief Triangular (banded) solve
             //!
-            //! Solves for y = alpha * A(T) * x.
+            //! Solves for y = alpha * A(T) * x, where A is a square upper ('kl = 0') or lower ('ku = 0') triangular banded matrix.
+            //! Each block row (no transposition) or block column (transposition) receives contributions from the
+            //! (at most '(kl + ku) / bs + 1') already solved blocks within the band, before its diagonal block is solved.
             //!
             //! \tparam Tmat data type to be used for the (intermediate) matrix representation
             //! \tparam Tvec data type of the input and output vectors
@@ -1636,7 +6140,13 @@ namespace FP_NAMESPACE
 
                 if (x == nullptr || y == nullptr)
                 {
-                    std::cerr << "error in triangular_matrix<..," << BM << "," << BE << ">::solve: any of the pointers is a nullptr" << std::endl;
+                    std::cerr << "error in banded_matrix<..," << BM << "," << BE << ">::triangular_solve: any of the pointers is a nullptr" << std::endl;
+                    return;
+                }
+
+                if (m != n || (kl != 0 && ku != 0))
+                {
+                    std::cerr << "error in banded_matrix<..," << BM << "," << BE << ">::triangular_solve: the matrix is not square and triangular (kl = 0 or ku = 0)" << std::endl;
                     return;
                 }
 
@@ -1646,195 +6156,65 @@ namespace FP_NAMESPACE
                 static constexpr Tmat fmat_0 = static_cast<Tmat>(0.0);
                 static constexpr Tmat fmat_1 = static_cast<Tmat>(1.0);
                 static constexpr Tvec fvec_0 = static_cast<Tvec>(0.0);
-                
+
                 // the kernel uses 'Tmat' for internal data representation
                 base_class::blas2_frame([&](const bool transpose, const Tmat alpha, const Tmat* x, Tmat* y)
                 {
-                    // allocate local memory
-                    alignas(alignment) Tmat buffer_a[bs * bs];
-                    alignas(alignment) Tmat buffer_x[bs];
+                    // forward substitution for (transposed) lower triangular matrices, backward substitution otherwise
+                    const bool upper = (kl == 0);
+                    const bool forward = (transpose ? upper : !upper);
+                    const std::size_t num_blocks = (n + bs - 1) / bs;
 
-                #if defined(FP_INTEGER_GEMV)
-                    alignas(alignment) Tmat tmp_x[bs];
-                    alignas(alignment) fp_type tmp_y[bs];
-                #endif
+                    // allocate local memory
+                    internal::scratch_buffer<Tmat> buffer_a(bs * bs);
+                    internal::scratch_buffer<Tmat> buffer_x(bs);
 
-                    if ((transpose && MT == matrix_type::upper_triangular) ||
-                        (!transpose && MT == matrix_type::lower_triangular))
+                    for (std::size_t b = 0; b < num_blocks; ++b)
                     {
-                        const std::size_t n_blocks = (n + bs - 1) / bs;
-                        for (std::size_t bj = 0; bj < n_blocks; ++bj)
+                        const std::size_t bj = (forward ? b : (num_blocks - 1 - b));
+                        const std::size_t mm = std::min(n - bj * bs, bs);
+                        for (std::size_t jj = 0; jj < mm; ++jj)
                         {
-                            const std::size_t mm = std::min(n - bj * bs, bs);
-                            for (std::size_t jj = 0; jj < bs; ++jj)
-                            {
-                                buffer_x[jj] = fmat_0;
-                            }
-
-                            for (std::size_t bi = 0; bi < bj; ++bi)
-                            {
-                                const std::size_t nn = std::min(n - bi * bs, bs);
-
-                                // apply general matrix vector multiplication
-                            #if defined(FP_INTEGER_GEMV)
-                                if (internal::is_fixed_point_type<BM, BE>::value)
-                                {
-                                    const std::size_t k = (transpose ? get_offset(bi, bj) : get_offset(bj, bi));
-                                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
-                                    const Tmat rescale_p_3 = fptr[0];
-                                    const Tmat rescale_p_4 = fptr[1];
-                                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
-                                    
-                                    // integer gemv
-                                    T rescale_dummy, rescale_p_1, rescale_p_2;
-                                    rescale_p_1 = fmat_1;
-                                    rescale_p_2 = fmat_0;
-                                    for (std::size_t ii = 0; ii < nn; ++ii)
-                                    {
-                                        rescale_p_2 += y[bi * bs + ii];
-                                    }
-                                    if (transpose)
-                                    {
-                                        blas::gemv(L, true, nn, mm, &tmp_a[0], &y[bi * bs], &tmp_x[0]);
-                                    }
-                                    else
-                                    {
-                                        blas::gemv(L, false, mm, nn, &tmp_a[0], &y[bi * bs], &tmp_x[0]);
-                                    }
-                                    // ..finalize gemv call: rescaling
-                                    const Tmat a = rescale_p_4;
-                                    const Tmat b = rescale_p_2 * rescale_p_3;
-                                    for (std::size_t ii = 0; ii < mm; ++ii)
-                                    {
-                                        buffer_x[ii] += (tmp_x[ii] * a + b);
-                                    }
-                                }
-                                else                            
-                            #endif
-                                {
-                                    // decompress the 'buffer'
-                                    const std::size_t k = (transpose ? get_offset(bi, bj) : get_offset(bj, bi));
-                                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
-
-                                    if (transpose)
-                                    {
-                                        const std::size_t lda = (L == matrix_layout::rowmajor ? mm : nn);
-                                        blas::gemv(cblas_layout, CblasTrans, nn, mm, fmat_1, &buffer_a[0], lda, &y[bi * bs], 1, fmat_1, &buffer_x[0], 1);
-                                    }
-                                    else
-                                    {
-                                        const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
-                                        blas::gemv(cblas_layout, CblasNoTrans, mm, nn, fmat_1, &buffer_a[0], lda, &y[bi * bs], 1, fmat_1, &buffer_x[0], 1);
-                                    }
-                                }
-                            }
-
-                            for (std::size_t jj = 0; jj < mm; ++jj)
-                            {
-                                y[bj * bs + jj] = x[bj * bs + jj] - buffer_x[jj];
-                            }
-
-                            // decompress the 'buffer'
-                            const std::size_t k = get_offset(bj, bj);
-                            fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], (mm * (mm + 1)) / 2);
-
-                            // apply triangular solve 
-                            blas::tpsv(cblas_layout, (MT == matrix_type::upper_triangular ? CblasUpper : CblasLower), (transpose ? CblasTrans : CblasNoTrans), CblasNonUnit, mm, &buffer_a[0], &y[bj * bs], 1);
+                            buffer_x[jj] = fmat_0;
                         }
-                    }
-                    else if ((!transpose && MT == matrix_type::upper_triangular) ||
-                            (transpose && MT == matrix_type::lower_triangular))
-                    {
-                        const std::size_t ij_start = (n + bs - 1) / bs - 1;
-                        for (std::size_t bj = ij_start; bj >= 0; --bj)
+
+                        // contributions of all block rows / columns solved so far: blocks within the band only
+                        const std::size_t bi_begin = (transpose ? block_row_begin[bj] : block_col_begin[bj]);
+                        const std::size_t bi_end = (transpose ? block_row_end[bj] : block_col_begin[bj] + (block_row_ptr[bj + 1] - block_row_ptr[bj]));
+                        for (std::size_t bi = bi_begin; bi < bi_end; ++bi)
                         {
-                            const std::size_t mm = std::min(n - bj * bs, bs);
-                            for (std::size_t jj = 0; jj < mm; ++jj)
-                            {
-                                buffer_x[jj] = fmat_0;
-                            }
+                            if (bi == bj) continue;
 
-                            const std::size_t i_stop = bj + 1;
-                            for (std::size_t bi = ij_start; bi >= i_stop; --bi)
+                            const std::size_t nn = std::min(n - bi * bs, bs);
+                            Tmat sum_y = fmat_0;
+                        #if defined(FP_INTEGER_GEMV)
+                            if (internal::is_fixed_point_type<BM, BE>::value)
                             {
-                                const std::size_t nn = std::min(n - bi * bs, bs);
-
-                            #if defined(FP_INTEGER_GEMV)
-                                if (internal::is_fixed_point_type<BM, BE>::value)
-                                {
-                                    const std::size_t k = (transpose ? get_offset(bi, bj) : get_offset(bj, bi));
-                                    const float* fptr = reinterpret_cast<const float*>(&compressed_data[k]);
-                                    const Tmat rescale_p_3 = fptr[0];
-                                    const Tmat rescale_p_4 = fptr[1];
-                                    const fp_type* tmp_a = reinterpret_cast<const fp_type*>(&fptr[2]);
-                                    
-                                    // the following gemv call uses alpha=1 internally
-                                    T rescale_dummy, rescale_p_1, rescale_p_2;
-                                    rescale_p_1 = fmat_1;
-                                    rescale_p_2 = fmat_0;
-                                    for (std::size_t ii = 0; ii < nn; ++ii)
-                                    {
-                                        rescale_p_2 += y[bi * bs + ii];
-                                    }
-                                    if (transpose)
-                                    {
-                                        blas::gemv(L, true, nn, mm, &tmp_a[0], &y[bi * bs], &tmp_x[0]);
-                                    }
-                                    else
-                                    {
-                                        blas::gemv(L, false, mm, nn, &tmp_a[0], &y[bi * bs], &tmp_x[0]);
-                                    }
-                                    // ..finalize gemv call: rescaling
-                                    const Tmat a = rescale_p_1 * rescale_p_4;
-                                    const Tmat b = rescale_p_2 * rescale_p_3;
-                                    for (std::size_t ii = 0; ii < mm; ++ii)
-                                    {
-                                        buffer_x[ii] += (tmp_x[ii] * a + b);
-                                    }
-                                }
-                                else                            
-                            #endif
-                                {
-                                    // decompress the 'buffer'
-                                    const std::size_t k = (transpose ? get_offset(bi, bj) : get_offset(bj, bi));
-                                    fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], mm * nn);
-
-                                    // apply general matrix vector multiplication
-                                    if (transpose)
-                                    {
-                                        const std::size_t lda = (L == matrix_layout::rowmajor ? mm : nn);
-                                        blas::gemv(cblas_layout, CblasTrans, nn, mm, fmat_1, &buffer_a[0], lda, &y[bi * bs], 1, fmat_1, &buffer_x[0], 1);
-                                    }
-                                    else
-                                    {
-                                        const std::size_t lda = (L == matrix_layout::rowmajor ? nn : mm);
-                                        blas::gemv(cblas_layout, CblasNoTrans, mm, nn, fmat_1, &buffer_a[0], lda, &y[bi * bs], 1, fmat_1, &buffer_x[0], 1);
-                                    }
-                                }
-
-                                if (bi == i_stop)
+                                for (std::size_t ii = 0; ii < nn; ++ii)
                                 {
-                                    break;
+                                    sum_y += y[bi * bs + ii];
                                 }
                             }
+                        #endif
 
-                            for (std::size_t jj = 0; jj < mm; ++jj)
+                            if (transpose)
                             {
-                                y[bj * bs + jj] = x[bj * bs + jj] - buffer_x[jj];
+                                apply_block(true, get_block_id(bi, bj), nn, mm, fmat_1, &y[bi * bs], sum_y, &buffer_x[0]);
                             }
-
-                            // decompress the 'buffer'
-                            const std::size_t k = get_offset(bj, bj);
-                            fp_stream<BM, BE>::decompress(&compressed_data[k], &buffer_a[0], (mm * (mm + 1)) / 2);
-
-                            // apply triangular solve 
-                            blas::tpsv(cblas_layout, (MT == matrix_type::upper_triangular ? CblasUpper : CblasLower), (transpose ? CblasTrans : CblasNoTrans), CblasNonUnit, mm, &buffer_a[0], &y[bj * bs], 1);
-
-                            if (bj == 0)
+                            else
                             {
-                                break;
+                                apply_block(false, get_block_id(bj, bi), mm, nn, fmat_1, &y[bi * bs], sum_y, &buffer_x[0]);
                             }
                         }
+
+                        for (std::size_t jj = 0; jj < mm; ++jj)
+                        {
+                            y[bj * bs + jj] = x[bj * bs + jj] - buffer_x[jj];
+                        }
+
+                        // decompress the diagonal block and apply triangular solve
+                        fp_stream<BM, BE>::decompress(&compressed_data[block_offset[get_block_id(bj, bj)]], &buffer_a[0], mm * mm);
+                        blas::trsv(cblas_layout, (upper ? CblasUpper : CblasLower), (transpose ? CblasTrans : CblasNoTrans), CblasNonUnit, mm, &buffer_a[0], mm, &y[bj * bs], 1);
                     }
 
                     // scale with 1 / alpha
@@ -1853,27 +6233,60 @@ namespace FP_NAMESPACE
             }
 
             template <typename Tmat = T, typename Tvec = T>
-            void tpsv(const bool transpose, const Tmat alpha, Tvec* x, const Tvec* y) const
+            void tbsv(const bool transpose, const Tmat alpha, Tvec* xy) const
             {
-                triangular_solve(transpose, alpha, x, y);
+                triangular_solve(transpose, alpha, xy, xy);
             }
 
             template <typename Tmat = T, typename Tvec = T>
-            void tpsv(const bool transpose, const Tmat alpha, std::vector<Tvec>& x, const std::vector<Tvec>& y) const
+            void tbsv(const bool transpose, const Tmat alpha, std::vector<Tvec>& xy) const
             {
-                triangular_solve(transpose, alpha, &x[0], &y[0]);
+                triangular_solve(transpose, alpha, xy, xy);
             }
 
+        #define MACRO_MATRIX_VECTOR(TYPE_MAT, TYPE_VEC)                                                                                                                     \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y) const                               \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y);                                                                                                         \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y) const     \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0]);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            void matrix_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const TYPE_VEC beta, TYPE_VEC* y, const execution_policy policy) const         \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, x, beta, y, policy);                                                                                                 \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            void matrix_vector(const bool transpose, const TYPE_MAT alpha, const std::vector<TYPE_VEC>& x, const TYPE_VEC beta, std::vector<TYPE_VEC>& y, const execution_policy policy) const \
+            {                                                                                                                                                               \
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0], policy);                                                                                         \
+            }                                                                                                                                                               \
+                                                                                                                                                                            \
+            virtual void matrix_multi_vector(const bool transpose, const TYPE_MAT alpha, const TYPE_VEC* x, const std::size_t ldx, const std::size_t k, const TYPE_VEC beta, TYPE_VEC* y, const std::size_t ldy) const \
+            {                                                                                                                                                               \
+                matrix_multi_vector_kernel(transpose, alpha, x, ldx, k, beta, y, ldy);                                                                                      \
+            }                                                                                                                                                               \
+
+            MACRO_MATRIX_VECTOR(double, double);
+            MACRO_MATRIX_VECTOR(double, float);
+            MACRO_MATRIX_VECTOR(float, double);
+            MACRO_MATRIX_VECTOR(float, float);
+
+        #undef MACRO_MATRIX_VECTOR
+
             template <typename Tmat = T, typename Tvec = T>
-            void tpsv(const bool transpose, const Tmat alpha, std::vector<Tvec>& xy) const
+            void gbmv(const bool transpose, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y, const execution_policy policy = execution_policy::sequential) const
             {
-                triangular_solve(transpose, alpha, xy, xy);
+                matrix_vector_kernel(transpose, alpha, x, beta, y, policy);
             }
 
             template <typename Tmat = T, typename Tvec = T>
-            void tpsv(const bool transpose, const Tmat alpha, Tvec* xy) const
+            void gbmv(const bool transpose, const Tmat alpha, const std::vector<Tvec>& x, const Tvec beta, std::vector<Tvec>& y, const execution_policy policy = execution_policy::sequential) const
             {
-                triangular_solve(transpose, alpha, xy, xy);
+                matrix_vector_kernel(transpose, alpha, &x[0], beta, &y[0], policy);
             }
         };
     }
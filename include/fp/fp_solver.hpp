@@ -0,0 +1,883 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#if !defined(FP_SOLVER_HPP)
+#define FP_SOLVER_HPP
+
+#include <iostream>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <fp/fp_blas.hpp>
+
+namespace FP_NAMESPACE
+{
+    namespace internal
+    {
+        //! \brief Fused vector updates for the Krylov solvers
+        //!
+        //! Each of these functions makes a single pass over its vectors.
+        //! Dot products are accumulated using 'double', also for 'float' vectors.
+
+        //! \brief Dot product
+        //!
+        //! \tparam T data type
+        //! \param n vector length
+        //! \param x pointer to the first vector
+        //! \param y pointer to the second vector
+        //! \return x^T * y
+        template <typename T>
+        static inline double dot(const std::size_t n, const T* x, const T* y)
+        {
+            double sum = 0.0;
+            #pragma omp simd reduction(+ : sum)
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                sum += static_cast<double>(x[i]) * y[i];
+            }
+            return sum;
+        }
+
+        //! \brief y = y + a * x
+        //!
+        //! \tparam T data type
+        //! \param n vector length
+        //! \param a scaling factor
+        //! \param x pointer to the input vector
+        //! \param y pointer to the output vector
+        template <typename T>
+        static inline void axpy(const std::size_t n, const T a, const T* x, T* y)
+        {
+            #pragma omp simd
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                y[i] += a * x[i];
+            }
+        }
+
+        //! \brief y = y + a * x, followed by a dot product with 'y'
+        //!
+        //! \tparam T data type
+        //! \param n vector length
+        //! \param a scaling factor
+        //! \param x pointer to the input vector
+        //! \param y pointer to the output vector
+        //! \param z pointer to the vector the output is multiplied with (can be 'y')
+        //! \return y^T * z (after the update)
+        template <typename T>
+        static inline double axpy_dot(const std::size_t n, const T a, const T* x, T* y, const T* z)
+        {
+            double sum = 0.0;
+            #pragma omp simd reduction(+ : sum)
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                y[i] += a * x[i];
+                sum += static_cast<double>(y[i]) * z[i];
+            }
+            return sum;
+        }
+
+        //! \brief Two dot products with a common vector
+        //!
+        //! \tparam T data type
+        //! \param n vector length
+        //! \param x pointer to the common vector
+        //! \param y pointer to the second vector
+        //! \param xy x^T * y
+        //! \param xx x^T * x
+        template <typename T>
+        static inline void dot_dot(const std::size_t n, const T* x, const T* y, double& xy, double& xx)
+        {
+            double sum_xy = 0.0;
+            double sum_xx = 0.0;
+            #pragma omp simd reduction(+ : sum_xy, sum_xx)
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                sum_xy += static_cast<double>(x[i]) * y[i];
+                sum_xx += static_cast<double>(x[i]) * x[i];
+            }
+            xy = sum_xy;
+            xx = sum_xx;
+        }
+
+        //! \brief y = x + b * y
+        //!
+        //! \tparam T data type
+        //! \param n vector length
+        //! \param x pointer to the input vector
+        //! \param b scaling factor
+        //! \param y pointer to the output vector
+        template <typename T>
+        static inline void xpby(const std::size_t n, const T* x, const T b, T* y)
+        {
+            #pragma omp simd
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                y[i] = x[i] + b * y[i];
+            }
+        }
+
+        //! \brief Solution and residual update of the conjugate gradient method
+        //!
+        //! Computes x = x + a * p and r = r - a * q.
+        //!
+        //! \tparam T data type
+        //! \param n vector length
+        //! \param a step length
+        //! \param p pointer to the search direction
+        //! \param q pointer to the matrix vector product 'A * p'
+        //! \param x pointer to the solution
+        //! \param r pointer to the residual
+        //! \return r^T * r (after the update)
+        template <typename T>
+        static inline double cg_update(const std::size_t n, const T a, const T* p, const T* q, T* x, T* r)
+        {
+            double sum = 0.0;
+            #pragma omp simd reduction(+ : sum)
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                x[i] += a * p[i];
+                r[i] -= a * q[i];
+                sum += static_cast<double>(r[i]) * r[i];
+            }
+            return sum;
+        }
+
+        //! \brief Search direction update of the BiCGStab method
+        //!
+        //! Computes p = r + b * (p - w * v).
+        //!
+        //! \tparam T data type
+        //! \param n vector length
+        //! \param b scaling factor
+        //! \param w scaling factor
+        //! \param r pointer to the residual
+        //! \param v pointer to the matrix vector product of the last search direction
+        //! \param p pointer to the search direction
+        template <typename T>
+        static inline void bicgstab_direction(const std::size_t n, const T b, const T w, const T* r, const T* v, T* p)
+        {
+            #pragma omp simd
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                p[i] = r[i] + b * (p[i] - w * v[i]);
+            }
+        }
+
+        //! \brief Solution and residual update of the BiCGStab method
+        //!
+        //! Computes x = x + a * p + w * s and r = r - w * t ('r' holds 's' on entry).
+        //!
+        //! \tparam T data type
+        //! \param n vector length
+        //! \param a step length of the BiCG step
+        //! \param w step length of the stabilizing step
+        //! \param p pointer to the (preconditioned) search direction
+        //! \param s pointer to the (preconditioned) intermediate residual
+        //! \param t pointer to the matrix vector product 'A * s'
+        //! \param r_0 pointer to the shadow residual
+        //! \param x pointer to the solution
+        //! \param r pointer to the residual
+        //! \param r_0r r_0^T * r (after the update)
+        //! \param rr r^T * r (after the update)
+        template <typename T>
+        static inline void bicgstab_update(const std::size_t n, const T a, const T w, const T* p, const T* s, const T* t, const T* r_0, T* x, T* r, double& r_0r, double& rr)
+        {
+            double sum_r_0r = 0.0;
+            double sum_rr = 0.0;
+            #pragma omp simd reduction(+ : sum_r_0r, sum_rr)
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                x[i] += a * p[i] + w * s[i];
+                r[i] -= w * t[i];
+                sum_r_0r += static_cast<double>(r_0[i]) * r[i];
+                sum_rr += static_cast<double>(r[i]) * r[i];
+            }
+            r_0r = sum_r_0r;
+            rr = sum_rr;
+        }
+    }
+
+    namespace solver
+    {
+        using FP_NAMESPACE::blas::matrix_type;
+
+        //! Krylov subspace method: conjugate gradients, BiCGStab, restarted GMRES
+        enum class krylov_method { cg = 0, bicgstab = 1, gmres = 2 };
+
+        //! \brief Solver parameters
+        struct solver_control
+        {
+            // maximum number of iterations
+            std::size_t max_iterations = 1000;
+            // the solver stops as soon as ||b - A * x|| <= tolerance * ||b||
+            double tolerance = 1.0E-8;
+            // number of iterations between two restarts (GMRES only)
+            std::size_t restart = 30;
+        };
+
+        //! \brief Solver result
+        struct solver_status
+        {
+            // number of iterations (iterative refinement: refinement steps)
+            std::size_t iterations;
+            // number of iterations of all inner solves (iterative refinement only)
+            std::size_t inner_iterations;
+            // relative residual ||b - A * x|| / ||b|| (Krylov methods: recursively updated residual)
+            double residual;
+            bool converged;
+        };
+
+        //! \brief No preconditioning
+        struct identity_preconditioner
+        {
+            static constexpr bool is_identity = true;
+
+            template <typename T>
+            void apply(const std::size_t n, const T* r, T* z) const
+            {
+                std::copy(r, r + n, z);
+            }
+        };
+
+        //! \brief Preconditioning with a triangular matrix
+        //!
+        //! Without 'symmetric', the preconditioner is the triangular matrix 'M = T' itself, e.g. the lower triangle
+        //! of the system matrix including the diagonal (Gauss-Seidel), for BiCGStab and GMRES.
+        //! With 'symmetric', the preconditioner is 'M = R^T * R' (upper triangular 'R') or 'M = L * L^T' (lower triangular 'L'),
+        //! e.g. an incomplete Cholesky factor, or 'R = D^(-1/2) * (D + U)' (symmetric Gauss-Seidel), for the conjugate gradient method.
+        //! Applying the preconditioner means one or two (compressed) triangular solves.
+        //!
+        //! \tparam TM triangular matrix type
+        template <typename TM>
+        class triangular_preconditioner
+        {
+            const TM& t;
+            const bool symmetric;
+
+            // upper or lower triangular matrix
+            template <typename T, blas::matrix_layout L, matrix_type MT, std::uint32_t BM, std::uint32_t BE>
+            static constexpr bool is_upper_triangular(const blas::triangular_matrix<T, L, MT, BM, BE>&)
+            {
+                return (MT == matrix_type::upper_triangular);
+            }
+
+        public:
+
+            static constexpr bool is_identity = false;
+
+            //! \brief Constructor
+            //!
+            //! \param t triangular matrix
+            //! \param symmetric (optional) use 'M = R^T * R' or 'M = L * L^T' instead of 'M = T'
+            triangular_preconditioner(const TM& t, const bool symmetric = false)
+                :
+                t(t),
+                symmetric(symmetric)
+            {
+                ;
+            }
+
+            //! \brief Apply the preconditioner
+            //!
+            //! Solves M * z = r.
+            //!
+            //! \tparam T data type
+            //! \param n vector length
+            //! \param r pointer to the input vector
+            //! \param z pointer to the output vector
+            template <typename T>
+            void apply(const std::size_t, const T* r, T* z) const
+            {
+                static constexpr T f_1 = static_cast<T>(1.0);
+
+                if (!symmetric)
+                {
+                    t.triangular_solve(false, f_1, z, r);
+                    return;
+                }
+
+                // R^T * R * z = r or L * L^T * z = r: the second solve is in-place
+                const bool transpose = is_upper_triangular(t);
+                t.triangular_solve(transpose, f_1, z, r);
+                t.triangular_solve(!transpose, f_1, z, z);
+            }
+        };
+
+        template <typename TM>
+        triangular_preconditioner<TM> make_triangular_preconditioner(const TM& t, const bool symmetric = false)
+        {
+            return triangular_preconditioner<TM>(t, symmetric);
+        }
+
+        //! \brief Symmetric matrix given through its upper or lower triangle
+        //!
+        //! Adapts a triangular matrix to the operator interface of the solvers:
+        //! the matrix vector multiplication is the symmetric one (see 'triangular_matrix::symmetric_matrix_vector').
+        //!
+        //! \tparam TM triangular matrix type
+        template <typename TM>
+        class symmetric_operator
+        {
+            const TM& a;
+
+        public:
+
+            // extent of the matrix
+            const std::size_t m;
+            const std::size_t n;
+
+            symmetric_operator(const TM& a)
+                :
+                a(a),
+                m(a.n),
+                n(a.n)
+            {
+                ;
+            }
+
+            // the matrix is symmetric: transposition does not change the result
+            template <typename Tmat, typename Tvec>
+            void matrix_vector(const bool, const Tmat alpha, const Tvec* x, const Tvec beta, Tvec* y) const
+            {
+                a.symmetric_matrix_vector(alpha, x, beta, y);
+            }
+        };
+
+        template <typename TM>
+        symmetric_operator<TM> make_symmetric_operator(const TM& a)
+        {
+            return symmetric_operator<TM>(a);
+        }
+
+        namespace
+        {
+            //! \brief Set up the initial residual r = b - A * x
+            //!
+            //! \return ||b||, or 0 if the operator is not square or 'b' is zero (then 'x' is set to zero)
+            template <typename M, typename T>
+            double initial_residual(const char* name, const M& a, const T* b, T* x, T* r)
+            {
+                static constexpr T f_0 = static_cast<T>(0.0);
+                static constexpr T f_1 = static_cast<T>(1.0);
+
+                if (a.m != a.n)
+                {
+                    std::cerr << "error in solver::" << name << ": the matrix is not square" << std::endl;
+                    return -1.0;
+                }
+
+                const std::size_t n = a.n;
+                const double norm_b = std::sqrt(internal::dot(n, b, b));
+                if (norm_b == 0.0)
+                {
+                    std::fill(x, x + n, f_0);
+                    return 0.0;
+                }
+
+                std::copy(b, b + n, r);
+                a.matrix_vector(false, -f_1, x, f_1, r);
+
+                return norm_b;
+            }
+        }
+
+        //! \brief Preconditioned conjugate gradient method
+        //!
+        //! Solves A * x = b for a symmetric positive definite matrix A.
+        //! The solution and residual updates and the residual norm are fused into a single pass over the vectors.
+        //!
+        //! \tparam M operator type: any compressed matrix, or 'symmetric_operator'
+        //! \tparam T data type of the vectors
+        //! \tparam P preconditioner type
+        //! \param a system matrix
+        //! \param b pointer to the right hand side
+        //! \param x pointer to the initial guess (input) and the solution (output)
+        //! \param control (optional) solver parameters
+        //! \param preconditioner (optional) preconditioner
+        //! \return solver status
+        template <typename M, typename T, typename P = identity_preconditioner>
+        solver_status cg(const M& a, const T* b, T* x, const solver_control& control = solver_control(), const P& preconditioner = P())
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+
+            static constexpr T f_0 = static_cast<T>(0.0);
+
+            solver_status status = {0, 0, 0.0, false};
+            if (b == nullptr || x == nullptr)
+            {
+                std::cerr << "error in solver::cg: any of the pointers is a nullptr" << std::endl;
+                return status;
+            }
+
+            const std::size_t n = a.n;
+
+            // allocate local memory: without preconditioning, 'z' is 'r'
+            internal::scratch_buffer<T> r(n);
+            internal::scratch_buffer<T> p(n);
+            internal::scratch_buffer<T> q(n);
+            internal::scratch_buffer<T> buffer_z(P::is_identity ? 0 : n);
+            T* z = (P::is_identity ? static_cast<T*>(r) : static_cast<T*>(buffer_z));
+
+            const double norm_b = initial_residual("cg", a, b, x, &r[0]);
+            if (norm_b <= 0.0)
+            {
+                status.converged = (norm_b == 0.0);
+                return status;
+            }
+
+            double rr = internal::dot(n, &r[0], &r[0]);
+            if (!P::is_identity) preconditioner.apply(n, &r[0], &z[0]);
+            double rz = (P::is_identity ? rr : internal::dot(n, &r[0], &z[0]));
+            std::copy(&z[0], &z[0] + n, &p[0]);
+
+            while (std::sqrt(rr) > control.tolerance * norm_b && status.iterations < control.max_iterations)
+            {
+                a.matrix_vector(false, static_cast<T>(1.0), &p[0], f_0, &q[0]);
+
+                const double pq = internal::dot(n, &p[0], &q[0]);
+                if (!(pq > 0.0))
+                {
+                    std::cerr << "error in solver::cg: the matrix is not positive definite" << std::endl;
+                    break;
+                }
+
+                const T alpha = static_cast<T>(rz / pq);
+                rr = internal::cg_update(n, alpha, &p[0], &q[0], x, &r[0]);
+                ++status.iterations;
+
+                if (!P::is_identity) preconditioner.apply(n, &r[0], &z[0]);
+                const double rz_new = (P::is_identity ? rr : internal::dot(n, &r[0], &z[0]));
+                internal::xpby(n, &z[0], static_cast<T>(rz_new / rz), &p[0]);
+                rz = rz_new;
+            }
+
+            status.residual = std::sqrt(rr) / norm_b;
+            status.converged = (std::sqrt(rr) <= control.tolerance * norm_b);
+
+            return status;
+        }
+
+        template <typename M, typename T, typename P = identity_preconditioner>
+        solver_status cg(const M& a, const std::vector<T>& b, std::vector<T>& x, const solver_control& control = solver_control(), const P& preconditioner = P())
+        {
+            return cg(a, &b[0], &x[0], control, preconditioner);
+        }
+
+        //! \brief Right-preconditioned BiCGStab method
+        //!
+        //! Solves A * x = b for a general (non-singular) matrix A.
+        //! The residual norm is fused with the residual update, the stabilizing step length needs a single pass for both
+        //! of its dot products, and the solution, residual and shadow residual dot product are updated in a single pass.
+        //!
+        //! \tparam M operator type: any compressed matrix
+        //! \tparam T data type of the vectors
+        //! \tparam P preconditioner type
+        //! \param a system matrix
+        //! \param b pointer to the right hand side
+        //! \param x pointer to the initial guess (input) and the solution (output)
+        //! \param control (optional) solver parameters
+        //! \param preconditioner (optional) preconditioner
+        //! \return solver status
+        template <typename M, typename T, typename P = identity_preconditioner>
+        solver_status bicgstab(const M& a, const T* b, T* x, const solver_control& control = solver_control(), const P& preconditioner = P())
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+
+            static constexpr T f_0 = static_cast<T>(0.0);
+            static constexpr T f_1 = static_cast<T>(1.0);
+
+            solver_status status = {0, 0, 0.0, false};
+            if (b == nullptr || x == nullptr)
+            {
+                std::cerr << "error in solver::bicgstab: any of the pointers is a nullptr" << std::endl;
+                return status;
+            }
+
+            const std::size_t n = a.n;
+
+            // allocate local memory: without preconditioning, 'p_hat' is 'p' and 's_hat' is 's' (= 'r')
+            internal::scratch_buffer<T> r(n);
+            internal::scratch_buffer<T> r_0(n);
+            internal::scratch_buffer<T> p(n);
+            internal::scratch_buffer<T> v(n);
+            internal::scratch_buffer<T> t(n);
+            internal::scratch_buffer<T> buffer_p_hat(P::is_identity ? 0 : n);
+            internal::scratch_buffer<T> buffer_s_hat(P::is_identity ? 0 : n);
+            T* p_hat = (P::is_identity ? static_cast<T*>(p) : static_cast<T*>(buffer_p_hat));
+            T* s_hat = (P::is_identity ? static_cast<T*>(r) : static_cast<T*>(buffer_s_hat));
+
+            const double norm_b = initial_residual("bicgstab", a, b, x, &r[0]);
+            if (norm_b <= 0.0)
+            {
+                status.converged = (norm_b == 0.0);
+                return status;
+            }
+
+            std::copy(&r[0], &r[0] + n, &r_0[0]);
+            std::fill(&p[0], &p[0] + n, f_0);
+            std::fill(&v[0], &v[0] + n, f_0);
+
+            double rr = internal::dot(n, &r[0], &r[0]);
+            double rho = 1.0;
+            double rho_new = rr;
+            double alpha = 1.0;
+            double omega = 1.0;
+
+            while (std::sqrt(rr) > control.tolerance * norm_b && status.iterations < control.max_iterations)
+            {
+                if (rho_new == 0.0 || omega == 0.0)
+                {
+                    std::cerr << "error in solver::bicgstab: breakdown" << std::endl;
+                    break;
+                }
+
+                // new search direction
+                const double beta = (rho_new / rho) * (alpha / omega);
+                internal::bicgstab_direction(n, static_cast<T>(beta), static_cast<T>(omega), &r[0], &v[0], &p[0]);
+                rho = rho_new;
+                ++status.iterations;
+
+                // BiCG step: 'r' becomes 's'
+                if (!P::is_identity) preconditioner.apply(n, &p[0], &p_hat[0]);
+                a.matrix_vector(false, f_1, &p_hat[0], f_0, &v[0]);
+                const double r_0v = internal::dot(n, &r_0[0], &v[0]);
+                if (r_0v == 0.0)
+                {
+                    std::cerr << "error in solver::bicgstab: breakdown" << std::endl;
+                    break;
+                }
+                alpha = rho / r_0v;
+                rr = internal::axpy_dot(n, static_cast<T>(-alpha), &v[0], &r[0], &r[0]);
+
+                if (std::sqrt(rr) <= control.tolerance * norm_b)
+                {
+                    internal::axpy(n, static_cast<T>(alpha), &p_hat[0], x);
+                    break;
+                }
+
+                // stabilizing step
+                if (!P::is_identity) preconditioner.apply(n, &r[0], &s_hat[0]);
+                a.matrix_vector(false, f_1, &s_hat[0], f_0, &t[0]);
+                double ts = 0.0, tt = 0.0;
+                internal::dot_dot(n, &t[0], &r[0], ts, tt);
+                omega = (tt > 0.0 ? ts / tt : 0.0);
+
+                internal::bicgstab_update(n, static_cast<T>(alpha), static_cast<T>(omega), &p_hat[0], &s_hat[0], &t[0], &r_0[0], x, &r[0], rho_new, rr);
+            }
+
+            status.residual = std::sqrt(rr) / norm_b;
+            status.converged = (std::sqrt(rr) <= control.tolerance * norm_b);
+
+            return status;
+        }
+
+        template <typename M, typename T, typename P = identity_preconditioner>
+        solver_status bicgstab(const M& a, const std::vector<T>& b, std::vector<T>& x, const solver_control& control = solver_control(), const P& preconditioner = P())
+        {
+            return bicgstab(a, &b[0], &x[0], control, preconditioner);
+        }
+
+        //! \brief Right-preconditioned restarted GMRES method
+        //!
+        //! Solves A * x = b for a general (non-singular) matrix A.
+        //! The Krylov basis is orthogonalized using modified Gram-Schmidt: each projection is fused with the dot product
+        //! for the next basis vector (or the norm, for the last one).
+        //! The least squares problem is solved using Givens rotations.
+        //!
+        //! \tparam M operator type: any compressed matrix
+        //! \tparam T data type of the vectors
+        //! \tparam P preconditioner type
+        //! \param a system matrix
+        //! \param b pointer to the right hand side
+        //! \param x pointer to the initial guess (input) and the solution (output)
+        //! \param control (optional) solver parameters
+        //! \param preconditioner (optional) preconditioner
+        //! \return solver status
+        template <typename M, typename T, typename P = identity_preconditioner>
+        solver_status gmres(const M& a, const T* b, T* x, const solver_control& control = solver_control(), const P& preconditioner = P())
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+
+            static constexpr T f_0 = static_cast<T>(0.0);
+            static constexpr T f_1 = static_cast<T>(1.0);
+
+            solver_status status = {0, 0, 0.0, false};
+            if (b == nullptr || x == nullptr)
+            {
+                std::cerr << "error in solver::gmres: any of the pointers is a nullptr" << std::endl;
+                return status;
+            }
+
+            const std::size_t n = a.n;
+            const std::size_t k_max = std::max(control.restart, static_cast<std::size_t>(1));
+
+            // allocate local memory: Krylov basis, Hessenberg matrix (column major), Givens rotations, right hand side of the least squares problem
+            internal::scratch_buffer<T> v((k_max + 1) * n);
+            internal::scratch_buffer<T> w(n);
+            internal::scratch_buffer<double> h((k_max + 1) * k_max);
+            internal::scratch_buffer<double> c(k_max);
+            internal::scratch_buffer<double> s(k_max);
+            internal::scratch_buffer<double> g(k_max + 1);
+
+            const double norm_b = initial_residual("gmres", a, b, x, &v[0]);
+            if (norm_b <= 0.0)
+            {
+                status.converged = (norm_b == 0.0);
+                return status;
+            }
+
+            double norm_r = std::sqrt(internal::dot(n, &v[0], &v[0]));
+            while (norm_r > control.tolerance * norm_b && status.iterations < control.max_iterations)
+            {
+                // v_0 = r / ||r||
+                const T inv_norm_r = static_cast<T>(1.0 / norm_r);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    v[i] *= inv_norm_r;
+                }
+                g[0] = norm_r;
+
+                std::size_t k = 0;
+                while (k < k_max && status.iterations < control.max_iterations)
+                {
+                    T* v_k = &v[k * n];
+                    T* v_next = &v[(k + 1) * n];
+                    double* h_k = &h[k * (k_max + 1)];
+
+                    // v_next = A * M^-1 * v_k
+                    if (P::is_identity)
+                    {
+                        a.matrix_vector(false, f_1, v_k, f_0, v_next);
+                    }
+                    else
+                    {
+                        preconditioner.apply(n, v_k, &w[0]);
+                        a.matrix_vector(false, f_1, &w[0], f_0, v_next);
+                    }
+
+                    // modified Gram-Schmidt
+                    h_k[0] = internal::dot(n, v_next, &v[0]);
+                    for (std::size_t i = 0; i <= k; ++i)
+                    {
+                        const T* z = (i < k ? &v[(i + 1) * n] : v_next);
+                        h_k[i + 1] = internal::axpy_dot(n, static_cast<T>(-h_k[i]), &v[i * n], v_next, z);
+                    }
+                    h_k[k + 1] = std::sqrt(std::max(h_k[k + 1], 0.0));
+                    if (h_k[k + 1] > 0.0)
+                    {
+                        const T inv_h = static_cast<T>(1.0 / h_k[k + 1]);
+                        for (std::size_t i = 0; i < n; ++i)
+                        {
+                            v_next[i] *= inv_h;
+                        }
+                    }
+
+                    // apply all previous Givens rotations to the new column, and eliminate h_k[k + 1]
+                    for (std::size_t i = 0; i < k; ++i)
+                    {
+                        const double tmp = c[i] * h_k[i] + s[i] * h_k[i + 1];
+                        h_k[i + 1] = -s[i] * h_k[i] + c[i] * h_k[i + 1];
+                        h_k[i] = tmp;
+                    }
+                    const double r = std::sqrt(h_k[k] * h_k[k] + h_k[k + 1] * h_k[k + 1]);
+                    c[k] = (r > 0.0 ? h_k[k] / r : 1.0);
+                    s[k] = (r > 0.0 ? h_k[k + 1] / r : 0.0);
+                    h_k[k] = r;
+                    h_k[k + 1] = 0.0;
+                    g[k + 1] = -s[k] * g[k];
+                    g[k] = c[k] * g[k];
+
+                    ++k;
+                    ++status.iterations;
+
+                    norm_r = std::abs(g[k]);
+                    if (norm_r <= control.tolerance * norm_b || r == 0.0) break;
+                }
+
+                // solve the upper triangular system H * y = g: 'g' becomes 'y'
+                for (std::size_t j = k; j-- > 0; )
+                {
+                    g[j] /= h[j * (k_max + 1) + j];
+                    for (std::size_t i = 0; i < j; ++i)
+                    {
+                        g[i] -= h[j * (k_max + 1) + i] * g[j];
+                    }
+                }
+
+                // x = x + M^-1 * V * y
+                if (P::is_identity)
+                {
+                    for (std::size_t j = 0; j < k; ++j)
+                    {
+                        internal::axpy(n, static_cast<T>(g[j]), &v[j * n], x);
+                    }
+                }
+                else
+                {
+                    T* z = &v[k_max * n];
+                    std::fill(&w[0], &w[0] + n, f_0);
+                    for (std::size_t j = 0; j < k; ++j)
+                    {
+                        internal::axpy(n, static_cast<T>(g[j]), &v[j * n], &w[0]);
+                    }
+                    preconditioner.apply(n, &w[0], z);
+                    internal::axpy(n, f_1, z, x);
+                }
+
+                // restart: true residual
+                if (norm_r > control.tolerance * norm_b && status.iterations < control.max_iterations)
+                {
+                    std::copy(b, b + n, &v[0]);
+                    a.matrix_vector(false, -f_1, x, f_1, &v[0]);
+                    norm_r = std::sqrt(internal::dot(n, &v[0], &v[0]));
+                }
+            }
+
+            status.residual = norm_r / norm_b;
+            status.converged = (norm_r <= control.tolerance * norm_b);
+
+            return status;
+        }
+
+        template <typename M, typename T, typename P = identity_preconditioner>
+        solver_status gmres(const M& a, const std::vector<T>& b, std::vector<T>& x, const solver_control& control = solver_control(), const P& preconditioner = P())
+        {
+            return gmres(a, &b[0], &x[0], control, preconditioner);
+        }
+
+        //! \brief Krylov subspace method selected at runtime
+        //!
+        //! \tparam M operator type
+        //! \tparam T data type of the vectors
+        //! \tparam P preconditioner type
+        //! \param method Krylov subspace method
+        //! \param a system matrix
+        //! \param b pointer to the right hand side
+        //! \param x pointer to the initial guess (input) and the solution (output)
+        //! \param control (optional) solver parameters
+        //! \param preconditioner (optional) preconditioner
+        //! \return solver status
+        template <typename M, typename T, typename P = identity_preconditioner>
+        solver_status solve(const krylov_method method, const M& a, const T* b, T* x, const solver_control& control = solver_control(), const P& preconditioner = P())
+        {
+            switch (method)
+            {
+                case krylov_method::cg: return cg(a, b, x, control, preconditioner);
+                case krylov_method::bicgstab: return bicgstab(a, b, x, control, preconditioner);
+                default: return gmres(a, b, x, control, preconditioner);
+            }
+        }
+
+        //! \brief Mixed precision iterative refinement
+        //!
+        //! Solves A * x = b: the residual r = b - A * x is computed using the (high precision) operator 'a',
+        //! and the correction d, with A * d = r, using a Krylov subspace method on the (low precision) operator 'a_inner'
+        //! with 'Tinner' vectors (default: 'float').
+        //! Most of the matrix accesses thus go to the low precision operator.
+        //! The refinement stops if the residual no longer decreases.
+        //!
+        //! \tparam Tinner data type of the vectors of the inner solve
+        //! \tparam M operator type
+        //! \tparam M_inner operator type of the inner solve
+        //! \tparam T data type of the vectors
+        //! \tparam P preconditioner type (inner solve)
+        //! \param method Krylov subspace method for the inner solve
+        //! \param a system matrix
+        //! \param a_inner (low precision) system matrix for the inner solve
+        //! \param b pointer to the right hand side
+        //! \param x pointer to the initial guess (input) and the solution (output)
+        //! \param control solver parameters (maximum number of refinement steps, and the tolerance)
+        //! \param inner_control solver parameters of the inner solve (its tolerance is relative to the current residual)
+        //! \param preconditioner (optional) preconditioner for the inner solve
+        //! \return solver status
+        template <typename Tinner = float, typename M, typename M_inner, typename T, typename P = identity_preconditioner>
+        solver_status iterative_refinement(const krylov_method method, const M& a, const M_inner& a_inner, const T* b, T* x, const solver_control& control, const solver_control& inner_control, const P& preconditioner = P())
+        {
+            static_assert(std::is_same<T, double>::value || std::is_same<T, float>::value, "error: only 'double' or 'float' are allowed");
+            static_assert(std::is_same<Tinner, double>::value || std::is_same<Tinner, float>::value, "error: only 'double' or 'float' are allowed");
+
+            static constexpr Tinner finner_0 = static_cast<Tinner>(0.0);
+
+            solver_status status = {0, 0, 0.0, false};
+            if (b == nullptr || x == nullptr)
+            {
+                std::cerr << "error in solver::iterative_refinement: any of the pointers is a nullptr" << std::endl;
+                return status;
+            }
+
+            if (a.n != a_inner.n || a.m != a_inner.m)
+            {
+                std::cerr << "error in solver::iterative_refinement: the matrices have different extents" << std::endl;
+                return status;
+            }
+
+            const std::size_t n = a.n;
+
+            // allocate local memory
+            internal::scratch_buffer<T> r(n);
+            internal::scratch_buffer<Tinner> r_inner(n);
+            internal::scratch_buffer<Tinner> d_inner(n);
+
+            double norm_b = initial_residual("iterative_refinement", a, b, x, &r[0]);
+            if (norm_b <= 0.0)
+            {
+                status.converged = (norm_b == 0.0);
+                return status;
+            }
+
+            double norm_r = std::sqrt(internal::dot(n, &r[0], &r[0]));
+            status.residual = norm_r / norm_b;
+
+            while (norm_r > control.tolerance * norm_b && status.iterations < control.max_iterations)
+            {
+                // correction: A * d = r
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    r_inner[i] = static_cast<Tinner>(r[i]);
+                    d_inner[i] = finner_0;
+                }
+                const solver_status inner_status = solve(method, a_inner, &r_inner[0], &d_inner[0], inner_control, preconditioner);
+                status.inner_iterations += inner_status.iterations;
+                ++status.iterations;
+
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    x[i] += static_cast<T>(d_inner[i]);
+                }
+
+                // residual: high precision
+                std::copy(b, b + n, &r[0]);
+                a.matrix_vector(false, static_cast<T>(-1.0), x, static_cast<T>(1.0), &r[0]);
+                const double norm_r_new = std::sqrt(internal::dot(n, &r[0], &r[0]));
+                if (!(norm_r_new < norm_r))
+                {
+                    // no progress: undo the last correction
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        x[i] -= static_cast<T>(d_inner[i]);
+                    }
+                    break;
+                }
+
+                norm_r = norm_r_new;
+                status.residual = norm_r / norm_b;
+            }
+
+            status.converged = (norm_r <= control.tolerance * norm_b);
+
+            return status;
+        }
+
+        template <typename Tinner = float, typename M, typename M_inner, typename T, typename P = identity_preconditioner>
+        solver_status iterative_refinement(const krylov_method method, const M& a, const M_inner& a_inner, const std::vector<T>& b, std::vector<T>& x, const solver_control& control, const solver_control& inner_control, const P& preconditioner = P())
+        {
+            return iterative_refinement<Tinner>(method, a, a_inner, &b[0], &x[0], control, inner_control, preconditioner);
+        }
+    }
+}
+
+#endif
@@ -8,11 +8,11 @@
 
 #include "general_matrix_vector_kernel_blas.cpp"
 
-double fp_matrix_vector(const bool transpose, const mat_t alpha, const fp_matrix& a, const std::vector<vec_t>& x, const vec_t beta, std::vector<vec_t>& y)
+double fp_matrix_vector(const bool transpose, const mat_t alpha, const fp_matrix& a, const std::vector<vec_t>& x, const vec_t beta, std::vector<vec_t>& y, const fw::blas::execution_policy policy)
 {
     double time = omp_get_wtime();
     {
-        a.matrix_vector(transpose, alpha, x, beta, y);
+        a.matrix_vector(transpose, alpha, x, beta, y, policy);
     }
     return (omp_get_wtime() - time);
 }
\ No newline at end of file
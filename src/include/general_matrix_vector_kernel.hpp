@@ -45,6 +45,6 @@ using fp_matrix = typename fw::blas::matrix<real_t, L, BM, BE>;
 // prototypes
 #include "general_matrix_vector_kernel_blas.hpp"
 
-double fp_matrix_vector(const bool transpose, const mat_t alpha, const fp_matrix& a, const std::vector<vec_t>& x, const vec_t beta, std::vector<vec_t>& y);
+double fp_matrix_vector(const bool transpose, const mat_t alpha, const fp_matrix& a, const std::vector<vec_t>& x, const vec_t beta, std::vector<vec_t>& y, const fw::blas::execution_policy policy = fw::blas::execution_policy::sequential);
 
 #endif
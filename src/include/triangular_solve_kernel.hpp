@@ -53,6 +53,6 @@ using fp_matrix = typename fw::blas::triangular_matrix<real_t, L, fw::blas::matr
 
 double blas_triangular_solve(const bool transpose, const std::size_t n, const mat_t alpha, const std::vector<real_t>& a, std::vector<vec_t>& x, const std::vector<vec_t>& y);
 
-double fp_triangular_solve(const bool transpose, const mat_t alpha, const fp_matrix& a, std::vector<vec_t>& x, std::vector<vec_t>& y);
+double fp_triangular_solve(const bool transpose, const mat_t alpha, const fp_matrix& a, std::vector<vec_t>& x, std::vector<vec_t>& y, const fw::blas::execution_policy policy = fw::blas::execution_policy::sequential);
 
 #endif
@@ -0,0 +1,256 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <map>
+#include <vector>
+#include <memory>
+#include <omp.h>
+#include <fp/fp_blas.hpp>
+
+#if defined(THREAD_PINNING)
+#include <sched.h>
+#include <sys/sysinfo.h>
+#endif
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+static constexpr CBLAS_LAYOUT layout = (L == fw::blas::matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+// compressed matrix data type: the compression scheme is selected per block
+using fp_matrix = typename fw::blas::adaptive_matrix<real_t, L>;
+
+// relative error bounds to be tested
+constexpr double tolerances[] = {1.0E-2, 1.0E-3, 1.0E-5, 1.0E-8};
+
+constexpr std::size_t m_default = 256;
+constexpr std::size_t n_default = 256;
+constexpr std::size_t num_matrices_default = 100;
+constexpr std::size_t bs_default = 32;
+
+#if defined(BENCHMARK)
+constexpr std::size_t warmup = 5;
+constexpr std::size_t measurement = 10;
+constexpr bool transpose_benchmark = false;
+#else
+constexpr std::size_t warmup = 0;
+constexpr std::size_t measurement = 1;
+#endif
+
+void kernel(const real_t alpha, const real_t beta, const bool transpose,
+    const std::size_t m, const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y);
+
+int main(int argc, char** argv)
+{
+    // read command line arguments
+    const std::size_t m = (argc > 1 ? atoi(argv[1]) : m_default);
+    const std::size_t n = (argc > 2 ? atoi(argv[2]) : n_default);
+    const std::size_t num_matrices = (argc > 3 ? atoi(argv[3]) : num_matrices_default);
+    const std::size_t bs = (argc > 4 ? atoi(argv[4]) : bs_default);
+    // blocks are scaled by 10^[-'decades' .. 0]
+    const double decades = (argc > 5 ? atof(argv[5]) : 3.0);
+    // absolute error bound in units of the tolerance (the largest matrix entry is about 1.0)
+    const double f_absolute = (argc > 6 ? atof(argv[6]) : 1.0E-1);
+
+    std::cout << "matrix multiply: " << m << " x " << n << std::endl;
+    std::cout << "block scaling: 1.0E-" << decades << " .. 1.0" << std::endl;
+    std::cout << "absolute error bound: " << f_absolute << " x tolerance" << std::endl;
+    std::cout << "num matrices: " << num_matrices << std::endl;
+    std::cout << "block size: " << bs << std::endl;
+
+#if defined(THREAD_PINNING)
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        const std::size_t num_cpus = get_nprocs_conf();
+
+        cpu_set_t cpu_mask;
+        CPU_ZERO(&cpu_mask);
+        CPU_SET(thread_id % num_cpus, &cpu_mask);
+        sched_setaffinity(0, sizeof(cpu_mask), &cpu_mask);
+    }
+#endif
+
+    // create matrices and vectors: the entries of each block are in the range [-1, 1] times a block specific scaling factor
+    std::vector<std::vector<real_t>> a(num_matrices), x(num_matrices), y_ref(num_matrices), y(num_matrices);
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        std::uint32_t seed = 1 + thread_id;
+
+        #pragma omp for schedule(static)
+        for (std::size_t k = 0; k < num_matrices; ++k)
+        {
+            a[k].resize(m * n);
+            for (std::size_t j = 0; j < m; j += bs)
+            {
+                for (std::size_t i = 0; i < n; i += bs)
+                {
+                    const double scale = std::pow(10.0, -decades * rand_r(&seed) / RAND_MAX);
+                    for (std::size_t jj = j; jj < std::min(m, j + bs); ++jj)
+                    {
+                        for (std::size_t ii = i; ii < std::min(n, i + bs); ++ii)
+                        {
+                            a[k][fw::blas::idx<L>(jj, ii, lda)] = scale * (2.0 * rand_r(&seed) / RAND_MAX - 1.0);
+                        }
+                    }
+                }
+            }
+
+            const std::size_t mn = std::max(m, n);
+            x[k].resize(mn);
+            y_ref[k].resize(mn);
+            y[k].resize(mn);
+            for (std::size_t i = 0; i < mn; ++i)
+            {
+                x[k][i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+            }
+        }
+    }
+
+    for (const double tolerance : tolerances)
+    {
+        std::vector<std::unique_ptr<fp_matrix>> a_compressed(num_matrices);
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t k = 0; k < num_matrices; ++k)
+        {
+            a_compressed[k].reset(new fp_matrix(a[k], lda, std::array<std::size_t, 2>({m, n}), fw::blas::error_bound({tolerance, f_absolute * tolerance}), bs));
+        }
+
+        // which compression schemes are used?
+        std::map<std::array<std::uint32_t, 2>, std::size_t> num_blocks;
+        for (std::size_t k = 0; k < num_matrices; ++k)
+        {
+            for (std::size_t bj = 0; bj < ((m + bs - 1) / bs); ++bj)
+            {
+                for (std::size_t bi = 0; bi < ((n + bs - 1) / bs); ++bi)
+                {
+                    ++num_blocks[a_compressed[k]->get_block_format(bj, bi)];
+                }
+            }
+        }
+
+        std::cout << "tolerance: " << tolerance << ", blocks:";
+        for (const auto& entry : num_blocks)
+        {
+            std::cout << " (BM = " << entry.first[0] << ", BE = " << entry.first[1] << "): " << entry.second;
+        }
+        std::cout << std::endl;
+
+    #if defined(BENCHMARK)
+        kernel(1.0, 0.0, transpose_benchmark, m, n, a, a_compressed, x, y_ref, y);
+    #else
+        kernel(1.0, 0.0, false, m, n, a, a_compressed, x, y_ref, y);
+        kernel(1.0, 0.0, true, m, n, a, a_compressed, x, y_ref, y);
+        kernel(-0.34, 1.1, false, m, n, a, a_compressed, x, y_ref, y);
+        kernel(-0.34, 1.1, true, m, n, a, a_compressed, x, y_ref, y);
+    #endif
+    }
+
+    return 0;
+}
+
+void kernel(const real_t alpha, const real_t beta, const bool transpose,
+    const std::size_t m, const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y)
+{
+    // print some information
+    std::size_t memory_footprint_bytes = 0;
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        memory_footprint_bytes += a_compressed[k]->memory_footprint_bytes();
+    }
+    std::cout << "mode: adaptive_matrix (matrix memory consumption: " << memory_footprint_bytes / (1024 * 1024) << " MiB, "
+        << (8.0 * memory_footprint_bytes) / (a.size() * m * n) << " bits per element)" << std::endl;
+    std::cout << "alpha: " << alpha << ", beta: " << beta << ", transpose: " << (transpose ? "true" : "false") << std::endl;
+
+    // reference computation
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t j = 0; j < y[k].size(); ++j)
+        {
+            y_ref[k][j] = 1.0;
+            y[k][j] = 1.0;
+        }
+        fw::blas::gemv(layout, (transpose ? CblasTrans : CblasNoTrans), m, n, alpha, &a[k][0], lda, &x[k][0], 1, beta, &y_ref[k][0], 1);
+    }
+
+    // own implementation
+    double time = 0.0;
+
+    #pragma omp parallel
+    {
+        for (std::size_t l = 0; l < warmup; ++l)
+        {
+            #pragma omp for schedule(static)
+            for (std::size_t k = 0; k < a.size(); ++k)
+            {
+                a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0]);
+            }
+        }
+
+        double time_accumulated = 0.0;
+        for (std::size_t l = 0; l < measurement; ++l)
+        {
+            #pragma omp for schedule(static)
+            for (std::size_t k = 0; k < a.size(); ++k)
+            {
+                double time_start = omp_get_wtime();
+                a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0]);
+                time_accumulated += (omp_get_wtime() - time_start);
+            }
+        }
+
+        #pragma omp atomic
+        time += time_accumulated;
+    }
+
+#if defined(BENCHMARK)
+    // output some metrics
+    const double gflops = measurement * a.size() * 2 * m * n / (time / omp_get_max_threads()) * 1.0E-9;
+    std::cout << "gflops: " << gflops << std::endl;
+#else
+    // correctness: relative to the largest output element
+    double dev = 0.0;
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        double y_max = 0.0;
+        for (std::size_t j = 0; j < (transpose ? n : m); ++j)
+        {
+            y_max = std::max(y_max, static_cast<double>(std::abs(y_ref[k][j])));
+        }
+        for (std::size_t j = 0; j < (transpose ? n : m); ++j)
+        {
+            dev = std::max(dev, std::abs(y[k][j] - y_ref[k][j]) / y_max);
+        }
+    }
+    std::cout << "deviation: " << dev << std::endl;
+#endif
+}
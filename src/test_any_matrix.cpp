@@ -0,0 +1,227 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <omp.h>
+#include <fp/fp_blas.hpp>
+
+#if defined(THREAD_PINNING)
+#include <sched.h>
+#include <sys/sysinfo.h>
+#endif
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+static constexpr CBLAS_LAYOUT layout = (L == fw::blas::matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+// compressed matrix data type: the compression scheme is selected at runtime
+using fp_matrix = typename fw::blas::any_matrix<real_t, L>;
+
+// compression schemes to be tested: (BM, BE)
+constexpr std::uint32_t formats[][2] = {{52, 11}, {23, 8}, {7, 8}, {10, 5}, {3, 4}, {2, 5}, {7, fw::block_exponent(16)}, {7, fw::block_exponent(32)}, {16, 0}, {8, 0}, {4, 0}};
+
+constexpr std::size_t m_default = 256;
+constexpr std::size_t n_default = 256;
+constexpr std::size_t num_matrices_default = 100;
+constexpr std::size_t bs_default = 32;
+
+#if defined(BENCHMARK)
+constexpr std::size_t warmup = 5;
+constexpr std::size_t measurement = 10;
+constexpr bool transpose_benchmark = false;
+#else
+constexpr std::size_t warmup = 0;
+constexpr std::size_t measurement = 1;
+#endif
+
+void kernel(const real_t alpha, const real_t beta, const bool transpose,
+    const std::size_t m, const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y);
+
+int main(int argc, char** argv)
+{
+    // read command line arguments
+    const std::size_t m = (argc > 1 ? atoi(argv[1]) : m_default);
+    const std::size_t n = (argc > 2 ? atoi(argv[2]) : n_default);
+    const std::size_t num_matrices = (argc > 3 ? atoi(argv[3]) : num_matrices_default);
+    const std::size_t bs = (argc > 4 ? atoi(argv[4]) : bs_default);
+    const double f_scale = (argc > 5 ? atof(argv[5]) : 1.0);
+    const double f_shift = (argc > 6 ? atof(argv[6]) : 0.0);
+
+    std::cout << "matrix multiply: " << m << " x " << n << std::endl;
+    std::cout << "matrix entries in range: " << -1.0 * std::abs(f_scale) + f_shift << " .. " << std::abs(f_scale) + f_shift << std::endl;
+    std::cout << "num matrices: " << num_matrices << std::endl;
+    std::cout << "block size: " << bs << std::endl;
+
+#if defined(THREAD_PINNING)
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        const std::size_t num_cpus = get_nprocs_conf();
+
+        cpu_set_t cpu_mask;
+        CPU_ZERO(&cpu_mask);
+        CPU_SET(thread_id % num_cpus, &cpu_mask);
+        sched_setaffinity(0, sizeof(cpu_mask), &cpu_mask);
+    }
+#endif
+
+    // create matrices and vectors
+    std::vector<std::vector<real_t>> a(num_matrices), x(num_matrices), y_ref(num_matrices), y(num_matrices);
+
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        std::uint32_t seed = 1 + thread_id;
+
+        #pragma omp for schedule(static)
+        for (std::size_t k = 0; k < num_matrices; ++k)
+        {
+            a[k].resize(m * n);
+            for (std::size_t i = 0; i < (m * n); ++i)
+            {
+                a[k][i] = f_scale * (2.0 * rand_r(&seed) / RAND_MAX - 1.0) + f_shift;
+            }
+
+            const std::size_t mn = std::max(m, n);
+            x[k].resize(mn);
+            y_ref[k].resize(mn);
+            y[k].resize(mn);
+            for (std::size_t i = 0; i < mn; ++i)
+            {
+                x[k][i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+            }
+        }
+    }
+
+    // one and the same binary for all compression schemes
+    for (const auto& format : formats)
+    {
+        const std::uint32_t bm = format[0];
+        const std::uint32_t be = format[1];
+        if (!fp_matrix::is_supported(bm, be))
+        {
+            std::cout << "BE = " << be << ", BM = " << bm << ": not supported" << std::endl;
+            continue;
+        }
+
+        std::vector<std::unique_ptr<fp_matrix>> a_compressed(num_matrices);
+
+        #pragma omp parallel for schedule(static)
+        for (std::size_t k = 0; k < num_matrices; ++k)
+        {
+            const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+            a_compressed[k].reset(new fp_matrix(bm, be, a[k], lda, std::array<std::size_t, 2>({m, n}), bs));
+        }
+
+    #if defined(BENCHMARK)
+        kernel(1.0, 0.0, transpose_benchmark, m, n, a, a_compressed, x, y_ref, y);
+    #else
+        kernel(1.0, 0.0, false, m, n, a, a_compressed, x, y_ref, y);
+        kernel(1.0, 0.0, true, m, n, a, a_compressed, x, y_ref, y);
+        kernel(-0.34, 1.1, false, m, n, a, a_compressed, x, y_ref, y);
+        kernel(-0.34, 1.1, true, m, n, a, a_compressed, x, y_ref, y);
+    #endif
+    }
+
+    return 0;
+}
+
+void kernel(const real_t alpha, const real_t beta, const bool transpose,
+    const std::size_t m, const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y)
+{
+    // print some information
+    std::cout << "mode: any_matrix, BE = " << a_compressed[0]->be << ", BM = " << a_compressed[0]->bm << " (matrix memory consumption: " << a.size() * a_compressed[0]->memory_footprint_bytes() / (1024 * 1024) << " MiB)" << std::endl;
+    std::cout << "alpha: " << alpha << ", beta: " << beta << ", transpose: " << (transpose ? "true" : "false") << std::endl;
+
+    // reference computation
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t j = 0; j < y[k].size(); ++j)
+        {
+            y_ref[k][j] = 1.0;
+            y[k][j] = 1.0;
+        }
+        fw::blas::gemv(layout, (transpose ? CblasTrans : CblasNoTrans), m, n, alpha, &a[k][0], lda, &x[k][0], 1, beta, &y_ref[k][0], 1);
+    }
+
+    // own implementation
+    double time = 0.0;
+
+    #pragma omp parallel
+    {
+        for (std::size_t l = 0; l < warmup; ++l)
+        {
+            #pragma omp for schedule(static)
+            for (std::size_t k = 0; k < a.size(); ++k)
+            {
+                a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0]);
+            }
+        }
+
+        double time_accumulated = 0.0;
+        for (std::size_t l = 0; l < measurement; ++l)
+        {
+            #pragma omp for schedule(static)
+            for (std::size_t k = 0; k < a.size(); ++k)
+            {
+                double time_start = omp_get_wtime();
+                a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0]);
+                time_accumulated += (omp_get_wtime() - time_start);
+            }
+        }
+
+        #pragma omp atomic
+        time += time_accumulated;
+    }
+
+#if defined(BENCHMARK)
+    // output some metrics
+    const double gflops = measurement * a.size() * 2 * m * n / (time / omp_get_max_threads()) * 1.0E-9;
+    std::cout << "gflops: " << gflops << std::endl;
+#else
+    // correctness
+    double dev = 0.0;
+    real_t v_1 = y_ref[0][0];
+    real_t v_2 = y[0][0];
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t j = 0; j < (transpose ? n : m); ++j)
+        {
+            const double tmp = std::abs((y[k][j] - y_ref[k][j]) / y_ref[k][j]);
+            if (tmp > dev)
+            {
+                dev = tmp;
+                v_1 = y_ref[k][j];
+                v_2 = y[k][j];
+            }
+        }
+    }
+    std::cout << "deviation: " << dev << " (" << v_1 << " vs. " << v_2 << ")" << std::endl;
+#endif
+}
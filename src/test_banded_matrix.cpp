@@ -0,0 +1,389 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <memory>
+#include <omp.h>
+#include <fp/fp_blas.hpp>
+
+#if defined(THREAD_PINNING)
+#include <sched.h>
+#include <sys/sysinfo.h>
+#endif
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+// number of bits to be used for exponent and mantissa
+#if defined(_BE)
+static constexpr std::uint32_t BE = _BE;
+#else
+static constexpr std::uint32_t BE = 0;
+#endif
+
+#if defined(_BM)
+static constexpr std::uint32_t BM = _BM;
+#else
+static constexpr std::uint32_t BM = 16;
+#endif
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+static constexpr CBLAS_LAYOUT layout = (L == fw::blas::matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+// compressed matrix data type
+using fp_matrix = typename fw::blas::banded_matrix<real_t, L, BM, BE>;
+
+constexpr std::size_t m_default = 2048;
+constexpr std::size_t n_default = 2048;
+constexpr std::size_t kl_default = 64;
+constexpr std::size_t ku_default = 64;
+constexpr std::size_t num_matrices_default = 16;
+constexpr std::size_t bs_default = 32;
+constexpr std::size_t num_vectors = 4;
+
+#if defined(BENCHMARK)
+constexpr std::size_t warmup = 5;
+constexpr std::size_t measurement = 10;
+constexpr bool transpose_benchmark = false;
+#else
+constexpr std::size_t warmup = 0;
+constexpr std::size_t measurement = 1;
+#endif
+
+// create a random 'm x n' matrix with 'kl' sub- and 'ku' super-diagonals in band storage, and its dense representation
+void make_banded_matrix(const std::size_t m, const std::size_t n, const std::size_t kl, const std::size_t ku, const real_t diagonal,
+    std::vector<real_t>& band, std::vector<real_t>& a, std::uint32_t& seed);
+
+void kernel(const real_t alpha, const real_t beta, const bool transpose,
+    const std::size_t m, const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y,
+    const bool use_threads_per_matrix = false);
+
+#if !defined(BENCHMARK)
+void triangular_solve(const std::size_t n, const std::size_t kl, const std::size_t ku, const std::size_t bs);
+#endif
+
+int main(int argc, char** argv)
+{
+    // read command line arguments
+    const std::size_t m = (argc > 1 ? atoi(argv[1]) : m_default);
+    const std::size_t n = (argc > 2 ? atoi(argv[2]) : n_default);
+    const std::size_t kl = (argc > 3 ? atoi(argv[3]) : kl_default);
+    const std::size_t ku = (argc > 4 ? atoi(argv[4]) : ku_default);
+    const std::size_t num_matrices = (argc > 5 ? atoi(argv[5]) : num_matrices_default);
+    const std::size_t bs = (argc > 6 ? atoi(argv[6]) : bs_default);
+    const bool use_threads_per_matrix = (argc > 7 ? (atoi(argv[7]) != 0 ? true : false) : false);
+
+    std::cout << "matrix multiply: " << m << " x " << n << std::endl;
+    std::cout << "sub-diagonals: " << kl << ", super-diagonals: " << ku << std::endl;
+    std::cout << "num matrices: " << num_matrices << std::endl;
+    std::cout << "block size: " << bs << std::endl;
+    std::cout << "parallelism: " << (use_threads_per_matrix ? "within matrices" : "across matrices") << std::endl;
+
+#if defined(THREAD_PINNING)
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        const std::size_t num_cpus = get_nprocs_conf();
+
+        cpu_set_t cpu_mask;
+        CPU_ZERO(&cpu_mask);
+        CPU_SET(thread_id % num_cpus, &cpu_mask);
+        sched_setaffinity(0, sizeof(cpu_mask), &cpu_mask);
+    }
+#endif
+
+    // create matrices and vectors: the matrices are given in band storage
+    std::vector<std::vector<real_t>> a(num_matrices), x(num_matrices), y_ref(num_matrices), y(num_matrices);
+    std::vector<std::unique_ptr<fp_matrix>> a_compressed(num_matrices);
+
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        std::uint32_t seed = 1 + thread_id;
+
+        #pragma omp for schedule(static)
+        for (std::size_t k = 0; k < num_matrices; ++k)
+        {
+            std::vector<real_t> band;
+            make_banded_matrix(m, n, kl, ku, 0.0, band, a[k], seed);
+            a_compressed[k].reset(new fp_matrix(band, kl + ku + 1, std::array<std::size_t, 2>({m, n}), kl, ku, bs));
+
+            const std::size_t mn = std::max(m, n);
+            x[k].resize(mn * num_vectors);
+            y_ref[k].resize(mn * num_vectors);
+            y[k].resize(mn * num_vectors);
+            for (std::size_t i = 0; i < (mn * num_vectors); ++i)
+            {
+                x[k][i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+            }
+        }
+    }
+
+#if !defined(BENCHMARK)
+    // decompression must give the band only
+    {
+        const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+        std::vector<real_t> tmp(m * n);
+        a_compressed[0]->decompress(&tmp[0], lda);
+        double dev = 0.0;
+        for (std::size_t i = 0; i < (m * n); ++i)
+        {
+            dev = std::max(dev, static_cast<double>(std::abs(tmp[i] - a[0][i])));
+        }
+        std::cout << "decompression: " << a_compressed[0]->num_blocks() << " blocks, deviation: " << dev << std::endl;
+    }
+#endif
+
+#if defined(BENCHMARK)
+    kernel(1.0, 0.0, transpose_benchmark, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+#else
+    kernel(1.0, 0.0, false, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+    kernel(1.0, 0.0, true, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+    kernel(-0.34, 1.1, false, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+    kernel(-0.34, 1.1, true, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+
+    // triangular solve: lower and upper triangular banded matrices
+    triangular_solve(n, kl, 0, bs);
+    triangular_solve(n, 0, ku, bs);
+#endif
+
+    return 0;
+}
+
+void make_banded_matrix(const std::size_t m, const std::size_t n, const std::size_t kl, const std::size_t ku, const real_t diagonal,
+    std::vector<real_t>& band, std::vector<real_t>& a, std::uint32_t& seed)
+{
+    // band storage (see gbmv): column major 'band[(ku + j - i) + i * ld]', row major 'band[(kl + i - j) + j * ld]'
+    const std::size_t ld = kl + ku + 1;
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    band.assign(ld * (L == fw::blas::matrix_layout::rowmajor ? m : n), 0.0);
+    a.assign(m * n, 0.0);
+
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        const std::size_t i_start = (j > kl ? j - kl : 0);
+        const std::size_t i_end = std::min(n, j + ku + 1);
+        for (std::size_t i = i_start; i < i_end; ++i)
+        {
+            const real_t value = 2.0 * rand_r(&seed) / RAND_MAX - 1.0 + (i == j ? diagonal : 0.0);
+            a[fw::blas::idx<L>(j, i, lda)] = value;
+            if (L == fw::blas::matrix_layout::colmajor)
+            {
+                band[(ku + j - i) + i * ld] = value;
+            }
+            else
+            {
+                band[(kl + i - j) + j * ld] = value;
+            }
+        }
+    }
+}
+
+void kernel(const real_t alpha, const real_t beta, const bool transpose,
+    const std::size_t m, const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y,
+    const bool use_threads_per_matrix)
+{
+    // print some information
+    std::size_t memory_footprint_bytes = 0;
+    std::size_t num_blocks = 0;
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        memory_footprint_bytes += a_compressed[k]->memory_footprint_bytes();
+        num_blocks += a_compressed[k]->num_blocks();
+    }
+    std::cout << "mode: banded_matrix, BE = " << BE << ", BM = " << BM << " (matrix memory consumption: " << memory_footprint_bytes / (1024 * 1024) << " MiB, "
+        << num_blocks / a.size() << " blocks per matrix)" << std::endl;
+    std::cout << "alpha: " << alpha << ", beta: " << beta << ", transpose: " << (transpose ? "true" : "false") << std::endl;
+
+    // reference computation
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    const std::size_t mn = std::max(m, n);
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t j = 0; j < y[k].size(); ++j)
+        {
+            y_ref[k][j] = 1.0;
+            y[k][j] = 1.0;
+        }
+        fw::blas::gemv(layout, (transpose ? CblasTrans : CblasNoTrans), m, n, alpha, &a[k][0], lda, &x[k][0], 1, beta, &y_ref[k][0], 1);
+    }
+
+    // own implementation
+    double time = 0.0;
+
+    if (use_threads_per_matrix)
+    {
+        const fw::blas::execution_policy policy = fw::blas::execution_policy::parallel;
+
+        for (std::size_t l = 0; l < warmup; ++l)
+        {
+            for (std::size_t k = 0; k < a.size(); ++k)
+            {
+                a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0], policy);
+            }
+        }
+
+        for (std::size_t l = 0; l < measurement; ++l)
+        {
+            for (std::size_t k = 0; k < a.size(); ++k)
+            {
+                double time_start = omp_get_wtime();
+                a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0], policy);
+                time += (omp_get_wtime() - time_start);
+            }
+        }
+
+        time *= omp_get_max_threads();
+    }
+    else
+    {
+        #pragma omp parallel
+        {
+            for (std::size_t l = 0; l < warmup; ++l)
+            {
+                #pragma omp for schedule(static)
+                for (std::size_t k = 0; k < a.size(); ++k)
+                {
+                    a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0]);
+                }
+            }
+
+            double time_accumulated = 0.0;
+            for (std::size_t l = 0; l < measurement; ++l)
+            {
+                #pragma omp for schedule(static)
+                for (std::size_t k = 0; k < a.size(); ++k)
+                {
+                    double time_start = omp_get_wtime();
+                    a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0]);
+                    time_accumulated += (omp_get_wtime() - time_start);
+                }
+            }
+
+            #pragma omp atomic
+            time += time_accumulated;
+        }
+    }
+
+#if defined(BENCHMARK)
+    // output some metrics: only the band counts
+    std::size_t num_elements = 0;
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t i = 0; i < (m * n); ++i)
+        {
+            num_elements += (a[k][i] != 0.0 ? 1 : 0);
+        }
+    }
+    const double gflops = measurement * 2 * num_elements / (time / omp_get_max_threads()) * 1.0E-9;
+    std::cout << "gflops: " << gflops << std::endl;
+#else
+    // correctness: relative to the largest output element
+    auto deviation = [&](const std::size_t num_vectors)
+    {
+        double dev = 0.0;
+        for (std::size_t k = 0; k < a.size(); ++k)
+        {
+            for (std::size_t c = 0; c < num_vectors; ++c)
+            {
+                double y_max = 0.0;
+                for (std::size_t j = 0; j < (transpose ? n : m); ++j)
+                {
+                    y_max = std::max(y_max, static_cast<double>(std::abs(y_ref[k][c * mn + j])));
+                }
+                for (std::size_t j = 0; j < (transpose ? n : m); ++j)
+                {
+                    dev = std::max(dev, std::abs(y[k][c * mn + j] - y_ref[k][c * mn + j]) / y_max);
+                }
+            }
+        }
+        return dev;
+    };
+    std::cout << "deviation: " << deviation(1) << std::endl;
+
+    // multiple vectors
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t j = 0; j < y[k].size(); ++j)
+        {
+            y_ref[k][j] = 1.0;
+            y[k][j] = 1.0;
+        }
+        for (std::size_t c = 0; c < num_vectors; ++c)
+        {
+            fw::blas::gemv(layout, (transpose ? CblasTrans : CblasNoTrans), m, n, alpha, &a[k][0], lda, &x[k][c * mn], 1, beta, &y_ref[k][c * mn], 1);
+        }
+        a_compressed[k]->matrix_multi_vector(transpose, alpha, &x[k][0], mn, num_vectors, beta, &y[k][0], mn);
+    }
+    std::cout << "deviation (" << num_vectors << " vectors): " << deviation(num_vectors) << std::endl;
+#endif
+}
+
+#if !defined(BENCHMARK)
+void triangular_solve(const std::size_t n, const std::size_t kl, const std::size_t ku, const std::size_t bs)
+{
+    std::uint32_t seed = 1;
+
+    // diagonally dominant triangular banded matrix
+    std::vector<real_t> band, a;
+    make_banded_matrix(n, n, kl, ku, static_cast<real_t>(kl + ku + 2), band, a, seed);
+    const fp_matrix a_compressed(band, kl + ku + 1, std::array<std::size_t, 2>({n, n}), kl, ku, bs);
+
+    // the reference uses the decompressed matrix
+    a_compressed.decompress(&a[0], n);
+
+    std::vector<real_t> x(n), y(n), y_ref(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+    }
+
+    for (const bool transpose : {false, true})
+    {
+        const real_t alpha = 1.3;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            y_ref[i] = x[i] / alpha;
+        }
+        fw::blas::trsv(layout, (kl == 0 ? CblasUpper : CblasLower), (transpose ? CblasTrans : CblasNoTrans), CblasNonUnit, n, &a[0], n, &y_ref[0], 1);
+
+        a_compressed.triangular_solve(transpose, alpha, y, x);
+
+        // correctness: relative to the largest output element
+        double y_max = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            y_max = std::max(y_max, static_cast<double>(std::abs(y_ref[i])));
+        }
+        double dev = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            dev = std::max(dev, std::abs(y[i] - y_ref[i]) / y_max);
+        }
+        std::cout << "triangular solve (" << (kl == 0 ? "upper" : "lower") << ", transpose: " << (transpose ? "true" : "false") << "): deviation: " << dev << std::endl;
+    }
+}
+#endif
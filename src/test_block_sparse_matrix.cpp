@@ -0,0 +1,349 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <memory>
+#include <omp.h>
+#include <fp/fp_blas.hpp>
+
+#if defined(THREAD_PINNING)
+#include <sched.h>
+#include <sys/sysinfo.h>
+#endif
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+// number of bits to be used for exponent and mantissa
+#if defined(_BE)
+static constexpr std::uint32_t BE = _BE;
+#else
+static constexpr std::uint32_t BE = 0;
+#endif
+
+#if defined(_BM)
+static constexpr std::uint32_t BM = _BM;
+#else
+static constexpr std::uint32_t BM = 16;
+#endif
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+static constexpr CBLAS_LAYOUT layout = (L == fw::blas::matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+// compressed matrix data type
+using fp_matrix = typename fw::blas::block_sparse_matrix<real_t, L, BM, BE>;
+
+constexpr std::size_t m_default = 1024;
+constexpr std::size_t n_default = 1024;
+constexpr std::size_t num_matrices_default = 16;
+constexpr std::size_t bs_default = 32;
+constexpr std::size_t num_blocks_per_row_default = 4;
+constexpr std::size_t num_vectors = 4;
+
+#if defined(BENCHMARK)
+constexpr std::size_t warmup = 5;
+constexpr std::size_t measurement = 10;
+constexpr bool transpose_benchmark = false;
+#else
+constexpr std::size_t warmup = 0;
+constexpr std::size_t measurement = 1;
+#endif
+
+void kernel(const real_t alpha, const real_t beta, const bool transpose,
+    const std::size_t m, const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y,
+    const bool use_threads_per_matrix = false);
+
+int main(int argc, char** argv)
+{
+    // read command line arguments
+    const std::size_t m = (argc > 1 ? atoi(argv[1]) : m_default);
+    const std::size_t n = (argc > 2 ? atoi(argv[2]) : n_default);
+    const std::size_t num_matrices = (argc > 3 ? atoi(argv[3]) : num_matrices_default);
+    const std::size_t bs = (argc > 4 ? atoi(argv[4]) : bs_default);
+    // number of nonzero blocks per block row: the diagonal block, its neighbors, and some randomly placed blocks
+    const std::size_t num_blocks_per_row = (argc > 5 ? atoi(argv[5]) : num_blocks_per_row_default);
+    const bool use_threads_per_matrix = (argc > 6 ? (atoi(argv[6]) != 0 ? true : false) : false);
+
+    std::cout << "matrix multiply: " << m << " x " << n << std::endl;
+    std::cout << "nonzero blocks per block row: " << num_blocks_per_row << std::endl;
+    std::cout << "num matrices: " << num_matrices << std::endl;
+    std::cout << "block size: " << bs << std::endl;
+    std::cout << "parallelism: " << (use_threads_per_matrix ? "within matrices" : "across matrices") << std::endl;
+
+#if defined(THREAD_PINNING)
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        const std::size_t num_cpus = get_nprocs_conf();
+
+        cpu_set_t cpu_mask;
+        CPU_ZERO(&cpu_mask);
+        CPU_SET(thread_id % num_cpus, &cpu_mask);
+        sched_setaffinity(0, sizeof(cpu_mask), &cpu_mask);
+    }
+#endif
+
+    // create matrices and vectors: the nonzero blocks are given in block compressed sparse row format
+    const std::size_t num_block_rows = (m + bs - 1) / bs;
+    const std::size_t num_block_cols = (n + bs - 1) / bs;
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    std::vector<std::vector<real_t>> a(num_matrices), x(num_matrices), y_ref(num_matrices), y(num_matrices);
+    std::vector<std::unique_ptr<fp_matrix>> a_compressed(num_matrices);
+
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        std::uint32_t seed = 1 + thread_id;
+
+        #pragma omp for schedule(static)
+        for (std::size_t k = 0; k < num_matrices; ++k)
+        {
+            std::vector<std::size_t> block_row_ptr(1, 0), block_col_idx;
+            for (std::size_t bj = 0; bj < num_block_rows; ++bj)
+            {
+                std::vector<bool> is_nonzero(num_block_cols, false);
+                for (std::size_t l = 0; l < num_blocks_per_row && l < num_block_cols; ++l)
+                {
+                    // the band first, then random block columns
+                    std::size_t bi = (bj + l + num_block_cols - 1) % num_block_cols;
+                    if (l > 2 || is_nonzero[bi])
+                    {
+                        while (is_nonzero[bi = rand_r(&seed) % num_block_cols]);
+                    }
+                    is_nonzero[bi] = true;
+                }
+
+                for (std::size_t bi = 0; bi < num_block_cols; ++bi)
+                {
+                    if (is_nonzero[bi]) block_col_idx.push_back(bi);
+                }
+                block_row_ptr.push_back(block_col_idx.size());
+            }
+
+            std::vector<real_t> block_data(block_col_idx.size() * bs * bs);
+            for (std::size_t i = 0; i < block_data.size(); ++i)
+            {
+                block_data[i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+            }
+
+            a_compressed[k].reset(new fp_matrix(&block_data[0], block_row_ptr, block_col_idx, std::array<std::size_t, 2>({m, n}), bs));
+
+            // dense reference matrix
+            a[k].assign(m * n, 0.0);
+            for (std::size_t bj = 0; bj < num_block_rows; ++bj)
+            {
+                for (std::size_t b = block_row_ptr[bj]; b < block_row_ptr[bj + 1]; ++b)
+                {
+                    const std::size_t j = bj * bs;
+                    const std::size_t i = block_col_idx[b] * bs;
+                    for (std::size_t jj = 0; jj < std::min(m - j, bs); ++jj)
+                    {
+                        for (std::size_t ii = 0; ii < std::min(n - i, bs); ++ii)
+                        {
+                            a[k][fw::blas::idx<L>(j + jj, i + ii, lda)] = block_data[b * bs * bs + fw::blas::idx<L>(jj, ii, bs)];
+                        }
+                    }
+                }
+            }
+
+            const std::size_t mn = std::max(m, n);
+            x[k].resize(mn * num_vectors);
+            y_ref[k].resize(mn * num_vectors);
+            y[k].resize(mn * num_vectors);
+            for (std::size_t i = 0; i < (mn * num_vectors); ++i)
+            {
+                x[k][i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+            }
+        }
+    }
+
+#if !defined(BENCHMARK)
+    // compressing the dense matrix must give the same blocks
+    {
+        const fp_matrix a_dense(a[0], lda, std::array<std::size_t, 2>({m, n}), bs);
+        std::vector<real_t> tmp_1(m * n), tmp_2(m * n);
+        a_dense.decompress(&tmp_1[0], lda);
+        a_compressed[0]->decompress(&tmp_2[0], lda);
+        double dev = 0.0;
+        for (std::size_t i = 0; i < (m * n); ++i)
+        {
+            dev = std::max(dev, static_cast<double>(std::abs(tmp_1[i] - tmp_2[i])));
+        }
+        std::cout << "dense input: " << a_dense.num_blocks() << " vs. " << a_compressed[0]->num_blocks() << " blocks, deviation: " << dev << std::endl;
+    }
+#endif
+
+#if defined(BENCHMARK)
+    kernel(1.0, 0.0, transpose_benchmark, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+#else
+    kernel(1.0, 0.0, false, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+    kernel(1.0, 0.0, true, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+    kernel(-0.34, 1.1, false, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+    kernel(-0.34, 1.1, true, m, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+#endif
+
+    return 0;
+}
+
+void kernel(const real_t alpha, const real_t beta, const bool transpose,
+    const std::size_t m, const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y,
+    const bool use_threads_per_matrix)
+{
+    // print some information
+    std::size_t memory_footprint_bytes = 0;
+    std::size_t num_blocks = 0;
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        memory_footprint_bytes += a_compressed[k]->memory_footprint_bytes();
+        num_blocks += a_compressed[k]->num_blocks();
+    }
+    std::cout << "mode: block_sparse_matrix, BE = " << BE << ", BM = " << BM << " (matrix memory consumption: " << memory_footprint_bytes / (1024 * 1024) << " MiB, "
+        << (8.0 * memory_footprint_bytes) / (a.size() * m * n) << " bits per element, " << num_blocks / a.size() << " nonzero blocks per matrix)" << std::endl;
+    std::cout << "alpha: " << alpha << ", beta: " << beta << ", transpose: " << (transpose ? "true" : "false") << std::endl;
+
+    // reference computation
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    const std::size_t mn = std::max(m, n);
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t j = 0; j < y[k].size(); ++j)
+        {
+            y_ref[k][j] = 1.0;
+            y[k][j] = 1.0;
+        }
+        fw::blas::gemv(layout, (transpose ? CblasTrans : CblasNoTrans), m, n, alpha, &a[k][0], lda, &x[k][0], 1, beta, &y_ref[k][0], 1);
+    }
+
+    // own implementation
+    double time = 0.0;
+
+    if (use_threads_per_matrix)
+    {
+        const fw::blas::execution_policy policy = fw::blas::execution_policy::parallel;
+
+        for (std::size_t l = 0; l < warmup; ++l)
+        {
+            for (std::size_t k = 0; k < a.size(); ++k)
+            {
+                a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0], policy);
+            }
+        }
+
+        for (std::size_t l = 0; l < measurement; ++l)
+        {
+            for (std::size_t k = 0; k < a.size(); ++k)
+            {
+                double time_start = omp_get_wtime();
+                a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0], policy);
+                time += (omp_get_wtime() - time_start);
+            }
+        }
+
+        time *= omp_get_max_threads();
+    }
+    else
+    {
+        #pragma omp parallel
+        {
+            for (std::size_t l = 0; l < warmup; ++l)
+            {
+                #pragma omp for schedule(static)
+                for (std::size_t k = 0; k < a.size(); ++k)
+                {
+                    a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0]);
+                }
+            }
+
+            double time_accumulated = 0.0;
+            for (std::size_t l = 0; l < measurement; ++l)
+            {
+                #pragma omp for schedule(static)
+                for (std::size_t k = 0; k < a.size(); ++k)
+                {
+                    double time_start = omp_get_wtime();
+                    a_compressed[k]->matrix_vector(transpose, alpha, &x[k][0], beta, &y[k][0]);
+                    time_accumulated += (omp_get_wtime() - time_start);
+                }
+            }
+
+            #pragma omp atomic
+            time += time_accumulated;
+        }
+    }
+
+#if defined(BENCHMARK)
+    // output some metrics: only the nonzero blocks count
+    std::size_t num_elements = 0;
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t i = 0; i < (m * n); ++i)
+        {
+            num_elements += (a[k][i] != 0.0 ? 1 : 0);
+        }
+    }
+    const double gflops = measurement * 2 * num_elements / (time / omp_get_max_threads()) * 1.0E-9;
+    std::cout << "gflops: " << gflops << std::endl;
+#else
+    // correctness: relative to the largest output element
+    auto deviation = [&](const std::size_t num_vectors)
+    {
+        double dev = 0.0;
+        for (std::size_t k = 0; k < a.size(); ++k)
+        {
+            for (std::size_t c = 0; c < num_vectors; ++c)
+            {
+                double y_max = 0.0;
+                for (std::size_t j = 0; j < (transpose ? n : m); ++j)
+                {
+                    y_max = std::max(y_max, static_cast<double>(std::abs(y_ref[k][c * mn + j])));
+                }
+                for (std::size_t j = 0; j < (transpose ? n : m); ++j)
+                {
+                    dev = std::max(dev, std::abs(y[k][c * mn + j] - y_ref[k][c * mn + j]) / y_max);
+                }
+            }
+        }
+        return dev;
+    };
+    std::cout << "deviation: " << deviation(1) << std::endl;
+
+    // multiple vectors
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t j = 0; j < y[k].size(); ++j)
+        {
+            y_ref[k][j] = 1.0;
+            y[k][j] = 1.0;
+        }
+        for (std::size_t c = 0; c < num_vectors; ++c)
+        {
+            fw::blas::gemv(layout, (transpose ? CblasTrans : CblasNoTrans), m, n, alpha, &a[k][0], lda, &x[k][c * mn], 1, beta, &y_ref[k][c * mn], 1);
+        }
+        a_compressed[k]->matrix_multi_vector(transpose, alpha, &x[k][0], mn, num_vectors, beta, &y[k][0], mn);
+    }
+    std::cout << "deviation (" << num_vectors << " vectors): " << deviation(num_vectors) << std::endl;
+#endif
+}
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <cstdlib>
 #include <cstdint>
+#include <string>
 #include <vector>
 #include <omp.h>
 #if defined(UPPER_MATRIX) || defined(LOWER_MATRIX)
@@ -42,6 +43,44 @@ void kernel(const real_t alpha, const real_t beta, const bool transpose,
     std::vector<std::vector<real_t>>& y_ref,
     std::vector<std::vector<real_t>>& y);
 
+#if defined(BENCHMARK)
+constexpr std::size_t warmup = 2;
+constexpr std::size_t measurement = 10;
+
+// compressed matrix data type with a different 'BE' parameter, e.g. another layout of the compressed data
+#if defined(UPPER_MATRIX)
+template <std::uint32_t be>
+using fp_matrix_layout = typename fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::upper_triangular, BM, be>;
+#elif defined(LOWER_MATRIX)
+template <std::uint32_t be>
+using fp_matrix_layout = typename fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::lower_triangular, BM, be>;
+#else
+template <std::uint32_t be>
+using fp_matrix_layout = typename fw::blas::matrix<real_t, L, BM, be>;
+#endif
+
+template <std::uint32_t be>
+void benchmark(const std::string& name,
+    const extent_t extent,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::size_t>& lda,
+    const std::size_t bs);
+
+// bit-packed formats: compare against the lane-interleaved layout
+template <bool Enabled = fw::fp_stream<BM, BE>::is_bit_packed_type>
+typename std::enable_if<Enabled>::type benchmark_layouts(const extent_t extent, const std::vector<std::vector<real_t>>& a, const std::vector<std::size_t>& lda, const std::size_t bs)
+{
+    benchmark<BE>("bit-packed", extent, a, lda, bs);
+    benchmark<fw::lane_interleaved(BE)>("lane-interleaved", extent, a, lda, bs);
+}
+
+template <bool Enabled = fw::fp_stream<BM, BE>::is_bit_packed_type>
+typename std::enable_if<!Enabled>::type benchmark_layouts(const extent_t extent, const std::vector<std::vector<real_t>>& a, const std::vector<std::size_t>& lda, const std::size_t bs)
+{
+    benchmark<BE>("default", extent, a, lda, bs);
+}
+#endif
+
 int main(int argc, char** argv)
 {
     // read command line arguments
@@ -177,6 +216,10 @@ int main(int argc, char** argv)
         }
     }
 
+#if defined(BENCHMARK)
+    benchmark_layouts(extent, a, lda, bs);
+#endif
+
     {
         const real_t alpha = static_cast<real_t>(1.0);
         const real_t beta = static_cast<real_t>(0.0);
@@ -297,3 +340,64 @@ void kernel(const real_t alpha, const real_t beta, const bool transpose,
     }
     std::cout << "deviation: " << dev << " (" << v_1 << " vs. " << v_2 << ")" << std::endl;
 }
+
+#if defined(BENCHMARK)
+template <std::uint32_t be>
+void benchmark(const std::string& name,
+    const extent_t extent,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::size_t>& lda,
+    const std::size_t bs)
+{
+    using fp_matrix_t = fp_matrix_layout<be>;
+    using fp_type_t = typename fp_matrix_t::fp_type;
+
+    const std::size_t elements_fp_matrix = fp_matrix_t::memory_footprint_elements(extent, bs);
+    std::vector<fp_type_t> a_compressed(a.size() * elements_fp_matrix);
+    double time_compress = 0.0;
+    double time_decompress = 0.0;
+
+    #pragma omp parallel
+    {
+        std::vector<real_t> buffer;
+        double time_accumulated_compress = 0.0;
+        double time_accumulated_decompress = 0.0;
+
+        for (std::size_t l = 0; l < (warmup + measurement); ++l)
+        {
+            #pragma omp for schedule(static)
+            for (std::size_t k = 0; k < a.size(); ++k)
+            {
+                const std::size_t num_elements = lda[k] * (L == fw::blas::matrix_layout::rowmajor ? extent.front() : extent.back());
+                buffer.resize(num_elements);
+
+                double time_start = omp_get_wtime();
+                fp_matrix_t::compress(&a[k][0], lda[k], &a_compressed[k * elements_fp_matrix], extent, bs);
+                double time_stop = omp_get_wtime();
+                if (l >= warmup)
+                {
+                    time_accumulated_compress += (time_stop - time_start);
+                }
+
+                time_start = omp_get_wtime();
+                fp_matrix_t::decompress(&a_compressed[k * elements_fp_matrix], &buffer[0], lda[k], extent, bs);
+                time_stop = omp_get_wtime();
+                if (l >= warmup)
+                {
+                    time_accumulated_decompress += (time_stop - time_start);
+                }
+            }
+        }
+
+        #pragma omp atomic
+        time_compress += time_accumulated_compress;
+        #pragma omp atomic
+        time_decompress += time_accumulated_decompress;
+    }
+
+    // output some metrics: time per matrix
+    const double scale = 1.0E6 / (measurement * a.size());
+    std::cout << "layout: " << name << " (matrix memory consumption: " << a.size() * elements_fp_matrix * sizeof(fp_type_t) / (1024 * 1024) << " MiB)" << std::endl;
+    std::cout << "compress: " << time_compress * scale << " us, decompress: " << time_decompress * scale << " us (per matrix)" << std::endl;
+}
+#endif
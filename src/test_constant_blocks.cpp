@@ -0,0 +1,191 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <fp/fp_blas.hpp>
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+static constexpr CBLAS_LAYOUT layout = (L == fw::blas::matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+// the last block row and column hold a single row and column: the 1x1 corner block is constant by construction
+constexpr std::size_t m_default = 97;
+constexpr std::size_t n_default = 129;
+constexpr std::size_t bs_default = 32;
+
+// value of the elements of block (bj, bi): block (0, 1) is zero, blocks (0, 2) and (1, 1) are constant,
+// all other blocks are random
+real_t block_value(const std::size_t bj, const std::size_t bi, std::uint32_t& seed)
+{
+    if (bj == 0 && bi == 1) return 0.0;
+    if (bj == 0 && bi == 2) return 0.75;
+    if (bj == 1 && bi == 1) return -1.25;
+
+    return 0.9 + 0.2 * rand_r(&seed) / RAND_MAX;
+}
+
+//! \brief Compress and decompress a matrix with zero and constant blocks
+//!
+//! Zero and constant blocks must decompress exactly: if they are stored in the compressed stream
+//! (FP_CONSTANT_BLOCKS not defined), their value is converted to 'float' first.
+//! The matrix vector product is compared against gemv on the decompressed matrix.
+//!
+//! \tparam M compressed matrix type
+//! \param a_compressed compressed matrix
+//! \param a input matrix
+//! \param m number of rows
+//! \param n number of columns
+//! \param bs block size
+//! \return true if the check passed
+template <typename M>
+bool check_matrix(const M& a_compressed, const std::vector<real_t>& a, const std::size_t m, const std::size_t n, const std::size_t bs)
+{
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    std::vector<real_t> a_decompressed(a.size(), 0.0);
+    a_compressed.decompress(&a_decompressed[0], lda);
+
+    double dev_exact = 0.0;
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const std::size_t bj = j / bs;
+            const std::size_t bi = i / bs;
+            const bool corner = ((m % bs) == 1 && (n % bs) == 1 && j == (m - 1) && i == (n - 1));
+            if (!((bj == 0 && (bi == 1 || bi == 2)) || (bj == 1 && bi == 1) || corner)) continue;
+
+        #if defined(FP_CONSTANT_BLOCKS)
+            const real_t value = a[fw::blas::idx<L>(j, i, lda)];
+        #else
+            const real_t value = static_cast<float>(a[fw::blas::idx<L>(j, i, lda)]);
+        #endif
+            dev_exact = std::max(dev_exact, static_cast<double>(std::abs(a_decompressed[fw::blas::idx<L>(j, i, lda)] - value)));
+        }
+    }
+
+    std::uint32_t seed = 2;
+    std::vector<real_t> x(std::max(m, n));
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = 0.9 + 0.2 * rand_r(&seed) / RAND_MAX;
+    }
+
+    double dev_gemv = 0.0;
+    for (const bool transpose : {false, true})
+    {
+        std::vector<real_t> y_ref(std::max(m, n), 0.0), y(std::max(m, n), 0.0);
+        fw::blas::gemv(layout, (transpose ? CblasTrans : CblasNoTrans), m, n, 1.0, &a_decompressed[0], lda, &x[0], 1, 0.0, &y_ref[0], 1);
+        a_compressed.matrix_vector(transpose, 1.0, x, 0.0, y);
+
+        double y_max = 0.0;
+        for (std::size_t j = 0; j < y.size(); ++j)
+        {
+            y_max = std::max(y_max, static_cast<double>(std::abs(y_ref[j])));
+        }
+        for (std::size_t j = 0; j < y.size(); ++j)
+        {
+            dev_gemv = std::max(dev_gemv, static_cast<double>(std::abs(y[j] - y_ref[j])) / y_max);
+        }
+    }
+
+    std::cout << "\tzero and constant blocks: deviation: " << dev_exact << ", matrix vector: deviation: " << dev_gemv << std::endl;
+
+    return (dev_exact == 0.0 && dev_gemv <= 1.0E-3);
+}
+
+//! \brief Zero and constant blocks in the fixed point format with 'BM' bits
+//!
+//! \tparam BM number of bits of the fixed point format
+//! \param m number of rows
+//! \param n number of columns
+//! \param bs block size
+//! \return true if all checks passed
+template <std::uint32_t BM>
+bool check_format(const std::size_t m, const std::size_t n, const std::size_t bs)
+{
+    using fp_format = fw::fp_stream<BM, 0>;
+    bool passed = true;
+
+    std::cout << "fp_stream<" << BM << ", 0>" << std::endl;
+
+    // constant sequences: all words encode to zero and decode to the sequence value
+    std::vector<typename fp_format::type> data_compressed(fp_format::memory_footprint_elements(n));
+    std::vector<real_t> data_decompressed(n);
+    for (const real_t value : {0.0, 0.75, -1.25})
+    {
+        const std::vector<real_t> data(n, value);
+        fp_format::compress(&data[0], &data_compressed[0], n);
+        fp_format::decompress(&data_compressed[0], &data_decompressed[0], n);
+
+        double dev = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            dev = std::max(dev, static_cast<double>(std::abs(data_decompressed[i] - value)));
+        }
+        passed &= (dev == 0.0);
+
+        std::cout << "\tsequence of " << value << ": deviation: " << dev << std::endl;
+    }
+
+    // general matrix, and an upper triangular matrix with a constant diagonal block
+    std::uint32_t seed = 1;
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    std::vector<real_t> a(m * n), a_upper(m * m);
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            a[fw::blas::idx<L>(j, i, lda)] = block_value(j / bs, i / bs, seed);
+        }
+        for (std::size_t i = 0; i < m; ++i)
+        {
+            a_upper[fw::blas::idx<L>(j, i, m)] = (i < j ? 0.0 : block_value(j / bs, i / bs, seed));
+        }
+    }
+
+    std::cout << "\tmatrix:";
+    passed &= check_matrix(fw::blas::matrix<real_t, L, BM, 0>(a, lda, {m, n}, bs), a, m, n, bs);
+
+    std::cout << "\ttriangular_matrix:";
+    passed &= check_matrix(fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::upper_triangular, BM, 0>(a_upper, m, std::array<std::size_t, 1>({m}), bs), a_upper, m, m, bs);
+
+    return passed;
+}
+
+int main(int argc, char** argv)
+{
+    // read command line arguments
+    const std::size_t m = (argc > 1 ? atoi(argv[1]) : m_default);
+    const std::size_t n = (argc > 2 ? atoi(argv[2]) : n_default);
+    const std::size_t bs = (argc > 3 ? atoi(argv[3]) : bs_default);
+
+    std::cout << "matrix: " << m << " x " << n << ", block size: " << bs << std::endl;
+#if defined(FP_CONSTANT_BLOCKS)
+    std::cout << "zero and constant blocks: not stored" << std::endl;
+#else
+    std::cout << "zero and constant blocks: stored" << std::endl;
+#endif
+
+    // fixed point formats: constant input used to decode as 'a + 0.5 * step'
+    bool passed = true;
+    passed &= check_format<16>(m, n, bs);
+    passed &= check_format<8>(m, n, bs);
+    passed &= check_format<4>(m, n, bs);
+
+    return (passed ? 0 : 1);
+}
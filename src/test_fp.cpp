@@ -18,7 +18,7 @@ constexpr bool implementation_available(const std::size_t bm, const std::size_t
     const bool between_2bit_and_16bit = (be > 0 && bm > 0 && (be + bm) < 16);
     const bool no_compression = (be == fw::ieee754_fp<real_t>::be && bm == fw::ieee754_fp<real_t>::bm);
     const bool double_to_float = (std::is_same<real_t, double>::value && be == fw::ieee754_fp<float>::be && bm == fw::ieee754_fp<float>::bm);
-    const bool fixed_point = (be == 0 && (bm == 8 || bm == 16));
+    const bool fixed_point = (be == 0 && (bm == 4 || bm == 8 || bm == 16));
 
     return between_2bit_and_16bit || no_compression || double_to_float || fixed_point;
 }
@@ -37,7 +37,8 @@ void kernel(const mat_t alpha, const vec_t beta, const bool transpose,
     const std::vector<std::vector<vec_t>>& x,
     std::vector<std::vector<vec_t>>& y_ref,
     std::vector<std::vector<vec_t>>& y,
-    const bool use_blas = false);
+    const bool use_blas = false,
+    const bool use_threads_per_matrix = false);
 
 int main(int argc, char** argv)
 {
@@ -49,11 +50,13 @@ int main(int argc, char** argv)
     const bool use_blas = (argc > 5 ? (atoi(argv[5]) != 0 ? true : false) : false);
     const double f_scale = (argc > 6 ? atof(argv[6]) : 1.0);
     const double f_shift = (argc > 7 ? atof(argv[7]) : 0.0);
+    const bool use_threads_per_matrix = (argc > 8 ? (atoi(argv[8]) != 0 ? true : false) : false);
 
     std::cout << "matrix multiply: " << m << " x " << n << std::endl;
     std::cout << "matrix entries in range: " << -1.0 * std::abs(f_scale) + f_shift << " .. " << std::abs(f_scale) + f_shift << std::endl;
     std::cout << "num matrices: " << num_matrices << std::endl;
     std::cout << "block size: " << bs << std::endl;
+    std::cout << "parallelism: " << (use_threads_per_matrix ? "within matrices" : "across matrices") << std::endl;
 
 #if defined(THREAD_PINNING)
     #pragma omp parallel
@@ -114,66 +117,66 @@ int main(int argc, char** argv)
     const mat_t alpha = static_cast<mat_t>(1.0);
     const vec_t beta = static_cast<vec_t>(0.0);
     const bool transpose = transpose_benchmark;
-    kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+    kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
 #else
     {
         const mat_t alpha = static_cast<mat_t>(1.0);
         const vec_t beta = static_cast<vec_t>(0.0);
         const bool transpose = false;
-        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         }
     }
     {
         const mat_t alpha = static_cast<mat_t>(-1.1);
         const vec_t beta = static_cast<vec_t>(0.0);
         const bool transpose = false;
-        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         }
     }
     {
         const mat_t alpha = static_cast<mat_t>(0.0);
         const vec_t beta = static_cast<vec_t>(-0.5);
         const bool transpose = false;
-        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         }
     }
     {
         const mat_t alpha = static_cast<mat_t>(0.0);
         const vec_t beta = static_cast<vec_t>(0.0);
         const bool transpose = false;
-        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         }
     }
     {
         const mat_t alpha = static_cast<mat_t>(2.3);
         const vec_t beta = static_cast<vec_t>(0.0);
         const bool transpose = false;
-        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         }
     }
     {
         const mat_t alpha = static_cast<mat_t>(-0.34);
         const vec_t beta = static_cast<vec_t>(1.1);
         const bool transpose = false;
-        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+        kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas);
+            kernel(alpha, beta, transpose, m, n, a, a_compressed, x, y_ref, y, use_blas, use_threads_per_matrix);
         }
     }
 #endif
@@ -188,7 +191,8 @@ void kernel(const mat_t alpha, const vec_t beta, const bool transpose,
     const std::vector<std::vector<vec_t>>& x,
     std::vector<std::vector<vec_t>>& y_ref,
     std::vector<std::vector<vec_t>>& y,
-    const bool use_blas)
+    const bool use_blas,
+    const bool use_threads_per_matrix)
 {
     // print some information
     std::cout << "alpha: " << alpha << ", beta: " << beta << ", transpose: " << (transpose ? "true" : "false") << std::endl;
@@ -211,6 +215,33 @@ void kernel(const mat_t alpha, const vec_t beta, const bool transpose,
     // own implementation
     double time = 0.0;
 
+    if (use_threads_per_matrix && !use_blas)
+    {
+        // matrices are processed one after another, each of them using all threads
+        const fw::blas::execution_policy policy = fw::blas::execution_policy::parallel;
+        for (std::size_t l = 0; l < warmup; ++l)
+        {
+            for (std::size_t t = 0, k_offset = 0; t < a_compressed.size(); k_offset += a_compressed[t].size(), ++t)
+            {
+                for (std::size_t k = 0; k < a_compressed[t].size(); ++k)
+                {
+                    fp_matrix_vector(transpose, alpha, a_compressed[t][k], x[k_offset + k], beta, y[k_offset + k], policy);
+                }
+            }
+        }
+
+        for (std::size_t l = 0; l < measurement; ++l)
+        {
+            for (std::size_t t = 0, k_offset = 0; t < a_compressed.size(); k_offset += a_compressed[t].size(), ++t)
+            {
+                for (std::size_t k = 0; k < a_compressed[t].size(); ++k)
+                {
+                    time += fp_matrix_vector(transpose, alpha, a_compressed[t][k], x[k_offset + k], beta, y[k_offset + k], policy);
+                }
+            }
+        }
+    }
+    else
     #pragma omp parallel
     {
         const std::size_t thread_id = omp_get_thread_num();
@@ -268,7 +299,9 @@ void kernel(const mat_t alpha, const vec_t beta, const bool transpose,
 
 #if defined(BENCHMARK)
     // output some metrics
-    const double gflops = measurement * a.size() * 2 * m * n / (time / omp_get_max_threads()) * 1.0E-9;
+    // parallel within matrices: 'time' is the wall time, otherwise it has been accumulated over all threads
+    const double time_wall = (use_threads_per_matrix && !use_blas ? time : time / omp_get_max_threads());
+    const double gflops = measurement * a.size() * 2 * m * n / time_wall * 1.0E-9;
     std::cout << "gflops: " << gflops << std::endl;
 #else
     // correctness
@@ -0,0 +1,163 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <fp/fp_blas.hpp>
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+// number of bits to be used for exponent and mantissa
+#if defined(_BE)
+static constexpr std::uint32_t BE = _BE;
+#else
+static constexpr std::uint32_t BE = 11;
+#endif
+
+#if defined(_BM)
+static constexpr std::uint32_t BM = _BM;
+#else
+static constexpr std::uint32_t BM = 52;
+#endif
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+// compressed matrix data type
+#if defined(UPPER_MATRIX)
+static constexpr fw::blas::matrix_type MT = fw::blas::matrix_type::upper_triangular;
+using fp_matrix = typename fw::blas::triangular_matrix<real_t, L, MT, BM, BE>;
+#elif defined(LOWER_MATRIX)
+static constexpr fw::blas::matrix_type MT = fw::blas::matrix_type::lower_triangular;
+using fp_matrix = typename fw::blas::triangular_matrix<real_t, L, MT, BM, BE>;
+#else
+static constexpr fw::blas::matrix_type MT = fw::blas::matrix_type::general;
+using fp_matrix = typename fw::blas::matrix<real_t, L, BM, BE>;
+#endif
+
+// extents are not a multiple of the block size: the last block row and column are smaller
+constexpr std::size_t m_default = 203;
+constexpr std::size_t n_default = 150;
+constexpr std::size_t bs_default = 32;
+
+int main(int argc, char** argv)
+{
+    // read command line arguments: triangular matrices are 'n x n'
+    const std::size_t n = (argc > 2 ? atoi(argv[2]) : n_default);
+    const std::size_t m = (MT != fw::blas::matrix_type::general ? n : (argc > 1 ? atoi(argv[1]) : m_default));
+    const std::size_t bs = (argc > 3 ? atoi(argv[3]) : bs_default);
+
+    std::cout << "block access: " << m << " x " << n << ", block size: " << bs << std::endl;
+#if defined(FP_BLOCK_OFFSET_TABLE)
+    std::cout << "block offsets: table" << std::endl;
+#else
+    std::cout << "block offsets: computed" << std::endl;
+#endif
+
+    // create and compress the matrix: the other triangle of triangular matrices is zero
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    std::vector<real_t> a(lda * (L == fw::blas::matrix_layout::rowmajor ? m : n));
+    std::uint32_t seed = 1;
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const bool zero = (MT == fw::blas::matrix_type::upper_triangular && i < j) || (MT == fw::blas::matrix_type::lower_triangular && i > j);
+            a[fw::blas::idx<L>(j, i, lda)] = (zero ? 0.0 : 2.0 * rand_r(&seed) / RAND_MAX - 1.0);
+        }
+    }
+
+#if defined(UPPER_MATRIX) || defined(LOWER_MATRIX)
+    const fp_matrix a_compressed(a, lda, std::array<std::size_t, 1>({n}), bs);
+#else
+    const fp_matrix a_compressed(a, lda, {m, n}, bs);
+#endif
+
+    std::vector<real_t> a_decompressed(a.size(), 0.0);
+    a_compressed.decompress(&a_decompressed[0], lda);
+
+    // all existing blocks, accessed in random order
+    const std::size_t num_blocks_m = (m + bs - 1) / bs;
+    const std::size_t num_blocks_n = (n + bs - 1) / bs;
+    std::vector<std::array<std::size_t, 2>> blocks;
+    for (std::size_t bj = 0; bj < num_blocks_m; ++bj)
+    {
+        for (std::size_t bi = 0; bi < num_blocks_n; ++bi)
+        {
+            if (MT == fw::blas::matrix_type::upper_triangular && bi < bj) continue;
+            if (MT == fw::blas::matrix_type::lower_triangular && bi > bj) continue;
+
+            blocks.push_back({bj, bi});
+        }
+    }
+    for (std::size_t k = blocks.size(); k > 1; --k)
+    {
+        std::swap(blocks[k - 1], blocks[rand_r(&seed) % k]);
+    }
+
+    // decompress each block on its own: blocks are stored according to the matrix layout,
+    // diagonal blocks of triangular matrices hold the stored triangle only (packed format)
+    double dev = 0.0;
+    std::size_t num_missing = 0;
+    std::vector<real_t> buffer(bs * bs);
+    for (const auto& block : blocks)
+    {
+        const std::size_t bj = block[0];
+        const std::size_t bi = block[1];
+        const auto* ptr = a_compressed.get_block(bj, bi);
+        if (ptr == nullptr)
+        {
+            ++num_missing;
+            continue;
+        }
+
+        const std::size_t mm = std::min(m - bj * bs, bs);
+        const std::size_t nn = std::min(n - bi * bs, bs);
+        const bool packed = (MT != fw::blas::matrix_type::general && bj == bi);
+        fw::fp_stream<BM, BE>::decompress(ptr, &buffer[0], (packed ? (mm * (mm + 1)) / 2 : mm * nn));
+
+        const std::size_t outer = (L == fw::blas::matrix_layout::rowmajor ? mm : nn);
+        const std::size_t inner = (L == fw::blas::matrix_layout::rowmajor ? nn : mm);
+        for (std::size_t jj = 0, kk = 0; jj < outer; ++jj)
+        {
+            for (std::size_t ii = 0; ii < inner; ++ii)
+            {
+                const std::size_t j = bj * bs + (L == fw::blas::matrix_layout::rowmajor ? jj : ii);
+                const std::size_t i = bi * bs + (L == fw::blas::matrix_layout::rowmajor ? ii : jj);
+                if (packed && (MT == fw::blas::matrix_type::upper_triangular ? i < j : i > j)) continue;
+
+                dev = std::max(dev, static_cast<double>(std::abs(buffer[kk++] - a_decompressed[fw::blas::idx<L>(j, i, lda)])));
+            }
+        }
+    }
+    std::cout << "blocks: " << blocks.size() << ", missing: " << num_missing << std::endl;
+    std::cout << "deviation: " << dev << std::endl;
+
+    // non-existing blocks: out of range, or in the triangle that is not stored
+    std::vector<std::array<std::size_t, 2>> non_existing = {{num_blocks_m, 0}, {0, num_blocks_n}, {num_blocks_m, num_blocks_n}};
+    if (num_blocks_n > 1)
+    {
+        if (MT == fw::blas::matrix_type::upper_triangular) non_existing.push_back({1, 0});
+        if (MT == fw::blas::matrix_type::lower_triangular) non_existing.push_back({0, 1});
+    }
+    std::size_t num_accepted = 0;
+    for (const auto& block : non_existing)
+    {
+        num_accepted += (a_compressed.get_block(block[0], block[1]) != nullptr ? 1 : 0);
+    }
+    std::cout << "non-existing blocks: " << non_existing.size() << ", accepted: " << num_accepted << std::endl;
+
+    return ((dev == 0.0 && num_missing == 0 && num_accepted == 0) ? 0 : 1);
+}
@@ -0,0 +1,262 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <functional>
+#include <omp.h>
+#include <fp/fp_solver.hpp>
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+// number of bits to be used for exponent and mantissa
+#if defined(_BE)
+static constexpr std::uint32_t BE = _BE;
+#else
+static constexpr std::uint32_t BE = 8;
+#endif
+
+#if defined(_BM)
+static constexpr std::uint32_t BM = _BM;
+#else
+static constexpr std::uint32_t BM = 7;
+#endif
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+static constexpr CBLAS_LAYOUT layout = (L == fw::blas::matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+// compressed matrix data types
+using fp_matrix = typename fw::blas::matrix<real_t, L, BM, BE>;
+using fp_upper_matrix = typename fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::upper_triangular, BM, BE>;
+using fp_lower_matrix = typename fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::lower_triangular, BM, BE>;
+// reference: no compression
+using ieee_matrix = typename fw::blas::matrix<real_t, L>;
+
+constexpr std::size_t g_default = 32;
+constexpr std::size_t max_iterations_default = 1000;
+// restarted GMRES(30) without preconditioning stagnates for stronger convection
+constexpr double convection_default = 0.2;
+// the residual ||b - A * x|| / ||b|| (using the operator of the solve) may exceed the solver tolerance by this factor
+constexpr double max_residual_factor = 10.0;
+
+// create a (perturbed) 5-point stencil matrix on a 'g x g' grid: without convection, the matrix is symmetric positive definite
+void make_stencil_matrix(const std::size_t g, const double convection, std::vector<real_t>& a, std::uint32_t& seed);
+
+// split 'a' into its triangular parts: 'upper = D^(-1/2) * (D + U)' (symmetric Gauss-Seidel factor) and 'lower = D + L' (Gauss-Seidel)
+void make_preconditioner(const std::size_t n, const std::vector<real_t>& a, std::vector<real_t>& upper, std::vector<real_t>& lower);
+
+// relative residual ||b - A * x|| / ||b|| using the uncompressed matrix
+double true_residual(const std::size_t n, const std::vector<real_t>& a, const std::vector<real_t>& b, const std::vector<real_t>& x);
+
+// relative residual ||b - A * x|| / ||b|| using the operator of the solve, e.g. the compressed matrix
+template <typename M>
+double operator_residual(const M& a, const std::vector<real_t>& b, const std::vector<real_t>& x);
+
+bool print(const char* name, const fw::solver::solver_status& status, const double residual, const double tolerance, const double time);
+
+int main(int argc, char** argv)
+{
+    // read command line arguments
+    const std::size_t g = (argc > 1 ? atoi(argv[1]) : g_default);
+    const std::size_t max_iterations = (argc > 2 ? atoi(argv[2]) : max_iterations_default);
+    const double convection = (argc > 3 ? atof(argv[3]) : convection_default);
+    const std::size_t n = g * g;
+
+    std::cout << "grid: " << g << " x " << g << " (matrix: " << n << " x " << n << ")" << std::endl;
+    std::cout << "mode: BE = " << BE << ", BM = " << BM << std::endl;
+
+    std::uint32_t seed = 1;
+
+    std::vector<real_t> b(n), x(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        b[i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+    }
+
+    fw::solver::solver_control control;
+    control.max_iterations = max_iterations;
+    control.tolerance = 1.0E-6;
+
+    // the solve must converge, and the residual of the solution must be within the tolerance:
+    // Krylov methods w.r.t. the (compressed) operator they work on, iterative refinement w.r.t. the uncompressed matrix
+    bool passed = true;
+    auto run = [&](const char* name, const std::function<fw::solver::solver_status()>& solve, const std::function<double()>& residual, const double tolerance)
+    {
+        std::fill(x.begin(), x.end(), 0.0);
+        const double time_start = omp_get_wtime();
+        const fw::solver::solver_status status = solve();
+        const double time = omp_get_wtime() - time_start;
+        passed &= print(name, status, residual(), tolerance, time);
+    };
+
+    // symmetric positive definite matrix
+    {
+        std::vector<real_t> a, upper, lower;
+        make_stencil_matrix(g, 0.0, a, seed);
+        make_preconditioner(n, a, upper, lower);
+
+        const fp_matrix a_compressed(a, n, std::array<std::size_t, 2>({n, n}));
+        const fp_upper_matrix a_upper(a, n, std::array<std::size_t, 1>({n}));
+        const fp_upper_matrix r_compressed(upper, n, std::array<std::size_t, 1>({n}));
+        const ieee_matrix a_ieee(a, n, std::array<std::size_t, 2>({n, n}));
+        const auto a_symmetric = fw::solver::make_symmetric_operator(a_upper);
+        const auto preconditioner = fw::solver::make_triangular_preconditioner(r_compressed, true);
+
+        auto residual = [&] { return operator_residual(a_compressed, b, x); };
+        auto residual_symmetric = [&] { return operator_residual(a_symmetric, b, x); };
+        auto residual_ieee = [&] { return true_residual(n, a, b, x); };
+
+        std::cout << "symmetric positive definite matrix" << std::endl;
+        run("cg", [&] { return fw::solver::cg(a_compressed, b, x, control); }, residual, control.tolerance);
+        run("cg (symmetric operator)", [&] { return fw::solver::cg(a_symmetric, b, x, control); }, residual_symmetric, control.tolerance);
+        run("cg (symmetric gauss-seidel)", [&] { return fw::solver::cg(a_compressed, b, x, control, preconditioner); }, residual, control.tolerance);
+
+        // iterative refinement: compressed operator for the inner solve
+        fw::solver::solver_control outer_control;
+        outer_control.max_iterations = 20;
+        outer_control.tolerance = 1.0E-12;
+        fw::solver::solver_control inner_control = control;
+        inner_control.tolerance = 1.0E-2;
+        run("iterative refinement (cg, symmetric gauss-seidel)", [&] { return fw::solver::iterative_refinement(fw::solver::krylov_method::cg, a_ieee, a_compressed, b, x, outer_control, inner_control, preconditioner); }, residual_ieee, outer_control.tolerance);
+    }
+
+    // nonsymmetric matrix
+    {
+        std::vector<real_t> a, upper, lower;
+        make_stencil_matrix(g, convection, a, seed);
+        make_preconditioner(n, a, upper, lower);
+
+        const fp_matrix a_compressed(a, n, std::array<std::size_t, 2>({n, n}));
+        const fp_lower_matrix l_compressed(lower, n, std::array<std::size_t, 1>({n}));
+        const ieee_matrix a_ieee(a, n, std::array<std::size_t, 2>({n, n}));
+        const auto preconditioner = fw::solver::make_triangular_preconditioner(l_compressed);
+
+        auto residual = [&] { return operator_residual(a_compressed, b, x); };
+        auto residual_ieee = [&] { return true_residual(n, a, b, x); };
+
+        std::cout << "nonsymmetric matrix (convection: " << convection << ")" << std::endl;
+        run("bicgstab", [&] { return fw::solver::bicgstab(a_compressed, b, x, control); }, residual, control.tolerance);
+        run("bicgstab (gauss-seidel)", [&] { return fw::solver::bicgstab(a_compressed, b, x, control, preconditioner); }, residual, control.tolerance);
+        run("gmres", [&] { return fw::solver::gmres(a_compressed, b, x, control); }, residual, control.tolerance);
+        run("gmres (gauss-seidel)", [&] { return fw::solver::gmres(a_compressed, b, x, control, preconditioner); }, residual, control.tolerance);
+
+        fw::solver::solver_control outer_control;
+        outer_control.max_iterations = 20;
+        outer_control.tolerance = 1.0E-12;
+        fw::solver::solver_control inner_control = control;
+        inner_control.tolerance = 1.0E-2;
+        run("iterative refinement (bicgstab, gauss-seidel)", [&] { return fw::solver::iterative_refinement(fw::solver::krylov_method::bicgstab, a_ieee, a_compressed, b, x, outer_control, inner_control, preconditioner); }, residual_ieee, outer_control.tolerance);
+        run("iterative refinement (gmres, gauss-seidel)", [&] { return fw::solver::iterative_refinement(fw::solver::krylov_method::gmres, a_ieee, a_compressed, b, x, outer_control, inner_control, preconditioner); }, residual_ieee, outer_control.tolerance);
+    }
+
+    return (passed ? 0 : 1);
+}
+
+void make_stencil_matrix(const std::size_t g, const double convection, std::vector<real_t>& a, std::uint32_t& seed)
+{
+    const std::size_t n = g * g;
+    a.assign(n * n, 0.0);
+
+    // off-diagonal elements: the perturbation is symmetric, the convection is not
+    auto set = [&](const std::size_t j, const std::size_t i, const double value)
+    {
+        const double perturbation = 0.2 * rand_r(&seed) / RAND_MAX - 0.1;
+        a[fw::blas::idx<L>(j, i, n)] = value * (1.0 + perturbation) - convection;
+        a[fw::blas::idx<L>(i, j, n)] = value * (1.0 + perturbation) + convection;
+    };
+
+    for (std::size_t y = 0; y < g; ++y)
+    {
+        for (std::size_t x = 0; x < g; ++x)
+        {
+            const std::size_t j = y * g + x;
+            if (x > 0) set(j, j - 1, -1.0);
+            if (y > 0) set(j, j - g, -1.0);
+        }
+    }
+
+    // diagonal: weakly diagonally dominant
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            sum += (i != j ? std::abs(a[fw::blas::idx<L>(j, i, n)]) : 0.0);
+        }
+        a[fw::blas::idx<L>(j, j, n)] = sum + 0.01;
+    }
+}
+
+void make_preconditioner(const std::size_t n, const std::vector<real_t>& a, std::vector<real_t>& upper, std::vector<real_t>& lower)
+{
+    upper.assign(n * n, 0.0);
+    lower.assign(n * n, 0.0);
+
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        const double d = a[fw::blas::idx<L>(j, j, n)];
+        for (std::size_t i = j; i < n; ++i)
+        {
+            upper[fw::blas::idx<L>(j, i, n)] = a[fw::blas::idx<L>(j, i, n)] / std::sqrt(d);
+            lower[fw::blas::idx<L>(i, j, n)] = a[fw::blas::idx<L>(i, j, n)];
+        }
+    }
+}
+
+double true_residual(const std::size_t n, const std::vector<real_t>& a, const std::vector<real_t>& b, const std::vector<real_t>& x)
+{
+    std::vector<real_t> r(b);
+    fw::blas::gemv(layout, CblasNoTrans, n, n, -1.0, &a[0], n, &x[0], 1, 1.0, &r[0], 1);
+
+    double rr = 0.0, bb = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        rr += r[i] * r[i];
+        bb += b[i] * b[i];
+    }
+
+    return std::sqrt(rr / bb);
+}
+
+template <typename M>
+double operator_residual(const M& a, const std::vector<real_t>& b, const std::vector<real_t>& x)
+{
+    std::vector<real_t> r(b);
+    a.matrix_vector(false, -1.0, &x[0], 1.0, &r[0]);
+
+    double rr = 0.0, bb = 0.0;
+    for (std::size_t i = 0; i < b.size(); ++i)
+    {
+        rr += r[i] * r[i];
+        bb += b[i] * b[i];
+    }
+
+    return std::sqrt(rr / bb);
+}
+
+bool print(const char* name, const fw::solver::solver_status& status, const double residual, const double tolerance, const double time)
+{
+    const bool passed = status.converged && status.residual <= tolerance && residual <= max_residual_factor * tolerance;
+
+    std::cout << name << ": " << (status.converged ? "converged" : "not converged") << ", iterations: " << status.iterations;
+    if (status.inner_iterations > 0)
+    {
+        std::cout << " (inner: " << status.inner_iterations << ")";
+    }
+    std::cout << ", residual: " << status.residual << ", true residual: " << residual << ", time: " << time << "s\t" << (passed ? "passed" : "failed") << std::endl;
+
+    return passed;
+}
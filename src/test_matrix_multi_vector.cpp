@@ -0,0 +1,149 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <fp/fp_blas.hpp>
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+// number of bits to be used for exponent and mantissa
+#if defined(_BE)
+static constexpr std::uint32_t BE = _BE;
+#else
+static constexpr std::uint32_t BE = 11;
+#endif
+
+#if defined(_BM)
+static constexpr std::uint32_t BM = _BM;
+#else
+static constexpr std::uint32_t BM = 52;
+#endif
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+// compressed matrix data type
+#if defined(UPPER_MATRIX)
+static constexpr bool upper_matrix = true;
+using fp_matrix = typename fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::upper_triangular, BM, BE>;
+#elif defined(LOWER_MATRIX)
+static constexpr bool upper_matrix = false;
+using fp_matrix = typename fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::lower_triangular, BM, BE>;
+#else
+using fp_matrix = typename fw::blas::matrix<real_t, L, BM, BE>;
+#endif
+
+constexpr std::size_t m_default = 203;
+constexpr std::size_t n_default = 150;
+constexpr std::size_t bs_default = 32;
+
+// number of vectors: a single vector, fewer and more vectors than the block size
+constexpr std::size_t num_vectors[] = {1, 3, 8, 17, 40};
+
+// both paths apply the same compressed blocks: gemm vs. gemv only changes the summation order,
+// unless the integer gemv quantizes the vectors
+#if defined(FP_INTEGER_GEMV) && defined(FP_INTEGER_GEMV_QUANTIZED)
+constexpr double max_dev = 1.0E-3;
+#else
+constexpr double max_dev = 1.0E-10;
+#endif
+
+int main(int argc, char** argv)
+{
+    // read command line arguments
+#if defined(UPPER_MATRIX) || defined(LOWER_MATRIX)
+    const std::size_t n = (argc > 1 ? atoi(argv[1]) : n_default);
+    const std::size_t m = n;
+    const std::size_t bs = (argc > 2 ? atoi(argv[2]) : bs_default);
+    std::cout << "triangular matrix multi vector: " << n << " x " << n << " (" << (upper_matrix ? "upper)" : "lower)") << std::endl;
+#else
+    const std::size_t m = (argc > 1 ? atoi(argv[1]) : m_default);
+    const std::size_t n = (argc > 2 ? atoi(argv[2]) : n_default);
+    const std::size_t bs = (argc > 3 ? atoi(argv[3]) : bs_default);
+    std::cout << "matrix multi vector: " << m << " x " << n << std::endl;
+#endif
+    std::cout << "block size: " << bs << std::endl;
+
+    // create and compress the matrix
+    const std::size_t lda = (L == fw::blas::matrix_layout::rowmajor ? n : m);
+    std::vector<real_t> a(lda * (L == fw::blas::matrix_layout::rowmajor ? m : n));
+    std::uint32_t seed = 1;
+    for (std::size_t j = 0; j < m; ++j)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+        #if defined(UPPER_MATRIX) || defined(LOWER_MATRIX)
+            const bool zero = (upper_matrix ? i < j : i > j);
+        #else
+            const bool zero = false;
+        #endif
+            a[fw::blas::idx<L>(j, i, lda)] = (zero ? 0.0 : 2.0 * rand_r(&seed) / RAND_MAX - 1.0);
+        }
+    }
+
+#if defined(UPPER_MATRIX) || defined(LOWER_MATRIX)
+    const fp_matrix a_compressed(a, lda, std::array<std::size_t, 1>({n}), bs);
+#else
+    const fp_matrix a_compressed(a, lda, {m, n}, bs);
+#endif
+
+    const real_t alpha = -0.34;
+    const real_t beta = 1.1;
+    bool passed = true;
+
+    for (const bool transpose : {false, true})
+    {
+        // the vectors are stored one after another: the padding between them must not be touched
+        const std::size_t ldx = (transpose ? m : n) + 3;
+        const std::size_t ldy = (transpose ? n : m) + 5;
+
+        for (const std::size_t k : num_vectors)
+        {
+            std::vector<real_t> x(ldx * k), y(ldy * k);
+            for (std::size_t i = 0; i < x.size(); ++i)
+            {
+                x[i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+            }
+            for (std::size_t i = 0; i < y.size(); ++i)
+            {
+                y[i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+            }
+
+            // reference: one matrix vector multiply per vector
+            std::vector<real_t> y_ref(y);
+            for (std::size_t c = 0; c < k; ++c)
+            {
+                a_compressed.matrix_vector(transpose, alpha, &x[c * ldx], beta, &y_ref[c * ldy]);
+            }
+
+            a_compressed.matrix_multi_vector(transpose, alpha, &x[0], ldx, k, beta, &y[0], ldy);
+
+            // relative to the largest output element
+            double dev = 0.0;
+            double y_max = 0.0;
+            for (std::size_t j = 0; j < y.size(); ++j)
+            {
+                dev = std::max(dev, static_cast<double>(std::abs(y[j] - y_ref[j])));
+                y_max = std::max(y_max, static_cast<double>(std::abs(y_ref[j])));
+            }
+            dev /= y_max;
+            passed &= (dev <= max_dev);
+
+            std::cout << "vectors: " << k << (transpose ? " (transpose)" : "") << ", deviation: " << dev << std::endl;
+        }
+    }
+
+    return (passed ? 0 : 1);
+}
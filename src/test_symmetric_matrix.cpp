@@ -0,0 +1,423 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <memory>
+#include <omp.h>
+#include <fp/fp_blas.hpp>
+
+#if defined(THREAD_PINNING)
+#include <sched.h>
+#include <sys/sysinfo.h>
+#endif
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+// number of bits to be used for exponent and mantissa
+#if defined(_BE)
+static constexpr std::uint32_t BE = _BE;
+#else
+static constexpr std::uint32_t BE = 11;
+#endif
+
+#if defined(_BM)
+static constexpr std::uint32_t BM = _BM;
+#else
+static constexpr std::uint32_t BM = 52;
+#endif
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+static constexpr CBLAS_LAYOUT layout = (L == fw::blas::matrix_layout::rowmajor ? CblasRowMajor : CblasColMajor);
+
+// compressed matrix data type
+using fp_matrix = typename fw::blas::symmetric_matrix<real_t, L, BM, BE>;
+
+constexpr std::size_t n_default = 1024;
+constexpr std::size_t num_matrices_default = 16;
+constexpr std::size_t bs_default = 32;
+constexpr std::size_t num_vectors = 4;
+
+#if defined(BENCHMARK)
+constexpr std::size_t warmup = 5;
+constexpr std::size_t measurement = 10;
+#else
+constexpr std::size_t warmup = 0;
+constexpr std::size_t measurement = 1;
+#endif
+
+double kernel(const real_t alpha, const real_t beta,
+    const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y,
+    const bool use_threads_per_matrix = false);
+
+#if defined(BENCHMARK)
+void kernel_gemv(const real_t alpha, const real_t beta,
+    const std::size_t n, const std::size_t bs,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y,
+    const bool use_threads_per_matrix,
+    const double time_spmv);
+#endif
+
+//! \brief Symmetric matrix vector multiply in a format with fused decompression and matrix vector multiplication
+//!
+//! Off-diagonal blocks are applied together with their transpose by 'matrix_vector_symmetric_fused' (if the CPU supports AVX2).
+//! The reference is gemv on the decompressed matrix, which holds the same (compressed) values.
+//!
+//! \tparam BM_ bits mantissa
+//! \tparam BE_ bits exponent
+//! \param a symmetric input matrix
+//! \param x input vector
+//! \param n extent of the matrix
+//! \param bs block size
+//! \return true if the deviation is within the rounding errors
+template <std::uint32_t BM_, std::uint32_t BE_>
+bool check_fused(const std::vector<real_t>& a, const std::vector<real_t>& x, const std::size_t n, const std::size_t bs)
+{
+    const fw::blas::symmetric_matrix<real_t, L, BM_, BE_> a_compressed(a, n, std::array<std::size_t, 1>({n}), bs);
+    std::vector<real_t> a_decompressed(n * n);
+    a_compressed.decompress(&a_decompressed[0], n);
+
+    std::vector<real_t> y_ref(n, 1.0), y(n, 1.0);
+    fw::blas::gemv(layout, CblasNoTrans, n, n, -0.34, &a_decompressed[0], n, &x[0], 1, 1.1, &y_ref[0], 1);
+    a_compressed.spmv(-0.34, &x[0], 1.1, &y[0]);
+
+    double dev = 0.0;
+    double y_max = 0.0;
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        dev = std::max(dev, static_cast<double>(std::abs(y[j] - y_ref[j])));
+        y_max = std::max(y_max, static_cast<double>(std::abs(y_ref[j])));
+    }
+    dev /= y_max;
+
+    std::cout << "fused kernel, BE = " << BE_ << ", BM = " << BM_ << ": deviation: " << dev << std::endl;
+
+    return (dev <= 1.0E-10);
+}
+
+int main(int argc, char** argv)
+{
+    // read command line arguments
+    const std::size_t n = (argc > 1 ? atoi(argv[1]) : n_default);
+    const std::size_t num_matrices = (argc > 2 ? atoi(argv[2]) : num_matrices_default);
+    const std::size_t bs = (argc > 3 ? atoi(argv[3]) : bs_default);
+    const bool use_threads_per_matrix = (argc > 4 ? (atoi(argv[4]) != 0 ? true : false) : false);
+
+    std::cout << "matrix multiply: " << n << " x " << n << " (symmetric)" << std::endl;
+    std::cout << "num matrices: " << num_matrices << std::endl;
+    std::cout << "block size: " << bs << std::endl;
+    std::cout << "parallelism: " << (use_threads_per_matrix ? "within matrices" : "across matrices") << std::endl;
+
+#if defined(THREAD_PINNING)
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        const std::size_t num_cpus = get_nprocs_conf();
+
+        cpu_set_t cpu_mask;
+        CPU_ZERO(&cpu_mask);
+        CPU_SET(thread_id % num_cpus, &cpu_mask);
+        sched_setaffinity(0, sizeof(cpu_mask), &cpu_mask);
+    }
+#endif
+
+    // create matrices and vectors
+    std::vector<std::vector<real_t>> a(num_matrices), x(num_matrices), y_ref(num_matrices), y(num_matrices);
+    std::vector<std::unique_ptr<fp_matrix>> a_compressed(num_matrices);
+
+    #pragma omp parallel
+    {
+        const std::size_t thread_id = omp_get_thread_num();
+        std::uint32_t seed = 1 + thread_id;
+
+        #pragma omp for schedule(static)
+        for (std::size_t k = 0; k < num_matrices; ++k)
+        {
+            a[k].resize(n * n);
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                for (std::size_t i = j; i < n; ++i)
+                {
+                    a[k][j * n + i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+                    a[k][i * n + j] = a[k][j * n + i];
+                }
+            }
+
+            a_compressed[k].reset(new fp_matrix(a[k], n, std::array<std::size_t, 1>({n}), bs));
+
+            x[k].resize(n * num_vectors);
+            y_ref[k].resize(n * num_vectors);
+            y[k].resize(n * num_vectors);
+            for (std::size_t i = 0; i < (n * num_vectors); ++i)
+            {
+                x[k][i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+            }
+        }
+    }
+
+#if !defined(BENCHMARK)
+    // the input matrix must be symmetric
+    if (n > 1)
+    {
+        std::vector<real_t> tmp(a[0]);
+        tmp[1] += 1.0;
+        bool rejected = false;
+        try
+        {
+            const fp_matrix a_asymmetric(tmp, n, std::array<std::size_t, 1>({n}), bs);
+        }
+        catch (const std::exception&)
+        {
+            rejected = true;
+        }
+        std::cout << "asymmetric input: " << (rejected ? "rejected" : "accepted (error)") << std::endl;
+    }
+
+    // the packed upper triangular matrix stores the same blocks
+    {
+        const fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::upper_triangular, BM, BE> a_triangular(&a[0][0], n, std::array<std::size_t, 1>({n}), bs);
+        std::vector<real_t> y_1(n, 1.0), y_2(n, 1.0);
+        a_triangular.symmetric_matrix_vector(0.5, &x[0][0], 1.0, &y_1[0]);
+        a_compressed[0]->spmv(0.5, &x[0][0], 1.0, &y_2[0]);
+        double dev = 0.0;
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            dev = std::max(dev, std::abs((y_2[j] - y_1[j]) / y_1[j]));
+        }
+        std::cout << "triangular_matrix::symmetric_matrix_vector: deviation: " << dev << std::endl;
+    }
+
+    // fused kernel: bfloat16 and a bit-packed format
+    bool passed = true;
+    passed &= check_fused<7, 8>(a[0], x[0], n, bs);
+    passed &= check_fused<7, 4>(a[0], x[0], n, bs);
+#endif
+
+#if defined(BENCHMARK)
+    const double time = kernel(1.0, 0.0, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+    kernel_gemv(1.0, 0.0, n, bs, a, x, y, use_threads_per_matrix, time);
+#else
+    kernel(1.0, 0.0, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+    kernel(-0.34, 1.1, n, a, a_compressed, x, y_ref, y, use_threads_per_matrix);
+#endif
+
+#if defined(BENCHMARK)
+    return 0;
+#else
+    return (passed ? 0 : 1);
+#endif
+}
+
+//! \brief Wall time of 'f(k, policy)' applied to all matrices 'k'
+//!
+//! \param num_matrices number of matrices
+//! \param use_threads_per_matrix parallelism within (true) or across (false) matrices
+//! \param f kernel
+//! \return wall time for all measurements
+template <typename F>
+double measure(const std::size_t num_matrices, const bool use_threads_per_matrix, const F& f)
+{
+    double time = 0.0;
+
+    if (use_threads_per_matrix)
+    {
+        const fw::blas::execution_policy policy = fw::blas::execution_policy::parallel;
+
+        for (std::size_t l = 0; l < warmup; ++l)
+        {
+            for (std::size_t k = 0; k < num_matrices; ++k)
+            {
+                f(k, policy);
+            }
+        }
+
+        for (std::size_t l = 0; l < measurement; ++l)
+        {
+            for (std::size_t k = 0; k < num_matrices; ++k)
+            {
+                double time_start = omp_get_wtime();
+                f(k, policy);
+                time += (omp_get_wtime() - time_start);
+            }
+        }
+    }
+    else
+    {
+        const fw::blas::execution_policy policy = fw::blas::execution_policy::sequential;
+
+        #pragma omp parallel
+        {
+            for (std::size_t l = 0; l < warmup; ++l)
+            {
+                #pragma omp for schedule(static)
+                for (std::size_t k = 0; k < num_matrices; ++k)
+                {
+                    f(k, policy);
+                }
+            }
+
+            double time_accumulated = 0.0;
+            for (std::size_t l = 0; l < measurement; ++l)
+            {
+                #pragma omp for schedule(static)
+                for (std::size_t k = 0; k < num_matrices; ++k)
+                {
+                    double time_start = omp_get_wtime();
+                    f(k, policy);
+                    time_accumulated += (omp_get_wtime() - time_start);
+                }
+            }
+
+            #pragma omp atomic
+            time += time_accumulated;
+        }
+
+        // the time has been accumulated over all threads
+        time /= omp_get_max_threads();
+    }
+
+    return time;
+}
+
+double kernel(const real_t alpha, const real_t beta,
+    const std::size_t n,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::unique_ptr<fp_matrix>>& a_compressed,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y_ref,
+    std::vector<std::vector<real_t>>& y,
+    const bool use_threads_per_matrix)
+{
+    // print some information
+    std::size_t memory_footprint_bytes = 0;
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        memory_footprint_bytes += a_compressed[k]->memory_footprint_bytes();
+    }
+    std::cout << "mode: symmetric_matrix, BE = " << BE << ", BM = " << BM << " (matrix memory consumption: " << memory_footprint_bytes / (1024 * 1024) << " MiB, "
+        << (8.0 * memory_footprint_bytes) / (a.size() * n * n) << " bits per element)" << std::endl;
+    std::cout << "alpha: " << alpha << ", beta: " << beta << std::endl;
+
+    // reference computation
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t j = 0; j < y[k].size(); ++j)
+        {
+            y_ref[k][j] = 1.0;
+            y[k][j] = 1.0;
+        }
+        fw::blas::gemv(layout, CblasNoTrans, n, n, alpha, &a[k][0], n, &x[k][0], 1, beta, &y_ref[k][0], 1);
+    }
+
+    // own implementation
+    const double time = measure(a.size(), use_threads_per_matrix, [&](const std::size_t k, const fw::blas::execution_policy policy)
+    {
+        a_compressed[k]->spmv(alpha, &x[k][0], beta, &y[k][0], policy);
+    });
+
+#if defined(BENCHMARK)
+    // output some metrics
+    const double gflops = measurement * a.size() * 2 * n * n / time * 1.0E-9;
+    std::cout << "gflops: " << gflops << std::endl;
+#else
+    // correctness: relative to the largest output element
+    auto deviation = [&](const std::size_t num_vectors)
+    {
+        double dev = 0.0;
+        for (std::size_t k = 0; k < a.size(); ++k)
+        {
+            for (std::size_t c = 0; c < num_vectors; ++c)
+            {
+                double y_max = 0.0;
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    y_max = std::max(y_max, static_cast<double>(std::abs(y_ref[k][c * n + j])));
+                }
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    dev = std::max(dev, std::abs(y[k][c * n + j] - y_ref[k][c * n + j]) / y_max);
+                }
+            }
+        }
+        return dev;
+    };
+    std::cout << "deviation: " << deviation(1) << std::endl;
+
+    // multiple vectors
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        for (std::size_t j = 0; j < y[k].size(); ++j)
+        {
+            y_ref[k][j] = 1.0;
+            y[k][j] = 1.0;
+        }
+        for (std::size_t c = 0; c < num_vectors; ++c)
+        {
+            fw::blas::gemv(layout, CblasNoTrans, n, n, alpha, &a[k][0], n, &x[k][c * n], 1, beta, &y_ref[k][c * n], 1);
+        }
+        a_compressed[k]->matrix_multi_vector(false, alpha, &x[k][0], n, num_vectors, beta, &y[k][0], n);
+    }
+    std::cout << "deviation (" << num_vectors << " vectors): " << deviation(num_vectors) << std::endl;
+#endif
+
+    return time;
+}
+
+#if defined(BENCHMARK)
+void kernel_gemv(const real_t alpha, const real_t beta,
+    const std::size_t n, const std::size_t bs,
+    const std::vector<std::vector<real_t>>& a,
+    const std::vector<std::vector<real_t>>& x,
+    std::vector<std::vector<real_t>>& y,
+    const bool use_threads_per_matrix,
+    const double time_spmv)
+{
+    // the same matrices compressed as general and as upper triangular matrices:
+    // a single gemv reads all blocks once, the two-gemv baseline (A = U + U^T) reads the off-diagonal blocks twice,
+    // whereas the symmetric matrix applies each off-diagonal block together with its transpose
+    std::vector<std::unique_ptr<fw::blas::matrix<real_t, L, BM, BE>>> a_general(a.size());
+    std::vector<std::unique_ptr<fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::upper_triangular, BM, BE>>> a_triangular(a.size());
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        a_general[k].reset(new fw::blas::matrix<real_t, L, BM, BE>(a[k], n, {n, n}, bs));
+        a_triangular[k].reset(new fw::blas::triangular_matrix<real_t, L, fw::blas::matrix_type::upper_triangular, BM, BE>(a[k], n, std::array<std::size_t, 1>({n}), bs));
+    }
+
+    const double time_gemv = measure(a.size(), use_threads_per_matrix, [&](const std::size_t k, const fw::blas::execution_policy policy)
+    {
+        a_general[k]->matrix_vector(false, alpha, &x[k][0], beta, &y[k][0], policy);
+    });
+    std::cout << "gflops (single gemv): " << measurement * a.size() * 2 * n * n / time_gemv * 1.0E-9 << ", speedup (spmv): " << time_gemv / time_spmv << std::endl;
+
+    // triangular matrices have no parallel matrix vector multiply
+    if (!use_threads_per_matrix)
+    {
+        const double time_two_gemv = measure(a.size(), use_threads_per_matrix, [&](const std::size_t k, const fw::blas::execution_policy)
+        {
+            a_triangular[k]->matrix_vector(false, alpha, &x[k][0], beta, &y[k][0]);
+            a_triangular[k]->matrix_vector(true, alpha, &x[k][0], 1.0, &y[k][0]);
+        });
+        std::cout << "gflops (two gemv): " << measurement * a.size() * 2 * n * n / time_two_gemv * 1.0E-9 << ", speedup (spmv): " << time_two_gemv / time_spmv << std::endl;
+    }
+}
+#endif
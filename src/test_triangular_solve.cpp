@@ -35,7 +35,8 @@ void kernel(const mat_t alpha, const bool transpose,
     const std::vector<std::vector<vec_t>>& x_ref,
     std::vector<std::vector<vec_t>>& x,
     std::vector<std::vector<vec_t>>& y,
-    const bool use_blas = false);
+    const bool use_blas = false,
+    const bool use_threads_per_matrix = false);
 
 int main(int argc, char** argv)
 {
@@ -46,11 +47,13 @@ int main(int argc, char** argv)
     const bool use_blas = (argc > 4 ? (atoi(argv[4]) != 0 ? true : false) : false);
     const double f_scale = (argc > 5 ? atof(argv[5]) : 1.0);
     const double f_shift = (argc > 6 ? atof(argv[6]) : 0.0);
+    const bool use_threads_per_matrix = (argc > 7 ? (atoi(argv[7]) != 0 ? true : false) : false);
 
     std::cout << "triangular matrix solve: " << n << " x " << n << " (" << (upper_matrix ? "upper)" : "lower)") << std::endl;
     std::cout << "matrix entries in range: " << -1.0 * std::abs(f_scale) + f_shift << " .. " << std::abs(f_scale) + f_shift << std::endl;
     std::cout << "num matrices: " << num_matrices << std::endl;
     std::cout << "block size: " << bs << std::endl;
+    std::cout << "parallelism: " << (use_threads_per_matrix ? "within matrices" : "across matrices") << std::endl;
 
 #if defined(THREAD_PINNING)
     #pragma omp parallel
@@ -129,42 +132,42 @@ int main(int argc, char** argv)
     // parameters for the matrix vector multiplication
     const mat_t alpha = static_cast<mat_t>(1.0);
     const bool transpose = transpose_benchmark;
-    kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas);
+    kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas, use_threads_per_matrix);
 #else
     {
         const mat_t alpha = static_cast<mat_t>(1.0);
         const bool transpose = false;
-        kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas);
+        kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas);
+            kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas, use_threads_per_matrix);
         }
     }
     {
         const mat_t alpha = static_cast<mat_t>(2.0);
         const bool transpose = false;
-        kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas);
+        kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas);
+            kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas, use_threads_per_matrix);
         }
     }
     {
         const mat_t alpha = static_cast<mat_t>(-0.23);
         const bool transpose = false;
-        kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas);
+        kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas);
+            kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas, use_threads_per_matrix);
         }
     }
     {
         const mat_t alpha = static_cast<mat_t>(-3.46);
         const bool transpose = false;
-        kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas);
+        kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas, use_threads_per_matrix);
         {
             const bool transpose = true;
-            kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas);
+            kernel(alpha, transpose, n, a, a_compressed, x_ref, x, y, use_blas, use_threads_per_matrix);
         }
     }
 #endif
@@ -179,7 +182,8 @@ void kernel(const mat_t alpha, const bool transpose,
     const std::vector<std::vector<vec_t>>& x_ref,
     std::vector<std::vector<vec_t>>& x,
     std::vector<std::vector<vec_t>>& y,
-    const bool use_blas)
+    const bool use_blas,
+    const bool use_threads_per_matrix)
 {
     // print some information
     std::cout << "alpha: " << alpha << ", transpose: " << (transpose ? "true" : "false")  << std::endl;
@@ -236,6 +240,33 @@ void kernel(const mat_t alpha, const bool transpose,
     // own implementation
     double time = 0.0;
 
+    if (use_threads_per_matrix && !use_blas)
+    {
+        // matrices are processed one after another, each of them using all threads
+        const fw::blas::execution_policy policy = fw::blas::execution_policy::parallel;
+        for (std::size_t l = 0; l < warmup; ++l)
+        {
+            for (std::size_t t = 0, k_offset = 0; t < a_compressed.size(); k_offset += a_compressed[t].size(), ++t)
+            {
+                for (std::size_t k = 0; k < a_compressed[t].size(); ++k)
+                {
+                    fp_triangular_solve(transpose, alpha, a_compressed[t][k], x[k_offset + k], y[k_offset + k], policy);
+                }
+            }
+        }
+
+        for (std::size_t l = 0; l < measurement; ++l)
+        {
+            for (std::size_t t = 0, k_offset = 0; t < a_compressed.size(); k_offset += a_compressed[t].size(), ++t)
+            {
+                for (std::size_t k = 0; k < a_compressed[t].size(); ++k)
+                {
+                    time += fp_triangular_solve(transpose, alpha, a_compressed[t][k], x[k_offset + k], y[k_offset + k], policy);
+                }
+            }
+        }
+    }
+    else
     #pragma omp parallel
     {
         const std::size_t thread_id = omp_get_thread_num();
@@ -292,7 +323,9 @@ void kernel(const mat_t alpha, const bool transpose,
 
 #if defined(BENCHMARK)
     // output some metrics
-    const double gflops = measurement * a.size() * n * n / (time / omp_get_max_threads()) * 1.0E-9;
+    // parallel within matrices: 'time' is the wall time, otherwise it has been accumulated over all threads
+    const double time_wall = (use_threads_per_matrix && !use_blas ? time : time / omp_get_max_threads());
+    const double gflops = measurement * a.size() * n * n / time_wall * 1.0E-9;
     std::cout << "gflops: " << gflops << std::endl;
 #else
     // correctness
@@ -0,0 +1,135 @@
+// Copyright (c) 2017-2018 Florian Wende (flwende@gmail.com)
+//
+// Distributed under the BSD 2-clause Software License
+// (See accompanying file LICENSE)
+
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <fp/fp_blas.hpp>
+
+// fundamental real data type: 'float' or 'double'
+using real_t = double;
+
+// number of bits to be used for exponent and mantissa
+#if defined(_BE)
+static constexpr std::uint32_t BE = _BE;
+#else
+static constexpr std::uint32_t BE = 11;
+#endif
+
+#if defined(_BM)
+static constexpr std::uint32_t BM = _BM;
+#else
+static constexpr std::uint32_t BM = 52;
+#endif
+
+#if defined(_ROWMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#elif defined(_COLMAJOR)
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::colmajor;
+#else
+static constexpr fw::blas::matrix_layout L = fw::blas::matrix_layout::rowmajor;
+#endif
+
+#if defined(LOWER_MATRIX)
+static constexpr bool upper_matrix = false;
+static constexpr fw::blas::matrix_type MT = fw::blas::matrix_type::lower_triangular;
+#else
+static constexpr bool upper_matrix = true;
+static constexpr fw::blas::matrix_type MT = fw::blas::matrix_type::upper_triangular;
+#endif
+
+// compressed matrix data type
+using fp_matrix = typename fw::blas::triangular_matrix<real_t, L, MT, BM, BE>;
+
+constexpr std::size_t n_default = 203;
+constexpr std::size_t bs_default = 32;
+constexpr std::size_t num_rhs_default = 24;
+
+// the compressed solve and the reference solve use the same (decompressed) matrix,
+// but the integer gemv applies fixed point off-diagonal blocks to integer representations of the vectors
+#if defined(FP_INTEGER_GEMV)
+constexpr double max_dev = 1.0E-3;
+#else
+constexpr double max_dev = 1.0E-10;
+#endif
+
+int main(int argc, char** argv)
+{
+    // read command line arguments
+    const std::size_t n = (argc > 1 ? atoi(argv[1]) : n_default);
+    const std::size_t bs = (argc > 2 ? atoi(argv[2]) : bs_default);
+    const std::size_t num_rhs = (argc > 3 ? atoi(argv[3]) : num_rhs_default);
+
+    std::cout << "triangular matrix solve (multiple right hand sides): " << n << " x " << n << " (" << (upper_matrix ? "upper)" : "lower)") << std::endl;
+    std::cout << "block size: " << bs << std::endl;
+    std::cout << "right hand sides: " << num_rhs << std::endl;
+
+    // diagonally dominant matrix: the solve is well conditioned
+    std::vector<real_t> a(n * n);
+    std::uint32_t seed = 1;
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const bool zero = (upper_matrix ? i < j : i > j);
+            a[fw::blas::idx<L>(j, i, n)] = (zero ? 0.0 : (i == j ? 1.0 + 1.0 * rand_r(&seed) / RAND_MAX : (2.0 * rand_r(&seed) / RAND_MAX - 1.0) / n));
+        }
+    }
+
+    const fp_matrix a_compressed(a, n, std::array<std::size_t, 1>({n}), bs);
+
+    // the reference uses the decompressed matrix
+    std::vector<real_t> a_decompressed(n * n, 0.0);
+    a_compressed.decompress(&a_decompressed[0], n);
+
+    // right hand sides are stored column major (one after another): a row major matrix is the transpose of a column major one
+    const CBLAS_UPLO uplo = ((L == fw::blas::matrix_layout::rowmajor) == upper_matrix ? CblasLower : CblasUpper);
+    const std::size_t ldy = n + 3;
+    const std::size_t ldx = n + 5;
+    const real_t alpha = 0.7;
+    bool passed = true;
+
+    for (const bool transpose : {false, true})
+    {
+        std::vector<real_t> y(ldy * num_rhs);
+        for (std::size_t i = 0; i < y.size(); ++i)
+        {
+            y[i] = 2.0 * rand_r(&seed) / RAND_MAX - 1.0;
+        }
+
+        // reference: alpha * A(T) * X = Y
+        std::vector<real_t> x_ref(y);
+        const CBLAS_TRANSPOSE trans = ((L == fw::blas::matrix_layout::rowmajor) != transpose ? CblasTrans : CblasNoTrans);
+        fw::blas::trsm(CblasColMajor, CblasLeft, uplo, trans, CblasNonUnit, n, num_rhs, 1.0 / alpha, &a_decompressed[0], n, &x_ref[0], ldy);
+
+        // separate input and output
+        std::vector<real_t> x(ldx * num_rhs, 0.0);
+        a_compressed.trsm(transpose, alpha, &x[0], ldx, num_rhs, &y[0], ldy);
+
+        // in-place: the solution overwrites the right hand sides
+        std::vector<real_t> xy(y);
+        a_compressed.trsm(transpose, alpha, &xy[0], ldy, num_rhs, &xy[0], ldy);
+
+        double dev = 0.0, dev_in_place = 0.0, x_max = 0.0;
+        for (std::size_t c = 0; c < num_rhs; ++c)
+        {
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                dev = std::max(dev, static_cast<double>(std::abs(x[c * ldx + j] - x_ref[c * ldy + j])));
+                dev_in_place = std::max(dev_in_place, static_cast<double>(std::abs(xy[c * ldy + j] - x_ref[c * ldy + j])));
+                x_max = std::max(x_max, static_cast<double>(std::abs(x_ref[c * ldy + j])));
+            }
+        }
+        dev /= x_max;
+        dev_in_place /= x_max;
+        passed &= (dev <= max_dev && dev_in_place <= max_dev);
+
+        std::cout << (transpose ? "transpose: " : "") << "deviation: " << dev << ", in-place: " << dev_in_place << std::endl;
+    }
+
+    return (passed ? 0 : 1);
+}
@@ -54,11 +54,11 @@ double blas_triangular_solve(const bool transpose, const std::size_t n, const ma
     return time;
 }
 
-double fp_triangular_solve(const bool transpose, const mat_t alpha, const fp_matrix& a, std::vector<vec_t>& x, std::vector<vec_t>& y)
+double fp_triangular_solve(const bool transpose, const mat_t alpha, const fp_matrix& a, std::vector<vec_t>& x, std::vector<vec_t>& y, const fw::blas::execution_policy policy)
 {
     double time = omp_get_wtime();
     {
-        a.triangular_solve(transpose, alpha, x, y);
+        a.triangular_solve(transpose, alpha, x, y, policy);
     }
     return (omp_get_wtime() - time);
 }
\ No newline at end of file